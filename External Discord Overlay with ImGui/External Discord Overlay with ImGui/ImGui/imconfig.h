@@ -46,8 +46,12 @@
 //#define IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS              // Don't implement ImFabs/ImSqrt/ImPow/ImFmod/ImCos/ImSin/ImAcos/ImAtan2 so you can implement them yourself.
 //#define IMGUI_DISABLE_FILE_FUNCTIONS                      // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle at all (replace them with dummies)
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
+//#define IMGUI_DISABLE_THREAD_FUNCTIONS                    // Don't implement ImThreadCreate/ImThreadJoin at all: font atlas variants (ImFontAtlas::RequestBakedScale(), ImFontAtlas::BuildAsync()) are then built on the calling thread.
+//#define IMGUI_DISABLE_DEFAULT_THREAD_FUNCTIONS            // Don't implement ImThreadCreate/ImThreadJoin so you can implement them yourself (e.g. with your job system) if you don't want to link with CreateThread/pthread_create.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_ENABLE_ALLOC_TRACKING                       // Track allocations per subsystem in MemAlloc()/MemFree(), see GetAllocStats() and the Metrics window. Adds a 16 bytes header to each allocation.
+//#define IMGUI_ENABLE_PROFILER                             // Record timing zones (IM_PROFILE_SCOPE) in NewFrame()/Begin()/End()/Render(), tables layout and backends, see GetProfiler() and the Metrics window.
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
@@ -60,11 +60,12 @@ CODE
 // [SECTION] MISC HELPERS/UTILITIES (Geometry functions)
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
+// [SECTION] MISC HELPERS/UTILITIES (Thread functions)
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 // [SECTION] MISC HELPERS/UTILITIES (Color functions)
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextLog
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -83,6 +84,8 @@ CODE
 // [SECTION] LOCALIZATION
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
 // [SECTION] PLATFORM DEPENDENT HELPERS
+// [SECTION] PROFILER
+// [SECTION] INPUT RECORDING
 // [SECTION] METRICS/DEBUGGER WINDOW
 // [SECTION] DEBUG LOG WINDOW
 // [SECTION] OTHER DEBUG TOOLS (ITEM PICKER, STACK TOOL)
@@ -912,7 +915,7 @@ CODE
 #endif
 
 // [Windows] OS specific includes (optional)
-#if defined(_WIN32) && defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+#if defined(_WIN32) && defined(IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS) && defined(IMGUI_DISABLE_DEFAULT_THREAD_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_CLIPBOARD_FUNCTIONS) && defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
 #define IMGUI_DISABLE_WIN32_FUNCTIONS
 #endif
 #if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
@@ -933,6 +936,17 @@ CODE
 #endif
 #endif
 
+// [POSIX] Threads, used to build font atlas variants in the background (see ImFontAtlas::RequestBakedScale())
+#if !defined(_WIN32) && !defined(IMGUI_DISABLE_DEFAULT_THREAD_FUNCTIONS)
+#include <pthread.h>        // pthread_create, pthread_join
+#include <sched.h>          // sched_yield
+#endif
+
+// [Profiler] Clock used to time IM_PROFILE_SCOPE() zones (see ProfilerGetTicks())
+#ifdef IMGUI_ENABLE_PROFILER
+#include <time.h>           // clock_gettime, clock
+#endif
+
 // [Apple] OS specific includes
 #if defined(__APPLE__)
 #include <TargetConditionals.h>
@@ -1012,6 +1026,9 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+static void             WindowSettingsHandler_WriteDirty(ImGuiContext*, ImGuiSettingsHandler*);
+static void             WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler*, int record_offset, ImGuiID id, const void* data, int data_size);
+static void             WindowSettingsHandler_WriteBinary(ImGuiContext*, ImGuiSettingsHandler*);
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data_ctx);
@@ -1047,6 +1064,9 @@ static void             ErrorCheckNewFrameSanityChecks();
 static void             ErrorCheckEndFrameSanityChecks();
 static void             UpdateDebugToolItemPicker();
 static void             UpdateDebugToolStackQueries();
+static void             UpdateProfilerNewFrame();
+static void             UpdateDebugMetricsHistory();
+static void             UpdateInputRecording();
 
 // Inputs
 static void             UpdateKeyboardInputs();
@@ -1109,6 +1129,11 @@ static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_d
 static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
+static ImGuiAllocStats      GImAllocStats;                  // Only updated when IMGUI_ENABLE_ALLOC_TRACKING is defined
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+static thread_local ImGuiAllocTag GImAllocTag = ImGuiAllocTag_Misc;
+static int                  GImAllocStatsLock = 0;          // Spinlock for GImAllocStats, as MemAlloc()/MemFree() may be called from worker threads
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
@@ -1207,6 +1232,7 @@ ImGuiIO::ImGuiIO()
     DeltaTime = 1.0f / 60.0f;
     IniSavingRate = 5.0f;
     IniFilename = "imgui.ini"; // Important: "imgui.ini" is relative to current working dir, most apps will want to lock this to an absolute path (e.g. same path as executables).
+    IniBinaryFilename = NULL;
     LogFilename = "imgui_log.txt";
     MouseDoubleClickTime = 0.30f;
     MouseDoubleClickMaxDist = 6.0f;
@@ -1240,6 +1266,7 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
 
@@ -1753,14 +1780,53 @@ const ImWchar* ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* buf_begin)
     return buf_mid_line;
 }
 
+// Case-insensitive (ASCII only) search of 'needle' in 'haystack'. A match never extends past 'haystack_end'.
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + strlen(needle);
 
+#ifdef IMGUI_ENABLE_SSE2
+    // Test 16 candidate positions at a time on both their first and last characters (in either case),
+    // and only compare the rest of the needle for candidates passing both tests.
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len > 0)
+    {
+        if (!haystack_end)
+            haystack_end = haystack + strlen(haystack);
+        const char first_up = ImToUpper(needle[0]);
+        const char last_up = ImToUpper(needle_end[-1]);
+        const __m128i first_a = _mm_set1_epi8(first_up);
+        const __m128i first_b = _mm_set1_epi8((first_up >= 'A' && first_up <= 'Z') ? (char)(first_up | 32) : first_up);
+        const __m128i last_a = _mm_set1_epi8(last_up);
+        const __m128i last_b = _mm_set1_epi8((last_up >= 'A' && last_up <= 'Z') ? (char)(last_up | 32) : last_up);
+        for (; haystack_end - haystack >= needle_len + 15; haystack += 16)
+        {
+            const __m128i block_first = _mm_loadu_si128((const __m128i*)(const void*)haystack);
+            const __m128i block_last = _mm_loadu_si128((const __m128i*)(const void*)(haystack + needle_len - 1));
+            const __m128i eq_first = _mm_or_si128(_mm_cmpeq_epi8(block_first, first_a), _mm_cmpeq_epi8(block_first, first_b));
+            const __m128i eq_last = _mm_or_si128(_mm_cmpeq_epi8(block_last, last_a), _mm_cmpeq_epi8(block_last, last_b));
+            for (unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last)), n = 0; mask != 0; mask >>= 1, n++)
+            {
+                if ((mask & 1) == 0)
+                    continue;
+                const char* b = needle + 1;
+                for (const char* a = haystack + n + 1; b < needle_end - 1; a++, b++)
+                    if (ImToUpper(*a) != ImToUpper(*b))
+                        break;
+                if (b >= needle_end - 1)
+                    return haystack + n;
+            }
+        }
+        // Fall through for remaining characters
+    }
+#endif
+
     const char un0 = (char)ImToUpper(*needle);
     while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
     {
+        if (haystack_end && haystack_end - haystack < needle_end - needle)
+            break;
         if (ImToUpper(*haystack) == un0)
         {
             const char* b = needle + 1;
@@ -1990,6 +2056,7 @@ bool    ImFileClose(ImFileHandle f)     { return fclose(f) == 0; }
 ImU64   ImFileGetSize(ImFileHandle f)   { long off = 0, sz = 0; return ((off = ftell(f)) != -1 && !fseek(f, 0, SEEK_END) && (sz = ftell(f)) != -1 && !fseek(f, off, SEEK_SET)) ? (ImU64)sz : (ImU64)-1; }
 ImU64   ImFileRead(void* data, ImU64 sz, ImU64 count, ImFileHandle f)           { return fread(data, (size_t)sz, (size_t)count, f); }
 ImU64   ImFileWrite(const void* data, ImU64 sz, ImU64 count, ImFileHandle f)    { return fwrite(data, (size_t)sz, (size_t)count, f); }
+bool    ImFileSeek(ImFileHandle f, ImU64 offset)                                { return fseek(f, (long)offset, SEEK_SET) == 0; }
 #endif // #ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 
 // Helper: Load file content into memory
@@ -2034,6 +2101,110 @@ void*   ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_f
     return file_data;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] MISC HELPERS/UTILITIES (Thread functions)
+//-----------------------------------------------------------------------------
+
+// Spinlock used around short critical sections which may be entered from worker threads (allocation counters, stb_decompress() scratch state).
+// Waiting threads poll with a plain load (no cache line ping-pong), pause the CPU for a few iterations, then give up their time slice.
+static inline void ImThreadPause()
+{
+#if defined(IMGUI_ENABLE_SSE)
+    _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+    __yield();
+#elif defined(__GNUC__) && (defined(__arm__) || defined(__aarch64__))
+    __asm__ __volatile__("yield");
+#endif
+}
+
+static inline void ImThreadYield()
+{
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+    ::SwitchToThread();
+#elif !defined(_WIN32) && !defined(IMGUI_DISABLE_DEFAULT_THREAD_FUNCTIONS)
+    sched_yield();
+#else
+    ImThreadPause();
+#endif
+}
+
+void ImSpinLockAcquire(volatile int* lock)
+{
+    int spin_count = 0;
+    while (ImAtomicExchange(lock, 1) != 0)
+        while (ImAtomicLoad(lock) != 0)
+        {
+            if (spin_count < 64)
+            {
+                ImThreadPause();
+                spin_count++;
+            }
+            else
+            {
+                ImThreadYield();
+            }
+        }
+}
+
+// Default thread functions
+#ifndef IMGUI_DISABLE_DEFAULT_THREAD_FUNCTIONS
+
+#if defined(_WIN32) && defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+ImThreadHandle ImThreadCreate(ImThreadFunc, void*)  { return NULL; }
+void ImThreadJoin(ImThreadHandle)                   { }
+#else
+struct ImThreadData
+{
+    ImThreadFunc    Func;
+    void*           UserData;
+#ifdef _WIN32
+    HANDLE          Handle;
+#else
+    pthread_t       Handle;
+#endif
+};
+
+#ifdef _WIN32
+static DWORD WINAPI ImThreadEntry(LPVOID arg)       { ImThreadData* thread = (ImThreadData*)arg; thread->Func(thread->UserData); return 0; }
+#else
+static void*        ImThreadEntry(void* arg)        { ImThreadData* thread = (ImThreadData*)arg; thread->Func(thread->UserData); return NULL; }
+#endif
+
+ImThreadHandle ImThreadCreate(ImThreadFunc func, void* user_data)
+{
+    ImThreadData* thread = IM_NEW(ImThreadData)();
+    thread->Func = func;
+    thread->UserData = user_data;
+#ifdef _WIN32
+    thread->Handle = ::CreateThread(NULL, 0, ImThreadEntry, thread, 0, NULL);
+    bool ok = (thread->Handle != NULL);
+#else
+    bool ok = (pthread_create(&thread->Handle, NULL, ImThreadEntry, thread) == 0);
+#endif
+    if (!ok)
+    {
+        IM_DELETE(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+void ImThreadJoin(ImThreadHandle handle)
+{
+    ImThreadData* thread = (ImThreadData*)handle;
+#ifdef _WIN32
+    ::WaitForSingleObject(thread->Handle, INFINITE);
+    ::CloseHandle(thread->Handle);
+#else
+    pthread_join(thread->Handle, NULL);
+#endif
+    IM_DELETE(thread);
+}
+#endif
+
+#endif // #ifndef IMGUI_DISABLE_DEFAULT_THREAD_FUNCTIONS
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (ImText* functions)
 //-----------------------------------------------------------------------------
@@ -2493,6 +2664,7 @@ void ImGuiTextFilter::ImGuiTextRange::split(char separator, ImVector<ImGuiTextRa
 void ImGuiTextFilter::Build()
 {
     Filters.resize(0);
+    CachedResults.resize(0);
     ImGuiTextRange input_range(InputBuf, InputBuf + strlen(InputBuf));
     input_range.split(',', &Filters);
 
@@ -2545,8 +2717,20 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+bool ImGuiTextFilter::PassFilterCached(int key, const char* text, const char* text_end)
+{
+    IM_ASSERT(key >= 0);
+    if (Filters.empty())
+        return true;
+    if (key >= CachedResults.Size)
+        CachedResults.resize(key + 1, 0);
+    if (CachedResults[key] == 0)
+        CachedResults[key] = PassFilter(text, text_end) ? 2 : 1;
+    return CachedResults[key] == 2;
+}
+
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiTextBuffer, ImGuiTextIndex, ImGuiTextLog
 //-----------------------------------------------------------------------------
 
 // On some platform vsnprintf() takes va_list by reference and modifies it.
@@ -2614,6 +2798,105 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     va_end(args_copy);
 }
 
+// Helpers to use ImGuiTextBuffer as a binary stream (profiler captures, input recordings)
+// Integers are little-endian, 'varint' is an unsigned LEB128 integer: 7 bits per byte, low bits first, high bit set on every byte but the last.
+static void BinaryWriteU8(ImGuiTextBuffer* buf, ImU8 v)
+{
+    const char c = (char)v;
+    buf->append(&c, &c + 1);
+}
+
+static void BinaryWriteU32(ImGuiTextBuffer* buf, ImU32 v)
+{
+    char bytes[4];
+    for (int n = 0; n < 4; n++)
+        bytes[n] = (char)(v >> (n * 8));
+    buf->append(bytes, bytes + 4);
+}
+
+static void BinaryWriteU64(ImGuiTextBuffer* buf, ImU64 v)
+{
+    BinaryWriteU32(buf, (ImU32)v);
+    BinaryWriteU32(buf, (ImU32)(v >> 32));
+}
+
+static void BinaryWriteFloat(ImGuiTextBuffer* buf, float v)
+{
+    ImU32 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    BinaryWriteU32(buf, bits);
+}
+
+static void BinaryWriteVarint(ImGuiTextBuffer* buf, ImU64 v)
+{
+    char bytes[10];
+    int len = 0;
+    do
+    {
+        bytes[len] = (char)(v & 0x7F);
+        v >>= 7;
+        if (v != 0)
+            bytes[len] |= (char)0x80;
+        len++;
+    } while (v != 0);
+    buf->append(bytes, bytes + len);
+}
+
+// Reading past the end sets 'Error' and returns zeroes, so a whole record can be read before checking for errors.
+struct ImBinaryReader
+{
+    const ImU8* Data;
+    const ImU8* DataEnd;
+    bool        Error;
+
+    ImBinaryReader(const void* data, size_t data_size) { Data = (const ImU8*)data; DataEnd = Data + data_size; Error = false; }
+};
+
+static ImU8 BinaryReadU8(ImBinaryReader* r)
+{
+    if (r->Data >= r->DataEnd)
+    {
+        r->Error = true;
+        return 0;
+    }
+    return *r->Data++;
+}
+
+static ImU32 BinaryReadU32(ImBinaryReader* r)
+{
+    if (r->DataEnd - r->Data < 4)
+    {
+        r->Error = true;
+        r->Data = r->DataEnd;
+        return 0;
+    }
+    const ImU32 v = (ImU32)r->Data[0] | ((ImU32)r->Data[1] << 8) | ((ImU32)r->Data[2] << 16) | ((ImU32)r->Data[3] << 24);
+    r->Data += 4;
+    return v;
+}
+
+static float BinaryReadFloat(ImBinaryReader* r)
+{
+    const ImU32 bits = BinaryReadU32(r);
+    float v;
+    memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+static ImU64 BinaryReadVarint(ImBinaryReader* r)
+{
+    ImU64 v = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        const ImU8 b = BinaryReadU8(r);
+        v |= (ImU64)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+            return v;
+    }
+    r->Error = true;
+    return 0;
+}
+
 void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
 {
     IM_ASSERT(old_size >= 0 && new_size >= old_size && new_size >= EndOffset);
@@ -2628,6 +2911,271 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+ImGuiTextLog::ImGuiTextLog()
+{
+    MaxSize = 4 * 1024 * 1024;
+    ChunkSize = 64 * 1024;
+    IngestMaxMessages = 64 * 1024;
+    AutoScroll = true;
+    QueueStub.Next = NULL;
+    QueueStub.Len = 0;
+    QueueHead = &QueueStub;
+    QueueTail = &QueueStub;
+    ChunkSpare = NULL;
+    LineCount = 0;
+    FilterHash = 0;
+    DroppedDisplayLines = 0;
+}
+
+ImGuiTextLog::~ImGuiTextLog()
+{
+    Clear();
+    if (ChunkSpare)
+        IM_DELETE(ChunkSpare);
+}
+
+// Lock-free MPSC queue (intrusive, after Dmitry Vyukov's design).
+// Producers swap QueueHead then link the previous head to their message. The consumer follows Next pointers from
+// QueueTail, and leaves a message for the next Ingest() if its producer is still between those two steps.
+static void TextLogQueuePush(ImGuiTextLog* log, ImGuiTextLogMsg* msg)
+{
+    msg->Next = NULL;
+    ImGuiTextLogMsg* prev = (ImGuiTextLogMsg*)ImAtomicExchangePtr(&log->QueueHead, msg);
+    ImAtomicStorePtr(&prev->Next, msg);
+}
+
+static ImGuiTextLogMsg* TextLogQueuePop(ImGuiTextLog* log)
+{
+    ImGuiTextLogMsg* tail = log->QueueTail;
+    ImGuiTextLogMsg* next = (ImGuiTextLogMsg*)ImAtomicLoadPtr(&tail->Next);
+    if (tail == &log->QueueStub)
+    {
+        if (next == NULL)
+            return NULL;
+        log->QueueTail = tail = next;
+        next = (ImGuiTextLogMsg*)ImAtomicLoadPtr(&tail->Next);
+    }
+    if (next != NULL)
+    {
+        log->QueueTail = next;
+        return tail;
+    }
+    if (tail != ImAtomicLoadPtr(&log->QueueHead))
+        return NULL; // A producer is between its two steps
+    TextLogQueuePush(log, &log->QueueStub);
+    next = (ImGuiTextLogMsg*)ImAtomicLoadPtr(&tail->Next);
+    if (next != NULL)
+    {
+        log->QueueTail = next;
+        return tail;
+    }
+    return NULL;
+}
+
+void ImGuiTextLog::AddLine(const char* text, const char* text_end)
+{
+    const int len = (int)(text_end ? (text_end - text) : strlen(text));
+    ImGuiTextLogMsg* msg = (ImGuiTextLogMsg*)IM_ALLOC(sizeof(ImGuiTextLogMsg) + (size_t)len);
+    msg->Len = len;
+    memcpy(msg + 1, text, (size_t)len);
+    TextLogQueuePush(this, msg);
+}
+
+void ImGuiTextLog::AddLog(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    char buf[512];
+    int len = ImFormatStringV(buf, IM_ARRAYSIZE(buf), fmt, args);
+    va_end(args);
+    if (len < IM_ARRAYSIZE(buf) - 1)
+    {
+        AddLine(buf, buf + len);
+        return;
+    }
+
+    // Longer than our stack buffer: format again directly into the message
+    va_start(args, fmt);
+    len = ImFormatStringV(NULL, 0, fmt, args);
+    va_end(args);
+    if (len < 0)
+        return;
+    ImGuiTextLogMsg* msg = (ImGuiTextLogMsg*)IM_ALLOC(sizeof(ImGuiTextLogMsg) + (size_t)len + 1);
+    msg->Len = len;
+    va_start(args, fmt);
+    ImFormatStringV((char*)(msg + 1), (size_t)len + 1, fmt, args);
+    va_end(args);
+    TextLogQueuePush(this, msg);
+}
+
+void ImGuiTextLog::Clear()
+{
+    for (ImGuiTextLogMsg* msg; (msg = TextLogQueuePop(this)) != NULL; )
+        IM_FREE(msg);
+    for (int n = 0; n < Chunks.Size; n++)
+        IM_DELETE(Chunks[n]);
+    Chunks.clear();
+    FilteredLines.clear();
+    LineCount = 0;
+    DroppedDisplayLines = 0;
+}
+
+static ImGuiTextLogChunk* TextLogAddChunk(ImGuiTextLog* log)
+{
+    // Drop oldest chunks to stay under MaxSize
+    int total_size = 0;
+    for (int n = 0; n < log->Chunks.Size; n++)
+        total_size += log->Chunks[n]->Buf.size();
+    while (log->Chunks.Size > 0 && total_size + log->ChunkSize > log->MaxSize)
+    {
+        ImGuiTextLogChunk* dropped = log->Chunks[0];
+        log->Chunks.erase(log->Chunks.Data);
+        total_size -= dropped->Buf.size();
+        const int line_first = log->GetLineFirst();
+        if (log->FilterHash != 0)
+        {
+            int n = 0;
+            while (n < log->FilteredLines.Size && log->FilteredLines[n] < line_first)
+                n++;
+            log->FilteredLines.erase(log->FilteredLines.Data, log->FilteredLines.Data + n);
+            log->DroppedDisplayLines += n;
+        }
+        else
+        {
+            log->DroppedDisplayLines += line_first - dropped->LineFirst;
+        }
+        if (log->ChunkSpare)
+            IM_DELETE(log->ChunkSpare);
+        log->ChunkSpare = dropped;
+    }
+
+    ImGuiTextLogChunk* chunk = log->ChunkSpare;
+    if (chunk != NULL)
+    {
+        log->ChunkSpare = NULL;
+        chunk->Buf.Buf.resize(0);
+        chunk->LineIndex.LineOffsets.resize(0);
+        chunk->LineIndex.EndOffset = 0;
+    }
+    else
+    {
+        chunk = IM_NEW(ImGuiTextLogChunk)();
+        chunk->Buf.reserve(log->ChunkSize + 1);
+    }
+    chunk->LineFirst = log->LineCount;
+    log->Chunks.push_back(chunk);
+    return chunk;
+}
+
+void ImGuiTextLog::Ingest(int max_messages)
+{
+    for (ImGuiTextLogMsg* msg; max_messages > 0 && (msg = TextLogQueuePop(this)) != NULL; max_messages--)
+    {
+        const char* text = (const char*)(msg + 1);
+        const int len = msg->Len;
+        ImGuiTextLogChunk* chunk = Chunks.Size > 0 ? Chunks.back() : NULL;
+        if (chunk == NULL || (chunk->Buf.size() > 0 && chunk->Buf.size() + len + 1 > ChunkSize))
+            chunk = TextLogAddChunk(this);
+
+        // Lines in a chunk are always terminated by \n
+        const int old_size = chunk->Buf.size();
+        const int old_line_count = chunk->LineIndex.size();
+        chunk->Buf.append(text, text + len);
+        if (len == 0 || text[len - 1] != '\n')
+            chunk->Buf.append("\n");
+        chunk->LineIndex.append(chunk->Buf.begin(), old_size, chunk->Buf.size());
+        IM_FREE(msg);
+
+        for (int line_n = old_line_count; line_n < chunk->LineIndex.size(); line_n++, LineCount++)
+        {
+            if (FilterHash == 0)
+                continue;
+            const char* line_begin;
+            const char* line_end;
+            GetLine(LineCount, &line_begin, &line_end);
+            if (Filter.PassFilter(line_begin, line_end))
+                FilteredLines.push_back(LineCount);
+        }
+    }
+}
+
+void ImGuiTextLog::GetLine(int line_n, const char** out_begin, const char** out_end)
+{
+    int lo = 0, hi = Chunks.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (Chunks[mid]->LineFirst <= line_n)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    ImGuiTextLogChunk* chunk = Chunks[lo];
+    IM_ASSERT(line_n >= chunk->LineFirst && line_n - chunk->LineFirst < chunk->LineIndex.size());
+    const char* line_begin = chunk->LineIndex.get_line_begin(chunk->Buf.begin(), line_n - chunk->LineFirst);
+    const char* line_end = chunk->LineIndex.get_line_end(chunk->Buf.begin(), line_n - chunk->LineFirst);
+    if (line_end > line_begin && line_end[-1] == '\n')
+        line_end--;
+    *out_begin = line_begin;
+    *out_end = line_end;
+}
+
+// Only visible lines are submitted. With an active filter, the list of lines passing it is updated as lines
+// are added (and rebuilt when the filter changes), so filtered output is clipped as well.
+void ImGuiTextLog::Draw(const char* str_id, const ImVec2& size)
+{
+    const ImGuiID filter_hash = Filter.IsActive() ? ImHashStr(Filter.InputBuf) : 0;
+    if (filter_hash != FilterHash)
+    {
+        FilterHash = filter_hash;
+        FilteredLines.resize(0);
+        if (filter_hash != 0)
+            for (int line_n = GetLineFirst(); line_n < LineCount; line_n++)
+            {
+                const char* line_begin;
+                const char* line_end;
+                GetLine(line_n, &line_begin, &line_end);
+                if (Filter.PassFilter(line_begin, line_end))
+                    FilteredLines.push_back(line_n);
+            }
+    }
+    Ingest(IngestMaxMessages);
+
+    const int dropped_display_lines = DroppedDisplayLines;
+    DroppedDisplayLines = 0;
+    if (!ImGui::BeginChild(str_id, size, false, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGui::EndChild();
+        return;
+    }
+
+    // Keep the same lines in view when oldest lines are dropped, unless we are sticking to the bottom
+    const float line_height = ImGui::GetTextLineHeight();
+    const bool stick_to_bottom = AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY();
+    if (dropped_display_lines > 0 && !stick_to_bottom)
+        ImGui::SetScrollY(ImMax(0.0f, ImGui::GetScrollY() - dropped_display_lines * line_height));
+
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+    const bool use_filter = (FilterHash != 0);
+    const int line_first = GetLineFirst();
+    ImGuiListClipper clipper;
+    clipper.Begin(use_filter ? FilteredLines.Size : LineCount - line_first, line_height);
+    while (clipper.Step())
+        for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+        {
+            const char* line_begin;
+            const char* line_end;
+            GetLine(use_filter ? FilteredLines[n] : line_first + n, &line_begin, &line_end);
+            ImGui::TextUnformatted(line_begin, line_end);
+        }
+    clipper.End();
+    ImGui::PopStyleVar();
+
+    if (stick_to_bottom)
+        ImGui::SetScrollHereY(1.0f);
+    ImGui::EndChild();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 // This is currently not as flexible/powerful as it should be and really confusing/spaghetti, mostly because we changed
@@ -2714,14 +3262,13 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
     // The clipper should probably have a final step to display the last item in a regular manner, maybe with an opt-out flag for data sets which may have costly seek?
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
-    float off_y = pos_y - window->DC.CursorPos.y;
     window->DC.CursorPos.y = pos_y;
     window->DC.CursorMaxPos.y = ImMax(window->DC.CursorMaxPos.y, pos_y - g.Style.ItemSpacing.y);
     window->DC.CursorPosPrevLine.y = window->DC.CursorPos.y - line_height;  // Setting those fields so that SetScrollHereY() can properly function after the end of our clipper usage.
@@ -2733,7 +3280,6 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
@@ -2744,8 +3290,17 @@ static void ImGuiListClipper_SeekCursorForItem(ImGuiListClipper* clipper, int it
     // StartPosY starts from ItemsFrozen hence the subtraction
     // Perform the add and multiply with double to allow seeking through larger ranges
     ImGuiListClipperData* data = (ImGuiListClipperData*)clipper->TempData;
+    if (ImGuiListClipperHeights* heights = clipper->ItemsHeights)
+    {
+        // Variable height: we always seek forward from the end of the last submitted range
+        float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + heights->GetItemOffset(item_n) - heights->GetItemOffset(data->ItemsFrozen));
+        float line_height = (item_n > 0) ? heights->GetItemHeight(item_n - 1) : heights->DefaultHeight;
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, line_height, item_n - ImMax(clipper->DisplayEnd, data->ItemsFrozen));
+        return;
+    }
     float pos_y = (float)((double)clipper->StartPosY + data->LossynessOffset + (double)(item_n - data->ItemsFrozen) * clipper->ItemsHeight);
-    ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight);
+    const int row_increase = (int)(((pos_y - GImGui->CurrentWindow->DC.CursorPos.y) / clipper->ItemsHeight) + 0.5f);
+    ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, clipper->ItemsHeight, row_increase);
 }
 
 ImGuiListClipper::ImGuiListClipper()
@@ -2773,6 +3328,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
 
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
+    ItemsHeights = NULL;
     ItemsCount = items_count;
     DisplayStart = -1;
     DisplayEnd = 0;
@@ -2786,6 +3342,14 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     TempData = data;
 }
 
+// Items count and height estimate are taken from 'items_heights': call items_heights->Resize() before.
+void ImGuiListClipper::BeginVariableHeight(ImGuiListClipperHeights* items_heights)
+{
+    IM_ASSERT(items_heights != NULL && items_heights->DefaultHeight > 0.0f && "Call ImGuiListClipperHeights::Resize() first!");
+    Begin(items_heights->Heights.Size, items_heights->DefaultHeight); // Item height is known in advance: no measuring step
+    ItemsHeights = items_heights;
+}
+
 void ImGuiListClipper::End()
 {
     ImGuiContext& g = *Ctx;
@@ -2829,6 +3393,19 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
 
+    // Variable height: measure the item submitted by the previous step
+    // (skipped where float positions are too imprecise to measure anything, the previous height/estimate is kept)
+    ImGuiListClipperHeights* heights = clipper->ItemsHeights;
+    const bool measure_items = (heights != NULL && heights->HeightCallback == NULL);
+    if (data->MeasureItem >= 0)
+    {
+        const float measured_height = window->DC.CursorPos.y - data->MeasureStartPosY;
+        const bool affected_by_floating_point_precision = ImIsFloatAboveGuaranteedIntegerPrecision(data->MeasureStartPosY) || ImIsFloatAboveGuaranteedIntegerPrecision(window->DC.CursorPos.y);
+        if (measured_height > 0.0f && !affected_by_floating_point_precision && heights->Heights[data->MeasureItem] != measured_height)
+            heights->SetItemHeight(data->MeasureItem, measured_height);
+        data->MeasureItem = -1;
+    }
+
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
         return false;
@@ -2840,7 +3417,14 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         clipper->DisplayStart = data->ItemsFrozen;
         clipper->DisplayEnd = ImMin(data->ItemsFrozen + 1, clipper->ItemsCount);
         if (clipper->DisplayStart < clipper->DisplayEnd)
+        {
+            if (measure_items)
+            {
+                data->MeasureItem = clipper->DisplayStart;
+                data->MeasureStartPosY = window->DC.CursorPos.y;
+            }
             data->ItemsFrozen++;
+        }
         return true;
     }
 
@@ -2910,11 +3494,23 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        // - Variable height: positions are converted to offsets from the top of the list, then looked up in the heights tree.
+        const double heights_base_offset = heights ? heights->GetItemOffset(already_submitted) : 0.0;
         for (int i = 0; i < data->Ranges.Size; i++)
             if (data->Ranges[i].PosToIndexConvert)
             {
-                int m1 = (int)(((double)data->Ranges[i].Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
-                int m2 = (int)((((double)data->Ranges[i].Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                int m1, m2;
+                if (heights)
+                {
+                    const double base_y = (double)window->DC.CursorPos.y + data->LossynessOffset - heights_base_offset;
+                    m1 = heights->FindItemAtOffset((double)data->Ranges[i].Min - base_y) - already_submitted;
+                    m2 = heights->FindItemAtOffset((double)data->Ranges[i].Max - base_y) + 1 - already_submitted;
+                }
+                else
+                {
+                    m1 = (int)(((double)data->Ranges[i].Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
+                    m2 = (int)((((double)data->Ranges[i].Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                }
                 data->Ranges[i].Min = ImClamp(already_submitted + m1 + data->Ranges[i].PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
                 data->Ranges[i].Max = ImClamp(already_submitted + m2 + data->Ranges[i].PosToIndexOffsetMax, data->Ranges[i].Min + 1, clipper->ItemsCount);
                 data->Ranges[i].PosToIndexConvert = false;
@@ -2925,10 +3521,20 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     // Step 0+ (if item height is given in advance) or 1+: Display the next range in line.
     if (data->StepNo < data->Ranges.Size)
     {
-        clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
+        const int display_start = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
+        if (display_start > already_submitted) //-V1051
+            ImGuiListClipper_SeekCursorForItem(clipper, display_start); // Before overwriting DisplayEnd, which is where we are seeking from
+        clipper->DisplayStart = display_start;
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
-        if (clipper->DisplayStart > already_submitted) //-V1051
-            ImGuiListClipper_SeekCursorForItem(clipper, clipper->DisplayStart);
+        if (measure_items && clipper->DisplayStart < clipper->DisplayEnd)
+        {
+            // Variable height: submit items one by one so each of them can be measured. Stay on this range until it is done.
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+            data->MeasureItem = clipper->DisplayStart;
+            data->MeasureStartPosY = window->DC.CursorPos.y;
+            if (clipper->DisplayEnd < ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount))
+                return true;
+        }
         data->StepNo++;
         return true;
     }
@@ -2964,6 +3570,93 @@ bool ImGuiListClipper::Step()
     return ret;
 }
 
+// Fenwick tree helpers. Tree[] is 1-based: Tree[i] holds the sum of heights of items [i - (i & -i), i).
+// - Resize() appends items in O(log N) each by summing the range covered by the new node from existing prefix sums.
+// - Shrinking only needs to truncate: a node never covers items past its own index.
+void ImGuiListClipperHeights::Resize(int items_count, float default_height)
+{
+    IM_ASSERT(items_count >= 0 && default_height > 0.0f);
+    if (DefaultHeight != default_height)
+    {
+        // Estimate changed: items not known yet need to be updated, rebuild the whole tree in O(N)
+        DefaultHeight = default_height;
+        const int old_count = ImMin(Heights.Size, items_count);
+        Heights.resize(old_count);
+        Tree.resize(old_count + 1);
+        Tree[0] = 0.0;
+        for (int i = 1; i <= old_count; i++)
+            Tree[i] = GetItemHeight(i - 1);
+        for (int i = 1; i <= old_count; i++)
+            if (i + (i & -i) <= old_count)
+                Tree[i + (i & -i)] += Tree[i];
+    }
+    if (items_count < Heights.Size)
+    {
+        Heights.resize(items_count);
+        Tree.resize(items_count + 1);
+        return;
+    }
+    if (Tree.Size == 0)
+        Tree.push_back(0.0);
+    Heights.reserve(items_count);
+    Tree.reserve(items_count + 1);
+    while (Heights.Size < items_count)
+    {
+        const int item_n = Heights.Size;
+        Heights.push_back(HeightCallback ? HeightCallback(item_n, HeightCallbackUserData) : -1.0f);
+        const int i = item_n + 1;
+        Tree.push_back(GetItemHeight(item_n) + GetItemOffset(item_n) - GetItemOffset(i - (i & -i)));
+    }
+}
+
+void ImGuiListClipperHeights::Clear()
+{
+    Heights.clear();
+    Tree.clear();
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < Heights.Size);
+    const double delta = (double)(height >= 0.0f ? height : DefaultHeight) - (double)GetItemHeight(item_n);
+    Heights[item_n] = height;
+    for (int i = item_n + 1; i <= Heights.Size; i += (i & -i))
+        Tree[i] += delta;
+}
+
+void ImGuiListClipperHeights::InvalidateItem(int item_n)
+{
+    SetItemHeight(item_n, HeightCallback ? HeightCallback(item_n, HeightCallbackUserData) : -1.0f);
+}
+
+double ImGuiListClipperHeights::GetItemOffset(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= Heights.Size);
+    double offset = 0.0;
+    for (int i = item_n; i > 0; i -= (i & -i))
+        offset += Tree[i];
+    return offset;
+}
+
+int ImGuiListClipperHeights::FindItemAtOffset(double offset) const
+{
+    // Descend the tree to find the number of items entirely above 'offset'
+    const int items_count = Heights.Size;
+    if (items_count == 0)
+        return 0;
+    int item_n = 0;
+    int step = 1;
+    while (step * 2 <= items_count)
+        step *= 2;
+    for (; step > 0; step >>= 1)
+        if (item_n + step <= items_count && Tree[item_n + step] <= offset)
+        {
+            item_n += step;
+            offset -= Tree[item_n];
+        }
+    return ImMin(item_n, items_count - 1);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -2971,12 +3664,34 @@ bool ImGuiListClipper::Step()
 ImGuiStyle& ImGui::GetStyle()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
+    GImGui->StyleColorsU32Valid = 0; // Caller may modify Colors[]
     return GImGui->Style;
 }
 
+// Packed colors are cached per ImGuiCol (for the current Style.Alpha) as most widgets request the same few colors many times per frame.
+// Style.Colors[] modified through a reference to the style obtained before the last GetColorU32() call will be picked up on next frame.
 ImU32 ImGui::GetColorU32(ImGuiCol idx, float alpha_mul)
 {
-    ImGuiStyle& style = GImGui->Style;
+    ImGuiContext& g = *GImGui;
+    ImGuiStyle& style = g.Style;
+    if (alpha_mul == 1.0f)
+    {
+        IM_STATIC_ASSERT(ImGuiCol_COUNT <= 64);
+        if (g.StyleColorsU32Alpha != style.Alpha)
+        {
+            g.StyleColorsU32Alpha = style.Alpha;
+            g.StyleColorsU32Valid = 0;
+        }
+        const ImU64 mask = (ImU64)1 << idx;
+        if ((g.StyleColorsU32Valid & mask) == 0)
+        {
+            ImVec4 c = style.Colors[idx];
+            c.w *= style.Alpha;
+            g.StyleColorsU32[idx] = ColorConvertFloat4ToU32(c);
+            g.StyleColorsU32Valid |= mask;
+        }
+        return g.StyleColorsU32[idx];
+    }
     ImVec4 c = style.Colors[idx];
     c.w *= style.Alpha * alpha_mul;
     return ColorConvertFloat4ToU32(c);
@@ -3015,6 +3730,7 @@ void ImGui::PushStyleColor(ImGuiCol idx, ImU32 col)
     backup.BackupValue = g.Style.Colors[idx];
     g.ColorStack.push_back(backup);
     g.Style.Colors[idx] = ColorConvertU32ToFloat4(col);
+    g.StyleColorsU32Valid &= ~((ImU64)1 << idx);
 }
 
 void ImGui::PushStyleColor(ImGuiCol idx, const ImVec4& col)
@@ -3025,6 +3741,7 @@ void ImGui::PushStyleColor(ImGuiCol idx, const ImVec4& col)
     backup.BackupValue = g.Style.Colors[idx];
     g.ColorStack.push_back(backup);
     g.Style.Colors[idx] = col;
+    g.StyleColorsU32Valid &= ~((ImU64)1 << idx);
 }
 
 void ImGui::PopStyleColor(int count)
@@ -3039,6 +3756,7 @@ void ImGui::PopStyleColor(int count)
     {
         ImGuiColorMod& backup = g.ColorStack.back();
         g.Style.Colors[backup.Col] = backup.BackupValue;
+        g.StyleColorsU32Valid &= ~((ImU64)1 << backup.Col);
         g.ColorStack.pop_back();
         count--;
     }
@@ -3466,7 +4184,7 @@ void ImGui::SetCurrentContext(ImGuiContext* ctx)
 #ifdef IMGUI_SET_CURRENT_CONTEXT_FUNC
     IMGUI_SET_CURRENT_CONTEXT_FUNC(ctx); // For custom thread-based hackery you may want to have control over this.
 #else
-    GImGui = ctx;
+    ImAtomicStorePtr((void* volatile*)&GImGui, ctx); // Read by MemAlloc()/MemFree() on worker threads
 #endif
 }
 
@@ -3534,6 +4252,9 @@ void ImGui::Initialize()
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
         ini_handler.ApplyAllFn = WindowSettingsHandler_ApplyAll;
         ini_handler.WriteAllFn = WindowSettingsHandler_WriteAll;
+        ini_handler.WriteDirtyFn = WindowSettingsHandler_WriteDirty;
+        ini_handler.ReadBinaryFn = WindowSettingsHandler_ReadBinary;
+        ini_handler.WriteBinaryFn = WindowSettingsHandler_WriteBinary;
         AddSettingsHandler(&ini_handler);
     }
     TableSettingsAddSettingsHandler();
@@ -3576,7 +4297,9 @@ void ImGui::Shutdown()
         return;
 
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
-    if (g.SettingsLoaded && g.IO.IniFilename != NULL)
+    if (g.SettingsLoaded && g.IO.IniBinaryFilename != NULL)
+        SaveBinarySettingsToDisk(g.IO.IniBinaryFilename);
+    else if (g.SettingsLoaded && g.IO.IniFilename != NULL)
         SaveIniSettingsToDisk(g.IO.IniFilename);
 
     CallContextHooks(&g, ImGuiContextHookType_Shutdown);
@@ -3619,6 +4342,8 @@ void ImGui::Shutdown()
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
+    g.SettingsWindowsDirty.clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -3632,6 +4357,11 @@ void ImGui::Shutdown()
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
+    g.DebugProfiler.Frames.clear_destruct();
+    g.DebugMetricsHistory.Series.clear_destruct();
+    g.InputRecorder.RecordData.clear();
+    g.InputRecorder.ReplayData.clear();
+    g.InputRecorder.SaveBuf.clear();
 
     g.Initialized = false;
 }
@@ -3763,22 +4493,138 @@ void ImGui::GcCompactTransientMiscBuffers()
     TableGcCompactSettings();
 }
 
+// Bytes held by a splitter's channels (each channel keeps its own command and index buffers)
+size_t ImGui::GcCalcDrawListSplitterSize(const ImDrawListSplitter* splitter)
+{
+    size_t size = (size_t)splitter->_Channels.Capacity * sizeof(ImDrawChannel);
+    for (int n = 0; n < splitter->_Channels.Size; n++)
+        size += (size_t)splitter->_Channels[n]._CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)splitter->_Channels[n]._IdxBuffer.Capacity * sizeof(ImDrawIdx) + (size_t)splitter->_Channels[n]._QuadBuffer.Capacity * sizeof(ImDrawQuad);
+    return size;
+}
+
+// Bytes that GcCompactTransientWindowBuffers() would free
+size_t ImGui::GcCalcTransientWindowBuffersSize(ImGuiWindow* window)
+{
+    if (window->MemoryCompacted)
+        return 0;
+    ImDrawList* draw_list = window->DrawList;
+    size_t size = 0;
+    size += (size_t)draw_list->CmdBuffer.Capacity * sizeof(ImDrawCmd);
+    size += (size_t)draw_list->IdxBuffer.Capacity * sizeof(ImDrawIdx);
+    size += (size_t)draw_list->VtxBuffer.Capacity * sizeof(ImDrawVert);
+    size += (size_t)draw_list->QuadBuffer.Capacity * sizeof(ImDrawQuad);
+    size += (size_t)draw_list->_ClipRectStack.Capacity * sizeof(ImVec4);
+    size += (size_t)draw_list->_TextureIdStack.Capacity * sizeof(ImTextureID);
+    size += (size_t)draw_list->_Path.Capacity * sizeof(ImVec2);
+    size += GcCalcDrawListSplitterSize(&draw_list->_Splitter);
+    size += (size_t)window->IDStack.Capacity * sizeof(ImGuiID);
+    size += (size_t)window->DC.ChildWindows.Capacity * sizeof(ImGuiWindow*);
+    size += (size_t)window->DC.ItemWidthStack.Capacity * sizeof(float);
+    size += (size_t)window->DC.TextWrapPosStack.Capacity * sizeof(float);
+    return size;
+}
+
 // Free up/compact internal window buffers, we can use this when a window becomes unused.
 // Not freed:
 // - ImGuiWindow, ImGuiWindowSettings, Name, StateStorage, ColumnsStorage (may hold useful data)
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
+    ImGuiContext& g = *GImGui;
+    g.GcReclaimedBytes += GcCalcTransientWindowBuffersSize(window);
+    g.GcReclaimedCount++;
     window->MemoryCompacted = true;
     window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
+    window->DrawListsAppended.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
 }
 
+// Enforce io.ConfigMemoryCompactBudget: measure transient buffers of windows, tables and text edit state,
+// then free buffers of the least recently active ones until we are back under budget.
+// Windows/tables which were active during the last frame are never evicted, as they would immediately grow back.
+void ImGui::GcCompactTransientBuffersToBudget(size_t budget)
+{
+    ImGuiContext& g = *GImGui;
+    enum { GcType_Window, GcType_Table, GcType_TableTempData, GcType_InputText };
+    struct Funcs
+    {
+        static int IMGUI_CDECL CompareByLastTimeActive(const void* lhs, const void* rhs)
+        {
+            const float a = ((const ImGuiGcCandidate*)lhs)->LastTimeActive, b = ((const ImGuiGcCandidate*)rhs)->LastTimeActive;
+            return (a < b) ? -1 : (a > b) ? +1 : 0;
+        }
+    };
+    ImVector<ImGuiGcCandidate>& candidates = g.GcCandidates;
+    candidates.resize(0);
+
+    // Measure everything, collect eviction candidates
+    size_t total_size = 0;
+    const int last_frame = g.FrameCount - 1;
+    for (int i = 0; i != g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        const size_t size = GcCalcTransientWindowBuffersSize(window);
+        total_size += size;
+        if (size > 0 && !window->WasActive)
+            candidates.push_back(ImGuiGcCandidate(window->LastTimeActive, GcType_Window, window, size));
+    }
+    for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
+    {
+        if (g.TablesLastTimeActive[i] < 0.0f)
+            continue;
+        ImGuiTable* table = g.Tables.GetByIndex(i);
+        const size_t size = TableGcCalcTransientBuffersSize(table);
+        total_size += size;
+        if (table->LastFrameActive < last_frame)
+            candidates.push_back(ImGuiGcCandidate(g.TablesLastTimeActive[i], GcType_Table, table, size));
+    }
+    for (int i = 0; i < g.TablesTempData.Size; i++)
+    {
+        ImGuiTableTempData* temp_data = &g.TablesTempData[i];
+        if (temp_data->LastTimeActive < 0.0f)
+            continue;
+        const size_t size = TableGcCalcTransientBuffersSize(temp_data);
+        total_size += size;
+        if (temp_data->LastFrameActive < last_frame)
+            candidates.push_back(ImGuiGcCandidate(temp_data->LastTimeActive, GcType_TableTempData, temp_data, size));
+    }
+    ImGuiInputTextState* input_state = &g.InputTextState;
+    const size_t input_size = (size_t)input_state->TextW.Capacity * sizeof(ImWchar) + (size_t)input_state->TextA.Capacity + (size_t)input_state->InitialTextA.Capacity;
+    total_size += input_size;
+    if (input_size > 0 && input_state->ID != g.ActiveId && input_state->ID != g.ActiveIdPreviousFrame)
+        candidates.push_back(ImGuiGcCandidate(-1.0f, GcType_InputText, input_state, input_size)); // No timestamp: evict first, it is rebuilt from user buffer on activation
+    g.GcTransientBytes = total_size;
+    if (total_size <= budget)
+        return;
+
+    // Evict least recently active first
+    if (candidates.Size > 1)
+        ImQsort(candidates.Data, (size_t)candidates.Size, sizeof(ImGuiGcCandidate), Funcs::CompareByLastTimeActive);
+    for (int n = 0; n < candidates.Size && total_size > budget; n++)
+    {
+        const ImGuiGcCandidate& candidate = candidates[n];
+        switch (candidate.Type)
+        {
+        case GcType_Window:         GcCompactTransientWindowBuffers((ImGuiWindow*)candidate.Ptr); break;
+        case GcType_Table:          TableGcCompactTransientBuffers((ImGuiTable*)candidate.Ptr); break;
+        case GcType_TableTempData:  TableGcCompactTransientBuffers((ImGuiTableTempData*)candidate.Ptr); break;
+        case GcType_InputText:
+            g.GcReclaimedBytes += candidate.Size;
+            g.GcReclaimedCount++;
+            input_state->ClearFreeMemory();
+            input_state->ID = 0; // Force InputText() to reinitialize from user buffer
+            break;
+        }
+        total_size -= candidate.Size;
+    }
+    g.GcTransientBytes = total_size;
+}
+
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
 {
     // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
@@ -4099,23 +4945,119 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+// Header prepended to every allocation so MemFree() can attribute the release to the right tag.
+// Its size is fixed to 16 bytes so pointers returned by MemAlloc() keep the alignment provided by the underlying allocator.
+struct ImGuiAllocHeader
+{
+    size_t          Size;
+    ImGuiAllocTag   Tag;
+};
+static const size_t IM_ALLOC_HEADER_SIZE = 16;
+IM_STATIC_ASSERT(sizeof(ImGuiAllocHeader) <= IM_ALLOC_HEADER_SIZE);
+
+static void AllocTagStatsOnAlloc(ImGuiAllocTagStats* stats, size_t size)
+{
+    stats->LiveCount++;
+    stats->LiveBytes += size;
+    stats->PeakBytes = ImMax(stats->PeakBytes, stats->LiveBytes);
+    stats->FrameAllocCount++;
+    stats->FrameAllocBytes += size;
+}
+
+static void AllocTagStatsOnFree(ImGuiAllocTagStats* stats, size_t size)
+{
+    stats->LiveCount--;
+    stats->LiveBytes -= size;
+}
+
+ImGuiAllocTagScope::ImGuiAllocTagScope(ImGuiAllocTag tag)
+{
+    IM_ASSERT(tag >= 0 && tag < ImGuiAllocTag_COUNT);
+    BackupTag = GImAllocTag;
+    GImAllocTag = tag;
+}
+
+ImGuiAllocTagScope::~ImGuiAllocTagScope()
+{
+    GImAllocTag = BackupTag;
+}
+
+static inline void AllocStatsLock()     { ImSpinLockAcquire(&GImAllocStatsLock); }
+static inline void AllocStatsUnlock()   { ImSpinLockRelease(&GImAllocStatsLock); }
+#endif
+
+// Called by NewFrame(): move per-frame counters into 'LastFrame' counters.
+static void UpdateAllocStatsNewFrame()
+{
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    AllocStatsLock();
+    ImGuiAllocStats* stats = &GImAllocStats;
+    for (int tag = 0; tag <= ImGuiAllocTag_COUNT; tag++)
+    {
+        ImGuiAllocTagStats* tag_stats = (tag < ImGuiAllocTag_COUNT) ? &stats->Tags[tag] : &stats->Total;
+        tag_stats->LastFrameAllocCount = tag_stats->FrameAllocCount;
+        tag_stats->LastFrameAllocBytes = tag_stats->FrameAllocBytes;
+        tag_stats->FrameAllocCount = 0;
+        tag_stats->FrameAllocBytes = 0;
+    }
+    stats->FrameCount++;
+    AllocStatsUnlock();
+#endif
+}
+
 // IM_ALLOC() == ImGui::MemAlloc()
+// Thread-safe as long as the underlying allocator is: it may be called while building ImDrawList on worker threads.
 void* ImGui::MemAlloc(size_t size)
 {
-    if (ImGuiContext* ctx = GImGui)
-        ctx->IO.MetricsActiveAllocations++;
+    if (ImGuiContext* ctx = (ImGuiContext*)ImAtomicLoadPtr((void* volatile*)&GImGui))
+    {
+        ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, +1);
+        if (ImAtomicLoad(&ctx->DebugMetricsHistory.Enabled)) // Only pay for the second atomic while the Metrics history is recording
+            ImAtomicAdd(&ctx->DebugMetricsHistory.FrameAllocCount, +1);
+    }
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    ImGuiAllocHeader* header = (ImGuiAllocHeader*)(*GImAllocatorAllocFunc)(size + IM_ALLOC_HEADER_SIZE, GImAllocatorUserData);
+    if (header == NULL)
+        return NULL;
+    header->Size = size;
+    header->Tag = GImAllocTag;
+    AllocStatsLock();
+    AllocTagStatsOnAlloc(&GImAllocStats.Tags[header->Tag], size);
+    AllocTagStatsOnAlloc(&GImAllocStats.Total, size);
+    AllocStatsUnlock();
+    return (char*)header + IM_ALLOC_HEADER_SIZE;
+#else
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
+#endif
 }
 
 // IM_FREE() == ImGui::MemFree()
 void ImGui::MemFree(void* ptr)
 {
     if (ptr)
-        if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
+        if (ImGuiContext* ctx = (ImGuiContext*)ImAtomicLoadPtr((void* volatile*)&GImGui))
+            ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, -1);
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+    if (ptr)
+    {
+        ImGuiAllocHeader* header = (ImGuiAllocHeader*)(void*)((char*)ptr - IM_ALLOC_HEADER_SIZE);
+        AllocStatsLock();
+        AllocTagStatsOnFree(&GImAllocStats.Tags[header->Tag], header->Size);
+        AllocTagStatsOnFree(&GImAllocStats.Total, header->Size);
+        AllocStatsUnlock();
+        ptr = header;
+    }
+#endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Counters may still be updated by other threads while you read them: only use for display/debugging.
+const ImGuiAllocStats* ImGui::GetAllocStats()
+{
+    return &GImAllocStats;
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -4177,6 +5119,7 @@ static ImDrawList* GetViewportDrawList(ImGuiViewportP* viewport, size_t drawlist
         draw_list->_ResetForNewFrame();
         draw_list->PushTextureID(g.IO.Fonts->TexID);
         draw_list->PushClipRect(viewport->Pos, viewport->Pos + viewport->Size, false);
+        viewport->DrawListsAppended[drawlist_no].resize(0);
         viewport->DrawListsLastFrame[drawlist_no] = g.FrameCount;
     }
     return draw_list;
@@ -4209,6 +5152,61 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+ImDrawListSharedData* ImGui::CreateDrawListSharedData()
+{
+    ImDrawListSharedData* shared_data = IM_NEW(ImDrawListSharedData)();
+    UpdateDrawListSharedData(shared_data);
+    return shared_data;
+}
+
+// Copy the per-frame settings and the lookup tables, but keep the copy's own scratch buffer and circle cache:
+// the cache only depends on segment count so it stays valid, and this avoids reallocating them every frame.
+void ImGui::UpdateDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    ImGuiContext& g = *GImGui;
+    const ImDrawListSharedData* src = &g.DrawListSharedData;
+    IM_ASSERT(shared_data != NULL && shared_data != src);
+    shared_data->TexUvWhitePixel = src->TexUvWhitePixel;
+    shared_data->Font = src->Font;
+    shared_data->FontSize = src->FontSize;
+    shared_data->CurveTessellationTol = src->CurveTessellationTol;
+    shared_data->ClipRectFullscreen = src->ClipRectFullscreen;
+    shared_data->InitialFlags = src->InitialFlags;
+    shared_data->TexUvLines = src->TexUvLines;
+    shared_data->SetCircleTessellationMaxError(src->CircleSegmentMaxError);
+}
+
+void ImGui::DestroyDrawListSharedData(ImDrawListSharedData* shared_data)
+{
+    IM_ASSERT(shared_data != &GImGui->DrawListSharedData);
+    IM_DELETE(shared_data);
+}
+
+// The draw list is referenced until the next frame, the caller is responsible for keeping it alive and untouched until rendering is done.
+void ImGui::AppendWindowDrawList(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(draw_list != NULL && draw_list != window->DrawList);
+    window->DrawListsAppended.push_back(draw_list);
+}
+
+void ImGui::AppendBackgroundDrawList(ImDrawList* draw_list)
+{
+    ImGuiViewportP* viewport = GImGui->Viewports[0];
+    IM_ASSERT(draw_list != NULL);
+    GetViewportDrawList(viewport, 0, "##Background"); // Ensure the draw list exists for this frame so Render() will output it, followed by appended ones
+    viewport->DrawListsAppended[0].push_back(draw_list);
+}
+
+void ImGui::AppendForegroundDrawList(ImDrawList* draw_list)
+{
+    ImGuiViewportP* viewport = GImGui->Viewports[0];
+    IM_ASSERT(draw_list != NULL);
+    GetViewportDrawList(viewport, 1, "##Foreground");
+    viewport->DrawListsAppended[1].push_back(draw_list);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -4409,6 +5407,11 @@ void ImGui::NewFrame()
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
 
+    // Record the previous frame into the Metrics history, then start a new profiler frame before timing NewFrame() itself
+    UpdateDebugMetricsHistory();
+    UpdateProfilerNewFrame();
+    IM_PROFILE_SCOPE("NewFrame");
+
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
     for (int n = g.Hooks.Size - 1; n >= 0; n--)
@@ -4417,6 +5420,12 @@ void ImGui::NewFrame()
 
     CallContextHooks(&g, ImGuiContextHookType_NewFramePre);
 
+    // Style may have been modified directly between frames
+    g.StyleColorsU32Valid = 0;
+
+    // Record or replay input events submitted since last frame (may override io.DeltaTime and io.DisplaySize)
+    UpdateInputRecording();
+
     // Check and assert for various common IO and Configuration mistakes
     ErrorCheckNewFrameSanityChecks();
 
@@ -4426,6 +5435,7 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    UpdateAllocStatsNewFrame();
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -4444,6 +5454,10 @@ void ImGui::NewFrame()
     // Update viewports (after processing input queue, so io.MouseHoveredViewport is set)
     UpdateViewportsNewFrame();
 
+    // Swap in font atlas variant requested with RequestBakedScale() when ready (the atlas may be shared with a context in the middle of a frame)
+    if (!g.IO.Fonts->Locked)
+        ImFontAtlasUpdateVariants(g.IO.Fonts);
+
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
@@ -4463,6 +5477,10 @@ void ImGui::NewFrame()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasQuadStream)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowQuadStream;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfText)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowSdfText;
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (int n = 0; n < g.Viewports.Size; n++)
@@ -4624,6 +5642,8 @@ void ImGui::NewFrame()
     for (int i = 0; i < g.TablesTempData.Size; i++)
         if (g.TablesTempData[i].LastTimeActive >= 0.0f && g.TablesTempData[i].LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&g.TablesTempData[i]);
+    if (g.IO.ConfigMemoryCompactBudget > 0)
+        GcCompactTransientBuffersToBudget((size_t)g.IO.ConfigMemoryCompactBudget);
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -4701,13 +5721,14 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
 {
     if (draw_list->CmdBuffer.Size == 0)
         return;
-    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
+    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].QuadCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
         return;
 
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc.
     // May trigger for you if you are using PrimXXX functions incorrectly.
     IM_ASSERT(draw_list->VtxBuffer.Size == 0 || draw_list->_VtxWritePtr == draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size);
     IM_ASSERT(draw_list->IdxBuffer.Size == 0 || draw_list->_IdxWritePtr == draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size);
+    IM_ASSERT(draw_list->QuadBuffer.Size == 0 || draw_list->_QuadWritePtr == draw_list->QuadBuffer.Data + draw_list->QuadBuffer.Size);
     if (!(draw_list->Flags & ImDrawListFlags_AllowVtxOffset))
         IM_ASSERT((int)draw_list->_VtxCurrentIdx == draw_list->VtxBuffer.Size);
 
@@ -4738,6 +5759,8 @@ static void AddWindowToDrawData(ImGuiWindow* window, int layer)
     ImGuiViewportP* viewport = g.Viewports[0];
     g.IO.MetricsRenderWindows++;
     AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[layer], window->DrawList);
+    for (int i = 0; i < window->DrawListsAppended.Size; i++)
+        AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[layer], window->DrawListsAppended[i]);
     for (int i = 0; i < window->DC.ChildWindows.Size; i++)
     {
         ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -4782,7 +5805,7 @@ static void SetupViewportDrawData(ImGuiViewportP* viewport, ImVector<ImDrawList*
     draw_data->Valid = true;
     draw_data->CmdLists = (draw_lists->Size > 0) ? draw_lists->Data : NULL;
     draw_data->CmdListsCount = draw_lists->Size;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->TotalQuadCount = 0;
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
@@ -4792,6 +5815,7 @@ static void SetupViewportDrawData(ImGuiViewportP* viewport, ImVector<ImDrawList*
         draw_list->_PopUnusedDrawCmd();
         draw_data->TotalVtxCount += draw_list->VtxBuffer.Size;
         draw_data->TotalIdxCount += draw_list->IdxBuffer.Size;
+        draw_data->TotalQuadCount += draw_list->QuadBuffer.Size;
     }
 }
 
@@ -4834,7 +5858,7 @@ static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32
         draw_list->PushClipRect(viewport_rect.Min - ImVec2(1, 1), viewport_rect.Max + ImVec2(1, 1), false); // Ensure ImDrawCmd are not merged
         draw_list->AddRectFilled(viewport_rect.Min, viewport_rect.Max, col);
         ImDrawCmd cmd = draw_list->CmdBuffer.back();
-        IM_ASSERT(cmd.ElemCount == 6);
+        IM_ASSERT(cmd.ElemCount == 6 || cmd.QuadCount == 1); // Single quad with ImDrawListFlags_AllowQuadStream. Commands use explicit QuadOffset, so reordering them is fine.
         draw_list->CmdBuffer.pop_back();
         draw_list->CmdBuffer.push_front(cmd);
         draw_list->PopClipRect();
@@ -4900,6 +5924,7 @@ static void ImGui::RenderDimmedBackgrounds()
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
+    IM_PROFILE_SCOPE("EndFrame");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -4998,6 +6023,7 @@ void ImGui::EndFrame()
 // it is the role of the ImGui_ImplXXXX_RenderDrawData() function provided by the renderer backend)
 void ImGui::Render()
 {
+    IM_PROFILE_SCOPE("Render");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(g.Initialized);
 
@@ -5015,7 +6041,11 @@ void ImGui::Render()
         ImGuiViewportP* viewport = g.Viewports[n];
         viewport->DrawDataBuilder.Clear();
         if (viewport->DrawLists[0] != NULL)
+        {
             AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[0], GetBackgroundDrawList(viewport));
+            for (int i = 0; i < viewport->DrawListsAppended[0].Size; i++)
+                AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[0], viewport->DrawListsAppended[0][i]);
+        }
     }
 
     // Draw modal/window whitening backgrounds
@@ -5050,7 +6080,11 @@ void ImGui::Render()
 
         // Add foreground ImDrawList (for each active viewport)
         if (viewport->DrawLists[1] != NULL)
+        {
             AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[0], GetForegroundDrawList(viewport));
+            for (int i = 0; i < viewport->DrawListsAppended[1].Size; i++)
+                AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[0], viewport->DrawListsAppended[1][i]);
+        }
 
         SetupViewportDrawData(viewport, &viewport->DrawDataBuilder.Layers[0]);
         ImDrawData* draw_data = &viewport->DrawDataP;
@@ -5499,6 +6533,7 @@ static void InitOrLoadWindowSettings(ImGuiWindow* window, ImGuiWindowSettings* s
 
 static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Windows);
     // Create window the first time
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
     ImGuiContext& g = *GImGui;
@@ -6132,6 +7167,8 @@ ImGuiWindow* ImGui::FindBlockingModal(ImGuiWindow* window)
 // - Passing 'bool* p_open' displays a Close button on the upper-right corner of the window, the pointed value will be set to false when the button is pressed.
 bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 {
+    IM_PROFILE_SCOPE("Begin");
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Windows);
     ImGuiContext& g = *GImGui;
     const ImGuiStyle& style = g.Style;
     IM_ASSERT(name != NULL && name[0] != '\0');     // Window name required
@@ -6614,7 +7651,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 // - We disable this when the parent window has zero vertices, which is a common pattern leading to laying out multiple overlapping childs
                 ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
                 bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
-                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0);
+                bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0 && parent_window->DrawList->QuadBuffer.Size == 0);
                 if (window->DrawList->CmdBuffer.back().ElemCount == 0 && !parent_is_empty && !previous_child_overlapping)
                     render_decorations_in_parent = true;
             }
@@ -6689,6 +7726,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.TreeDepth = 0;
         window->DC.TreeJumpToParentOnPopMask = 0x00;
         window->DC.ChildWindows.resize(0);
+        window->DrawListsAppended.resize(0);
         window->DC.StateStorage = &window->StateStorage;
         window->DC.CurrentColumns = NULL;
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -6819,6 +7857,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
 
 void ImGui::End()
 {
+    IM_PROFILE_SCOPE("End");
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = g.CurrentWindow;
 
@@ -9087,6 +10126,14 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     // Check: the io.ConfigWindowsResizeFromEdges option requires backend to honor mouse cursor changes and set the ImGuiBackendFlags_HasMouseCursors flag accordingly.
     if (g.IO.ConfigWindowsResizeFromEdges && !(g.IO.BackendFlags & ImGuiBackendFlags_HasMouseCursors))
         g.IO.ConfigWindowsResizeFromEdges = false;
+
+    // Check: fonts built with ImFontConfig::SignedDistanceField require the renderer backend to threshold ImDrawCmd::SdfText commands.
+    if (!(g.IO.BackendFlags & ImGuiBackendFlags_RendererHasSdfText))
+        for (int n = 0; n < g.IO.Fonts->Fonts.Size; n++)
+            IM_ASSERT(!g.IO.Fonts->Fonts[n]->SignedDistanceField && "Font atlas has signed distance field fonts but the renderer backend doesn't set ImGuiBackendFlags_RendererHasSdfText!");
+
+    // Check: font atlas variants need the renderer backend to upload their texture.
+    IM_ASSERT((g.IO.Fonts->Variants.Size == 0 || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasAtlasVariants)) && "Font atlas has scale variants (see RequestBakedScale()) but the renderer backend doesn't set ImGuiBackendFlags_RendererHasAtlasVariants!");
 }
 
 static void ImGui::ErrorCheckEndFrameSanityChecks()
@@ -12721,6 +13768,13 @@ void ImGui::LogButtons()
 // - LoadIniSettingsFromMemory()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
+// - SettingsIniWriteSection() [Internal]
+// - SettingsBinaryWriteRecord() [Internal]
+// - SettingsBinaryKillRecord() [Internal]
+// - LoadBinarySettingsFromDisk()
+// - LoadBinarySettingsFromMemory()
+// - SaveBinarySettingsToDisk()
+// - SaveBinarySettingsToMemory()
 //-----------------------------------------------------------------------------
 // - CreateNewWindowSettings() [Internal]
 // - FindWindowSettingsByID() [Internal]
@@ -12737,7 +13791,11 @@ void ImGui::UpdateSettings()
     if (!g.SettingsLoaded)
     {
         IM_ASSERT(g.SettingsWindows.empty());
-        if (g.IO.IniFilename)
+        // Fallback to .ini file when binary file is missing (e.g. first run after enabling io.IniBinaryFilename)
+        bool loaded = false;
+        if (g.IO.IniBinaryFilename)
+            loaded = LoadBinarySettingsFromDisk(g.IO.IniBinaryFilename);
+        if (!loaded && g.IO.IniFilename)
             LoadIniSettingsFromDisk(g.IO.IniFilename);
         g.SettingsLoaded = true;
     }
@@ -12748,7 +13806,9 @@ void ImGui::UpdateSettings()
         g.SettingsDirtyTimer -= g.IO.DeltaTime;
         if (g.SettingsDirtyTimer <= 0.0f)
         {
-            if (g.IO.IniFilename != NULL)
+            if (g.IO.IniBinaryFilename != NULL)
+                SaveBinarySettingsToDisk(g.IO.IniBinaryFilename);
+            else if (g.IO.IniFilename != NULL)
                 SaveIniSettingsToDisk(g.IO.IniFilename);
             else
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
@@ -12783,7 +13843,10 @@ void ImGui::RemoveSettingsHandler(const char* type_name)
 {
     ImGuiContext& g = *GImGui;
     if (ImGuiSettingsHandler* handler = FindSettingsHandler(type_name))
+    {
         g.SettingsHandlers.erase(handler);
+        g.SettingsIniRebuild = true;
+    }
 }
 
 ImGuiSettingsHandler* ImGui::FindSettingsHandler(const char* type_name)
@@ -12801,6 +13864,8 @@ void ImGui::ClearIniSettings()
 {
     ImGuiContext& g = *GImGui;
     g.SettingsIniData.clear();
+    g.SettingsIniRebuild = true;
+    g.SettingsBinaryData.clear(); // Next save will rewrite all records
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
         if (g.SettingsHandlers[handler_n].ClearAllFn)
             g.SettingsHandlers[handler_n].ClearAllFn(&g, &g.SettingsHandlers[handler_n]);
@@ -12817,31 +13882,10 @@ void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
     IM_FREE(file_data);
 }
 
-// Zero-tolerance, no error reporting, cheap .ini parsing
-// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
-void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+// Parse "[Type][Name]" entries and let their handler parse the following lines. Writes zero-terminators within 'buf'.
+static void LoadIniSettingsEntries(char* buf, char* buf_end)
 {
     ImGuiContext& g = *GImGui;
-    IM_ASSERT(g.Initialized);
-    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
-    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
-
-    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
-    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
-    if (ini_size == 0)
-        ini_size = strlen(ini_data);
-    g.SettingsIniData.Buf.resize((int)ini_size + 1);
-    char* const buf = g.SettingsIniData.Buf.Data;
-    char* const buf_end = buf + ini_size;
-    memcpy(buf, ini_data, ini_size);
-    buf_end[0] = 0;
-
-    // Call pre-read handlers
-    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
-    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
-        if (g.SettingsHandlers[handler_n].ReadInitFn)
-            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
-
     void* entry_data = NULL;
     ImGuiSettingsHandler* entry_handler = NULL;
 
@@ -12869,7 +13913,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
                 continue;
             *type_end = 0; // Overwrite first ']'
             name_start++;  // Skip second '['
-            entry_handler = FindSettingsHandler(type_start);
+            entry_handler = ImGui::FindSettingsHandler(type_start);
             entry_data = entry_handler ? entry_handler->ReadOpenFn(&g, entry_handler, name_start) : NULL;
         }
         else if (entry_handler != NULL && entry_data != NULL)
@@ -12878,6 +13922,36 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
             entry_handler->ReadLineFn(&g, entry_handler, entry_data, line);
         }
     }
+}
+
+// Zero-tolerance, no error reporting, cheap .ini parsing
+// Set ini_size==0 to let us use strlen(ini_data). Do not call this function with a 0 if your buffer is actually empty!
+void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Settings);
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    //IM_ASSERT(!g.WithinFrameScope && "Cannot be called between NewFrame() and EndFrame()");
+    //IM_ASSERT(g.SettingsLoaded == false && g.FrameCount == 0);
+
+    // For user convenience, we allow passing a non zero-terminated string (hence the ini_size parameter).
+    // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
+    if (ini_size == 0)
+        ini_size = strlen(ini_data);
+    g.SettingsIniData.Buf.resize((int)ini_size + 1);
+    g.SettingsIniRebuild = true;
+    char* const buf = g.SettingsIniData.Buf.Data;
+    char* const buf_end = buf + ini_size;
+    memcpy(buf, ini_data, ini_size);
+    buf_end[0] = 0;
+
+    // Call pre-read handlers
+    // Some types will clear their data (e.g. dock information) some types will allow merge/override (window)
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ReadInitFn)
+            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
+
+    LoadIniSettingsEntries(buf, buf_end);
     g.SettingsLoaded = true;
 
     // [DEBUG] Restore untouched copy so it can be browsed in Metrics (not strictly necessary)
@@ -12898,6 +13972,11 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
+    if (g.IO.WriteIniFileFn != NULL)
+    {
+        g.IO.WriteIniFileFn(g.IO.WriteIniFileUserData, ini_filename, ini_data, ini_data_size);
+        return;
+    }
     ImFileHandle f = ImFileOpen(ini_filename, "wt");
     if (!f)
         return;
@@ -12905,110 +13984,508 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
     ImFileClose(f);
 }
 
-// Call registered handlers (e.g. SettingsHandlerWindow_WriteAll() + custom handlers) to write their stuff into a text buffer
+// Call registered handlers (e.g. WindowSettingsHandler_WriteDirty() + custom handlers) to update their sections of the text buffer.
+// Only entries modified since the last call are reformatted, unless sections were lost (e.g. after loading) or too many were removed.
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Settings);
     ImGuiContext& g = *GImGui;
     g.SettingsDirtyTimer = 0.0f;
-    g.SettingsIniData.Buf.resize(0);
-    g.SettingsIniData.Buf.push_back(0);
+    if (g.SettingsIniRebuild || g.SettingsIniDeadSections > g.SettingsIniSections.Size / 2)
+    {
+        g.SettingsIniData.Buf.resize(0);
+        g.SettingsIniData.Buf.push_back(0);
+        g.SettingsIniSections.resize(0);
+        g.SettingsIniDeadSections = 0;
+        g.SettingsIniRebuild = true; // Ignore sections held by entries
+    }
+
+    ImGuiTextBuffer buf;
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
     {
         ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
-        handler->WriteAllFn(&g, handler, &g.SettingsIniData);
+        if (handler->WriteDirtyFn)
+        {
+            handler->WriteDirtyFn(&g, handler);
+            continue;
+        }
+
+        // Handlers without dirty tracking are rewritten as a single section
+        buf.Buf.resize(0);
+        handler->WriteAllFn(&g, handler, &buf);
+        SettingsIniWriteSection(&handler->IniSection, buf.c_str(), buf.size());
     }
+    g.SettingsIniRebuild = false;
+
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
 }
 
-ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
+// Called by ImGuiSettingsHandler::WriteDirtyFn for each modified entry, with the full text of its section ("[Type][Name]" header included).
+// Pass text_len == 0 to remove the section. '*p_section' should be 0 for a new entry.
+void ImGui::SettingsIniWriteSection(int* p_section, const char* text, int text_len)
 {
     ImGuiContext& g = *GImGui;
+    ImVector<char>& buf = g.SettingsIniData.Buf;
+    IM_ASSERT(buf.Size > 0 && "Must be called from SaveIniSettingsToMemory()");
+    if (*p_section == 0 || g.SettingsIniRebuild)
+    {
+        // Append new section
+        *p_section = 0;
+        if (text_len == 0)
+            return;
+        ImGuiSettingsIniSection section;
+        section.Offset = g.SettingsIniData.size();
+        section.Size = text_len;
+        g.SettingsIniData.append(text, text + text_len);
+        g.SettingsIniSections.push_back(section);
+        *p_section = g.SettingsIniSections.Size;
+        return;
+    }
 
-#if !IMGUI_DEBUG_INI_SETTINGS
-    // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
-    // Preserve the full string when IMGUI_DEBUG_INI_SETTINGS is set to make .ini inspection easier.
-    if (const char* p = strstr(name, "###"))
-        name = p;
-#endif
-    const size_t name_len = strlen(name);
-
-    // Allocate chunk
-    const size_t chunk_size = sizeof(ImGuiWindowSettings) + name_len + 1;
-    ImGuiWindowSettings* settings = g.SettingsWindows.alloc_chunk(chunk_size);
-    IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
-    settings->ID = ImHashStr(name, name_len);
-    memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
-
-    return settings;
+    // Resize section in place, shifting the following ones
+    IM_ASSERT(*p_section <= g.SettingsIniSections.Size);
+    ImGuiSettingsIniSection* section = &g.SettingsIniSections[*p_section - 1];
+    const int size_delta = text_len - section->Size;
+    if (size_delta != 0)
+    {
+        const int tail_offset = section->Offset + section->Size;
+        const int old_size = buf.Size; // Includes zero-terminator
+        if (size_delta > 0)
+            buf.resize(old_size + size_delta);
+        memmove(buf.Data + tail_offset + size_delta, buf.Data + tail_offset, (size_t)(old_size - tail_offset));
+        if (size_delta < 0)
+            buf.resize(old_size + size_delta);
+        for (int section_n = *p_section; section_n < g.SettingsIniSections.Size; section_n++)
+            g.SettingsIniSections[section_n].Offset += size_delta;
+        section->Size = text_len;
+    }
+    memcpy(buf.Data + section->Offset, text, (size_t)text_len);
+    if (text_len == 0)
+    {
+        g.SettingsIniDeadSections++;
+        *p_section = 0;
+    }
 }
 
-// We don't provide a FindWindowSettingsByName() because Docking system doesn't always hold on names.
-// This is called once per window .ini entry + once per newly instantiated window.
-ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiID id)
+static int SettingsBinaryCalcRecordSize(int data_size)
 {
-    ImGuiContext& g = *GImGui;
-    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
-        if (settings->ID == id && !settings->WantDelete)
-            return settings;
-    return NULL;
+    return (int)sizeof(ImGuiSettingsBinaryRecord) + ((data_size + 3) & ~3);
 }
 
-// This is faster if you are holding on a Window already as we don't need to perform a search.
-ImGuiWindowSettings* ImGui::FindWindowSettingsByWindow(ImGuiWindow* window)
+// Return the live record at 'record_offset' if it matches type_hash/id
+// (offsets held by settings entries may be stale, e.g. after ClearIniSettings() or after loading another binary file)
+static ImGuiSettingsBinaryRecord* SettingsBinaryFindRecord(ImGuiID type_hash, ImGuiID id, int record_offset)
 {
     ImGuiContext& g = *GImGui;
-    if (window->SettingsOffset != -1)
-        return g.SettingsWindows.ptr_from_offset(window->SettingsOffset);
-    return FindWindowSettingsByID(window->ID);
+    if (record_offset < (int)sizeof(ImGuiSettingsBinaryHeader) || (record_offset & 3) != 0 || record_offset + (int)sizeof(ImGuiSettingsBinaryRecord) > g.SettingsBinaryData.Size)
+        return NULL;
+    ImGuiSettingsBinaryRecord* record = (ImGuiSettingsBinaryRecord*)(void*)(g.SettingsBinaryData.Data + record_offset);
+    if (record->TypeHash != type_hash || record->ID != id || record->Size > (ImU32)(g.SettingsBinaryData.Size - record_offset))
+        return NULL;
+    if (record_offset + SettingsBinaryCalcRecordSize((int)record->Size) > g.SettingsBinaryData.Size)
+        return NULL;
+    return record;
 }
 
-// This will revert window to its initial state, including enabling the ImGuiCond_FirstUseEver/ImGuiCond_Once conditions once more.
-void ImGui::ClearWindowSettings(const char* name)
+// Called by ImGuiSettingsHandler::WriteBinaryFn for each entry.
+// Patch the record in place if its size didn't change, otherwise kill it and append a new record. '*p_record_offset' should be 0 for a new entry.
+void ImGui::SettingsBinaryWriteRecord(ImGuiID type_hash, ImGuiID id, int* p_record_offset, const void* data, int data_size)
 {
-    //IMGUI_DEBUG_LOG("ClearWindowSettings('%s')\n", name);
-    ImGuiWindow* window = FindWindowByName(name);
-    if (window != NULL)
-    {
-        window->Flags |= ImGuiWindowFlags_NoSavedSettings;
-        InitOrLoadWindowSettings(window, NULL);
-    }
-    if (ImGuiWindowSettings* settings = window ? FindWindowSettingsByWindow(window) : FindWindowSettingsByID(ImHashStr(name)))
-        settings->WantDelete = true;
-}
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(type_hash != 0 && data_size >= 0);
+    IM_ASSERT(g.SettingsBinaryData.Size >= (int)sizeof(ImGuiSettingsBinaryHeader) && "Must be called from SaveBinarySettingsToMemory()");
+    if (!g.SettingsBinaryRebuild)
+        if (ImGuiSettingsBinaryRecord* record = SettingsBinaryFindRecord(type_hash, id, *p_record_offset))
+        {
+            if (record->Size == (ImU32)data_size)
+            {
+                if (memcmp(record + 1, data, (size_t)data_size) != 0)
+                {
+                    memcpy(record + 1, data, (size_t)data_size);
+                    if (*p_record_offset < g.SettingsBinaryDiskSize)
+                        g.SettingsBinaryDirty.push_back(*p_record_offset);
+                }
+                return;
+            }
+            SettingsBinaryKillRecord(type_hash, id, p_record_offset);
+        }
 
-static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
-{
-    ImGuiContext& g = *ctx;
-    for (int i = 0; i != g.Windows.Size; i++)
-        g.Windows[i]->SettingsOffset = -1;
-    g.SettingsWindows.clear();
+    const int record_offset = g.SettingsBinaryData.Size;
+    const int record_size = SettingsBinaryCalcRecordSize(data_size);
+    g.SettingsBinaryData.resize(record_offset + record_size);
+    ImGuiSettingsBinaryRecord* record = (ImGuiSettingsBinaryRecord*)(void*)(g.SettingsBinaryData.Data + record_offset);
+    record->TypeHash = type_hash;
+    record->ID = id;
+    record->Size = (ImU32)data_size;
+    memcpy(record + 1, data, (size_t)data_size);
+    memset((char*)(record + 1) + data_size, 0, (size_t)(record_size - (int)sizeof(ImGuiSettingsBinaryRecord) - data_size));
+    *p_record_offset = record_offset;
 }
 
-static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+// Called when an entry is deleted or won't be written anymore. Clear '*p_record_offset'.
+void ImGui::SettingsBinaryKillRecord(ImGuiID type_hash, ImGuiID id, int* p_record_offset)
 {
-    ImGuiID id = ImHashStr(name);
-    ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByID(id);
-    if (settings)
-        *settings = ImGuiWindowSettings(); // Clear existing if recycling previous entry
-    else
-        settings = ImGui::CreateNewWindowSettings(name);
-    settings->ID = id;
-    settings->WantApply = true;
-    return (void*)settings;
+    ImGuiContext& g = *GImGui;
+    if (!g.SettingsBinaryRebuild)
+        if (ImGuiSettingsBinaryRecord* record = SettingsBinaryFindRecord(type_hash, id, *p_record_offset))
+        {
+            record->TypeHash = 0;
+            g.SettingsBinaryDeadSize += SettingsBinaryCalcRecordSize((int)record->Size);
+            if (*p_record_offset < g.SettingsBinaryDiskSize)
+                g.SettingsBinaryDirty.push_back(*p_record_offset);
+        }
+    *p_record_offset = 0;
 }
 
-static void WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
+// Dispatch records of g.SettingsBinaryData to their handlers. Records are read in place, no parsing involved.
+static bool LoadBinarySettingsData()
 {
-    ImGuiWindowSettings* settings = (ImGuiWindowSettings*)entry;
-    int x, y;
-    int i;
-    if (sscanf(line, "Pos=%i,%i", &x, &y) == 2)         { settings->Pos = ImVec2ih((short)x, (short)y); }
-    else if (sscanf(line, "Size=%i,%i", &x, &y) == 2)   { settings->Size = ImVec2ih((short)x, (short)y); }
-    else if (sscanf(line, "Collapsed=%d", &i) == 1)     { settings->Collapsed = (i != 0); }
-}
-
+    ImGuiContext& g = *GImGui;
+    const int header_size = (int)sizeof(ImGuiSettingsBinaryHeader);
+    ImGuiSettingsBinaryHeader header;
+    if (g.SettingsBinaryData.Size >= header_size)
+        memcpy(&header, g.SettingsBinaryData.Data, (size_t)header_size);
+    if (g.SettingsBinaryData.Size < header_size || memcmp(header.Magic, "IMGB", 4) != 0 || header.Version != IMGUI_SETTINGS_BINARY_VERSION)
+    {
+        g.SettingsBinaryData.clear();
+        g.SettingsBinaryDiskSize = -1;
+        return false;
+    }
+    g.SettingsBinaryDirty.resize(0);
+    g.SettingsBinaryDeadSize = 0;
+    g.SettingsIniRebuild = true;
+
+    // Call pre-read handlers
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ReadInitFn)
+            g.SettingsHandlers[handler_n].ReadInitFn(&g, &g.SettingsHandlers[handler_n]);
+
+    ImVector<char> text_buf;
+    int record_offset = header_size;
+    while (record_offset + (int)sizeof(ImGuiSettingsBinaryRecord) <= g.SettingsBinaryData.Size)
+    {
+        ImGuiSettingsBinaryRecord* record = (ImGuiSettingsBinaryRecord*)(void*)(g.SettingsBinaryData.Data + record_offset);
+        if (record->Size > (ImU32)(g.SettingsBinaryData.Size - record_offset))
+            break;
+        const int record_size = SettingsBinaryCalcRecordSize((int)record->Size);
+        if (record_offset + record_size > g.SettingsBinaryData.Size)
+            break;
+        if (record->TypeHash == 0)
+        {
+            g.SettingsBinaryDeadSize += record_size;
+        }
+        else
+        {
+            // Records of unknown types are left untouched
+            ImGuiSettingsHandler* handler = NULL;
+            for (int handler_n = 0; handler_n < g.SettingsHandlers.Size && handler == NULL; handler_n++)
+                if (g.SettingsHandlers[handler_n].TypeHash == record->TypeHash)
+                    handler = &g.SettingsHandlers[handler_n];
+            if (handler && handler->ReadBinaryFn)
+            {
+                handler->ReadBinaryFn(&g, handler, record_offset, record->ID, record + 1, (int)record->Size);
+            }
+            else if (handler && handler->ReadOpenFn && handler->ReadLineFn)
+            {
+                // Text record written by a handler without binary support
+                handler->BinaryOffset = record_offset;
+                text_buf.resize((int)record->Size + 1);
+                memcpy(text_buf.Data, record + 1, record->Size);
+                text_buf.Data[record->Size] = 0;
+                LoadIniSettingsEntries(text_buf.Data, text_buf.Data + record->Size);
+            }
+        }
+        record_offset += record_size;
+    }
+
+    // Drop truncated data so we can keep appending after the last valid record (the file will be rewritten)
+    if (record_offset < g.SettingsBinaryData.Size)
+    {
+        g.SettingsBinaryData.resize(record_offset);
+        g.SettingsBinaryDiskSize = -1;
+    }
+    g.SettingsLoaded = true;
+
+    // Call post-read handlers
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+        if (g.SettingsHandlers[handler_n].ApplyAllFn)
+            g.SettingsHandlers[handler_n].ApplyAllFn(&g, &g.SettingsHandlers[handler_n]);
+    return true;
+}
+
+bool ImGui::LoadBinarySettingsFromDisk(const char* filename)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Settings);
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    ImFileHandle f = ImFileOpen(filename, "rb");
+    if (!f)
+        return false;
+
+    // Read straight into our in-memory copy, which we keep around to patch the file on save
+    const ImU64 file_size = ImFileGetSize(f);
+    bool ok = (file_size != (ImU64)-1 && file_size < 0x7FFFFFFF);
+    if (ok)
+    {
+        g.SettingsBinaryData.resize((int)file_size);
+        ok = (ImFileRead(g.SettingsBinaryData.Data, 1, file_size, f) == file_size);
+    }
+    ImFileClose(f);
+    if (!ok)
+    {
+        g.SettingsBinaryData.clear();
+        g.SettingsBinaryDiskSize = -1;
+        return false;
+    }
+    g.SettingsBinaryDiskSize = (int)file_size;
+    return LoadBinarySettingsData();
+}
+
+bool ImGui::LoadBinarySettingsFromMemory(const void* data, size_t data_size)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Settings);
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    if (data_size >= 0x7FFFFFFF)
+        return false;
+    g.SettingsBinaryData.resize((int)data_size);
+    if (data_size > 0)
+        memcpy(g.SettingsBinaryData.Data, data, data_size);
+    g.SettingsBinaryDiskSize = -1;
+    return LoadBinarySettingsData();
+}
+
+static int IMGUI_CDECL SettingsBinaryDirtyComparer(const void* lhs, const void* rhs)
+{
+    return *(const int*)lhs - *(const int*)rhs;
+}
+
+void ImGui::SaveBinarySettingsToDisk(const char* filename)
+{
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+    if (!filename)
+        return;
+
+    size_t data_size = 0;
+    const char* data = (const char*)SaveBinarySettingsToMemory(&data_size);
+    const int disk_size = g.SettingsBinaryDiskSize;
+    g.SettingsBinaryDiskSize = -1;
+
+#ifndef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+    // Patch modified records and append new ones, if the file is still the one we last loaded/saved
+    if (disk_size > 0)
+        if (ImFileHandle f = ImFileOpen(filename, "r+b"))
+        {
+            bool ok = (ImFileGetSize(f) == (ImU64)disk_size);
+            ImVector<int>& dirty = g.SettingsBinaryDirty;
+            if (ok && dirty.Size > 1)
+                ImQsort(dirty.Data, (size_t)dirty.Size, sizeof(int), SettingsBinaryDirtyComparer);
+            for (int n = 0; ok && n < dirty.Size; n++)
+            {
+                if (n > 0 && dirty[n] == dirty[n - 1])
+                    continue;
+                const ImGuiSettingsBinaryRecord* record = (const ImGuiSettingsBinaryRecord*)(const void*)(data + dirty[n]);
+                const ImU64 record_size = (ImU64)SettingsBinaryCalcRecordSize((int)record->Size);
+                ok = ImFileSeek(f, (ImU64)dirty[n]) && ImFileWrite(record, 1, record_size, f) == record_size;
+            }
+            if (ok && (size_t)disk_size < data_size)
+                ok = ImFileSeek(f, (ImU64)disk_size) && ImFileWrite(data + disk_size, 1, data_size - disk_size, f) == data_size - disk_size;
+            ok &= ImFileClose(f);
+            if (ok)
+            {
+                g.SettingsBinaryDiskSize = (int)data_size;
+                g.SettingsBinaryDirty.resize(0);
+                return;
+            }
+        }
+#else
+    IM_UNUSED(disk_size);
+#endif
+
+    // Full rewrite
+    g.SettingsBinaryDirty.resize(0);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return;
+    bool ok = (ImFileWrite(data, 1, data_size, f) == data_size);
+    ok &= ImFileClose(f);
+    if (ok)
+        g.SettingsBinaryDiskSize = (int)data_size;
+}
+
+// Call registered handlers (e.g. WindowSettingsHandler_WriteBinary() + custom handlers) to update their records in g.SettingsBinaryData
+const void* ImGui::SaveBinarySettingsToMemory(size_t* out_size)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Settings);
+    ImGuiContext& g = *GImGui;
+    g.SettingsDirtyTimer = 0.0f;
+
+    // Start from an empty image when there is none yet, or to compact it when killed records use more space than live ones
+    const int header_size = (int)sizeof(ImGuiSettingsBinaryHeader);
+    if (g.SettingsBinaryData.Size < header_size || g.SettingsBinaryDeadSize > (g.SettingsBinaryData.Size - header_size) / 2)
+    {
+        ImGuiSettingsBinaryHeader header;
+        memcpy(header.Magic, "IMGB", 4);
+        header.Version = IMGUI_SETTINGS_BINARY_VERSION;
+        g.SettingsBinaryData.resize(header_size);
+        memcpy(g.SettingsBinaryData.Data, &header, (size_t)header_size);
+        g.SettingsBinaryDirty.resize(0);
+        g.SettingsBinaryDiskSize = -1;
+        g.SettingsBinaryDeadSize = 0;
+        g.SettingsBinaryRebuild = true; // Ignore offsets held by entries
+    }
+
+    ImGuiTextBuffer buf;
+    for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
+    {
+        ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
+        if (handler->WriteBinaryFn)
+        {
+            handler->WriteBinaryFn(&g, handler);
+            continue;
+        }
+
+        // Handlers without binary support get their .ini output stored in a single text record
+        buf.Buf.resize(0);
+        handler->WriteAllFn(&g, handler, &buf);
+        if (buf.empty())
+            SettingsBinaryKillRecord(handler->TypeHash, 0, &handler->BinaryOffset);
+        else
+            SettingsBinaryWriteRecord(handler->TypeHash, 0, &handler->BinaryOffset, buf.c_str(), buf.size());
+    }
+    g.SettingsBinaryRebuild = false;
+
+    // Saving to memory repeatedly without writing to disk: give up on patching rather than growing the list
+    if (g.SettingsBinaryDirty.Size > g.SettingsBinaryData.Size / (int)sizeof(ImGuiSettingsBinaryRecord))
+    {
+        g.SettingsBinaryDirty.resize(0);
+        g.SettingsBinaryDiskSize = -1;
+    }
+
+    if (out_size)
+        *out_size = (size_t)g.SettingsBinaryData.Size;
+    return g.SettingsBinaryData.Data;
+}
+
+ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Settings);
+    ImGuiContext& g = *GImGui;
+
+#if !IMGUI_DEBUG_INI_SETTINGS
+    // Skip to the "###" marker if any. We don't skip past to match the behavior of GetID()
+    // Preserve the full string when IMGUI_DEBUG_INI_SETTINGS is set to make .ini inspection easier.
+    if (const char* p = strstr(name, "###"))
+        name = p;
+#endif
+    const size_t name_len = strlen(name);
+
+    // Allocate chunk
+    const size_t chunk_size = sizeof(ImGuiWindowSettings) + name_len + 1;
+    ImGuiWindowSettings* settings = g.SettingsWindows.alloc_chunk(chunk_size);
+    IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
+    settings->ID = ImHashStr(name, name_len);
+    memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
+    if (g.SettingsWindowsById.GetInt(settings->ID) == 0)
+        g.SettingsWindowsById.SetInt(settings->ID, g.SettingsWindows.offset_from_ptr(settings) + 1);
+    MarkWindowSettingsDirty(settings);
+
+    return settings;
+}
+
+// We don't provide a FindWindowSettingsByName() because Docking system doesn't always hold on names.
+// This is called once per window .ini entry + once per newly instantiated window.
+ImGuiWindowSettings* ImGui::FindWindowSettingsByID(ImGuiID id)
+{
+    // Start from the first entry created for this ID, following ones may exist if it was deleted
+    ImGuiContext& g = *GImGui;
+    const int offset = g.SettingsWindowsById.GetInt(id) - 1;
+    if (offset < 0)
+        return NULL;
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(offset); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+        if (settings->ID == id && !settings->WantDelete)
+            return settings;
+    return NULL;
+}
+
+// This is faster if you are holding on a Window already as we don't need to perform a search.
+ImGuiWindowSettings* ImGui::FindWindowSettingsByWindow(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (window->SettingsOffset != -1)
+        return g.SettingsWindows.ptr_from_offset(window->SettingsOffset);
+    return FindWindowSettingsByID(window->ID);
+}
+
+// This will revert window to its initial state, including enabling the ImGuiCond_FirstUseEver/ImGuiCond_Once conditions once more.
+void ImGui::ClearWindowSettings(const char* name)
+{
+    //IMGUI_DEBUG_LOG("ClearWindowSettings('%s')\n", name);
+    ImGuiWindow* window = FindWindowByName(name);
+    if (window != NULL)
+    {
+        window->Flags |= ImGuiWindowFlags_NoSavedSettings;
+        InitOrLoadWindowSettings(window, NULL);
+    }
+    if (ImGuiWindowSettings* settings = window ? FindWindowSettingsByWindow(window) : FindWindowSettingsByID(ImHashStr(name)))
+    {
+        settings->WantDelete = true;
+        MarkWindowSettingsDirty(settings);
+    }
+}
+
+// Queue entry for SaveIniSettingsToMemory()
+void ImGui::MarkWindowSettingsDirty(ImGuiWindowSettings* settings)
+{
+    ImGuiContext& g = *GImGui;
+    if (settings->WantSave)
+        return;
+    settings->WantSave = true;
+    g.SettingsWindowsDirty.push_back(g.SettingsWindows.offset_from_ptr(settings));
+}
+
+static void WindowSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
+{
+    ImGuiContext& g = *ctx;
+    for (int i = 0; i != g.Windows.Size; i++)
+        g.Windows[i]->SettingsOffset = -1;
+    g.SettingsWindows.clear();
+    g.SettingsWindowsById.Clear();
+    g.SettingsWindowsDirty.clear();
+}
+
+static void* WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    ImGuiID id = ImHashStr(name);
+    ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByID(id);
+    if (settings)
+    {
+        const int binary_offset = settings->BinaryOffset;
+        *settings = ImGuiWindowSettings(); // Clear existing if recycling previous entry
+        settings->BinaryOffset = binary_offset;
+    }
+    else
+    {
+        settings = ImGui::CreateNewWindowSettings(name);
+    }
+    settings->ID = id;
+    settings->WantApply = true;
+    return (void*)settings;
+}
+
+static void WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
+{
+    ImGuiWindowSettings* settings = (ImGuiWindowSettings*)entry;
+    int x, y;
+    int i;
+    if (sscanf(line, "Pos=%i,%i", &x, &y) == 2)         { settings->Pos = ImVec2ih((short)x, (short)y); }
+    else if (sscanf(line, "Size=%i,%i", &x, &y) == 2)   { settings->Size = ImVec2ih((short)x, (short)y); }
+    else if (sscanf(line, "Collapsed=%d", &i) == 1)     { settings->Collapsed = (i != 0); }
+}
+
 // Apply to existing windows (if any)
 static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandler*)
 {
@@ -13022,10 +14499,10 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
-static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+// Gather data from windows that were active during this session
+// (if a window wasn't opened in this session we preserve its settings)
+static void WindowSettingsHandler_GatherAll(ImGuiContext* ctx)
 {
-    // Gather data from windows that were active during this session
-    // (if a window wasn't opened in this session we preserve its settings)
     ImGuiContext& g = *ctx;
     for (int i = 0; i != g.Windows.Size; i++)
     {
@@ -13040,25 +14517,112 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
-
+        const ImVec2ih pos(window->Pos);
+        const ImVec2ih size(window->SizeFull);
+        if (settings->Pos.x == pos.x && settings->Pos.y == pos.y && settings->Size.x == size.x && settings->Size.y == size.y && settings->Collapsed == window->Collapsed && !settings->WantDelete)
+            continue;
+        settings->Pos = pos;
+        settings->Size = size;
         settings->Collapsed = window->Collapsed;
         settings->WantDelete = false;
+        ImGui::MarkWindowSettingsDirty(settings);
     }
+}
+
+static void WindowSettingsHandler_WriteEntry(ImGuiSettingsHandler* handler, ImGuiWindowSettings* settings, ImGuiTextBuffer* buf)
+{
+    if (settings->WantDelete)
+        return;
+    const char* settings_name = settings->GetName();
+    buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
+    buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
+    buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+    buf->appendf("Collapsed=%d\n", settings->Collapsed);
+    buf->append("\n");
+}
+
+static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
 
     // Write to text buffer
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
+    for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+        WindowSettingsHandler_WriteEntry(handler, settings, buf);
+}
+
+// Rewrite sections of entries queued by MarkWindowSettingsDirty()
+static void WindowSettingsHandler_WriteDirty(ImGuiContext* ctx, ImGuiSettingsHandler* handler)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
+
+    ImGuiTextBuffer buf;
+    if (g.SettingsIniRebuild)
+    {
+        for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
+        {
+            buf.Buf.resize(0);
+            WindowSettingsHandler_WriteEntry(handler, settings, &buf);
+            ImGui::SettingsIniWriteSection(&settings->IniSection, buf.c_str(), buf.size());
+            settings->WantSave = false;
+        }
+    }
+    else
+    {
+        for (int n = 0; n < g.SettingsWindowsDirty.Size; n++)
+        {
+            ImGuiWindowSettings* settings = g.SettingsWindows.ptr_from_offset(g.SettingsWindowsDirty[n]);
+            if (!settings->WantSave)
+                continue;
+            buf.Buf.resize(0);
+            WindowSettingsHandler_WriteEntry(handler, settings, &buf);
+            ImGui::SettingsIniWriteSection(&settings->IniSection, buf.c_str(), buf.size());
+            settings->WantSave = false;
+        }
+    }
+    g.SettingsWindowsDirty.resize(0);
+}
+
+// Binary record: Pos (2 x ImS16), Size (2 x ImS16), Collapsed (ImU8), zero-terminated Name
+static const int WINDOW_SETTINGS_BINARY_NAME_OFFSET = 9;
+
+static void WindowSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler* handler, int record_offset, ImGuiID id, const void* data, int data_size)
+{
+    const char* p = (const char*)data;
+    if (data_size <= WINDOW_SETTINGS_BINARY_NAME_OFFSET || p[data_size - 1] != 0 || ImHashStr(p + WINDOW_SETTINGS_BINARY_NAME_OFFSET) != id)
+        return;
+    ImGuiWindowSettings* settings = (ImGuiWindowSettings*)WindowSettingsHandler_ReadOpen(NULL, handler, p + WINDOW_SETTINGS_BINARY_NAME_OFFSET);
+    memcpy(&settings->Pos, p + 0, sizeof(ImVec2ih));
+    memcpy(&settings->Size, p + 4, sizeof(ImVec2ih));
+    settings->Collapsed = (p[8] != 0);
+    if (settings->BinaryOffset != record_offset)
+        ImGui::SettingsBinaryKillRecord(handler->TypeHash, id, &settings->BinaryOffset); // Older record for the same window
+    settings->BinaryOffset = record_offset;
+}
+
+static void WindowSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler)
+{
+    ImGuiContext& g = *ctx;
+    WindowSettingsHandler_GatherAll(ctx);
+
+    ImVector<char> buf;
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
         if (settings->WantDelete)
+        {
+            ImGui::SettingsBinaryKillRecord(handler->TypeHash, settings->ID, &settings->BinaryOffset);
             continue;
+        }
         const char* settings_name = settings->GetName();
-        buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
-        buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
-        buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
-        buf->appendf("Collapsed=%d\n", settings->Collapsed);
-        buf->append("\n");
+        const int name_size = (int)strlen(settings_name) + 1;
+        buf.resize(WINDOW_SETTINGS_BINARY_NAME_OFFSET + name_size);
+        memcpy(buf.Data + 0, &settings->Pos, sizeof(ImVec2ih));
+        memcpy(buf.Data + 4, &settings->Size, sizeof(ImVec2ih));
+        buf.Data[8] = settings->Collapsed ? 1 : 0;
+        memcpy(buf.Data + WINDOW_SETTINGS_BINARY_NAME_OFFSET, settings_name, (size_t)name_size);
+        ImGui::SettingsBinaryWriteRecord(handler->TypeHash, settings->ID, &settings->BinaryOffset, buf.Data, buf.Size);
     }
 }
 
@@ -13203,97 +14767,673 @@ static void SetClipboardTextFn_DefaultImpl(void*, const char* text)
     }
 }
 
-static const char* GetClipboardTextFn_DefaultImpl(void* user_data_ctx)
+static const char* GetClipboardTextFn_DefaultImpl(void* user_data_ctx)
+{
+    ImGuiContext& g = *(ImGuiContext*)user_data_ctx;
+    if (!main_clipboard)
+        PasteboardCreate(kPasteboardClipboard, &main_clipboard);
+    PasteboardSynchronize(main_clipboard);
+
+    ItemCount item_count = 0;
+    PasteboardGetItemCount(main_clipboard, &item_count);
+    for (ItemCount i = 0; i < item_count; i++)
+    {
+        PasteboardItemID item_id = 0;
+        PasteboardGetItemIdentifier(main_clipboard, i + 1, &item_id);
+        CFArrayRef flavor_type_array = 0;
+        PasteboardCopyItemFlavors(main_clipboard, item_id, &flavor_type_array);
+        for (CFIndex j = 0, nj = CFArrayGetCount(flavor_type_array); j < nj; j++)
+        {
+            CFDataRef cf_data;
+            if (PasteboardCopyItemFlavorData(main_clipboard, item_id, CFSTR("public.utf8-plain-text"), &cf_data) == noErr)
+            {
+                g.ClipboardHandlerData.clear();
+                int length = (int)CFDataGetLength(cf_data);
+                g.ClipboardHandlerData.resize(length + 1);
+                CFDataGetBytes(cf_data, CFRangeMake(0, length), (UInt8*)g.ClipboardHandlerData.Data);
+                g.ClipboardHandlerData[length] = 0;
+                CFRelease(cf_data);
+                return g.ClipboardHandlerData.Data;
+            }
+        }
+    }
+    return NULL;
+}
+
+#else
+
+// Local Dear ImGui-only clipboard implementation, if user hasn't defined better clipboard handlers.
+static const char* GetClipboardTextFn_DefaultImpl(void* user_data_ctx)
+{
+    ImGuiContext& g = *(ImGuiContext*)user_data_ctx;
+    return g.ClipboardHandlerData.empty() ? NULL : g.ClipboardHandlerData.begin();
+}
+
+static void SetClipboardTextFn_DefaultImpl(void* user_data_ctx, const char* text)
+{
+    ImGuiContext& g = *(ImGuiContext*)user_data_ctx;
+    g.ClipboardHandlerData.clear();
+    const char* text_end = text + strlen(text);
+    g.ClipboardHandlerData.resize((int)(text_end - text) + 1);
+    memcpy(&g.ClipboardHandlerData[0], text, (size_t)(text_end - text));
+    g.ClipboardHandlerData[(int)(text_end - text)] = 0;
+}
+
+#endif
+
+// Win32 API IME support (for Asian languages, etc.)
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
+
+#include <imm.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "imm32")
+#endif
+
+static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport* viewport, ImGuiPlatformImeData* data)
+{
+    // Notify OS Input Method Editor of text input position
+    HWND hwnd = (HWND)viewport->PlatformHandleRaw;
+    if (hwnd == 0)
+        return;
+
+    //::ImmAssociateContextEx(hwnd, NULL, data->WantVisible ? IACE_DEFAULT : 0);
+    if (HIMC himc = ::ImmGetContext(hwnd))
+    {
+        COMPOSITIONFORM composition_form = {};
+        composition_form.ptCurrentPos.x = (LONG)data->InputPos.x;
+        composition_form.ptCurrentPos.y = (LONG)data->InputPos.y;
+        composition_form.dwStyle = CFS_FORCE_POSITION;
+        ::ImmSetCompositionWindow(himc, &composition_form);
+        CANDIDATEFORM candidate_form = {};
+        candidate_form.dwStyle = CFS_CANDIDATEPOS;
+        candidate_form.ptCurrentPos.x = (LONG)data->InputPos.x;
+        candidate_form.ptCurrentPos.y = (LONG)data->InputPos.y;
+        ::ImmSetCandidateWindow(himc, &candidate_form);
+        ::ImmReleaseContext(hwnd, himc);
+    }
+}
+
+#else
+
+static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeData*) {}
+
+#endif
+
+//-----------------------------------------------------------------------------
+// [SECTION] PROFILER
+//-----------------------------------------------------------------------------
+// - ProfilerGetTicks() [Internal]
+// - ProfilerBeginZone()
+// - ProfilerEndZone()
+// - UpdateProfilerNewFrame() [Internal]
+// - GetProfiler()
+// - ProfilerSaveChromeTraceToMemory()
+// - ProfilerSaveCaptureToMemory()
+// - ProfilerSaveToDisk()
+//-----------------------------------------------------------------------------
+// Binary capture format, as written by ProfilerSaveCaptureToMemory():
+// - Integers are little-endian, 'varint' is an unsigned LEB128 integer (see BinaryWriteVarint()).
+// - Header: u32 magic ('IMPF' = 0x46504D49), u32 version (= 1), u64 ticks_per_second, varint names_count, varint frames_count
+// - Names:  names_count x { varint length, char[length] (not zero-terminated) }
+// - Frames: frames_count x { varint frame_count, u64 start_ticks, varint duration, varint zones_count, zones_count x Zone }
+// - Zone:   varint name_index, varint depth, varint start (relative to the frame start_ticks), varint duration
+// Durations are in ticks. Zones are stored in the order they were opened, so parents come before their children.
+// Typical size is ~8 bytes per zone, where the Chrome trace JSON takes ~75 bytes per zone.
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_ENABLE_PROFILER
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS)
+static ImU64 ProfilerGetTicksPerSecond()    { LARGE_INTEGER freq; ::QueryPerformanceFrequency(&freq); return (ImU64)freq.QuadPart; }
+static ImU64 ProfilerGetTicks()             { LARGE_INTEGER ticks; ::QueryPerformanceCounter(&ticks); return (ImU64)ticks.QuadPart; }
+#elif defined(CLOCK_MONOTONIC)
+static ImU64 ProfilerGetTicksPerSecond()    { return 1000000000; }
+static ImU64 ProfilerGetTicks()             { timespec ts; clock_gettime(CLOCK_MONOTONIC, &ts); return (ImU64)ts.tv_sec * 1000000000 + (ImU64)ts.tv_nsec; }
+#else
+static ImU64 ProfilerGetTicksPerSecond()    { return (ImU64)CLOCKS_PER_SEC; }
+static ImU64 ProfilerGetTicks()             { return (ImU64)clock(); }
+#endif
+#endif // #ifdef IMGUI_ENABLE_PROFILER
+
+// Zones are recorded into the current context. Calls made without a context, or unbalanced ProfilerEndZone() calls, are ignored.
+void ImGui::ProfilerBeginZone(const char* name)
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL)
+        return;
+    ImGuiProfiler* profiler = &ctx->DebugProfiler;
+    profiler->ZoneStack.push_back(profiler->Frame.Zones.Size);
+    profiler->Frame.Zones.resize(profiler->Frame.Zones.Size + 1);
+    ImGuiProfilerZone* zone = &profiler->Frame.Zones.back();
+    zone->Name = name;
+    zone->Depth = profiler->ZoneStack.Size - 1;
+    zone->EndTicks = 0;
+    zone->StartTicks = ProfilerGetTicks(); // Read clock last
+#else
+    IM_UNUSED(name);
+#endif
+}
+
+void ImGui::ProfilerEndZone()
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    const ImU64 ticks = ProfilerGetTicks(); // Read clock first
+    ImGuiContext* ctx = GImGui;
+    if (ctx == NULL || ctx->DebugProfiler.ZoneStack.Size == 0)
+        return;
+    ImGuiProfiler* profiler = &ctx->DebugProfiler;
+    profiler->Frame.Zones[profiler->ZoneStack.back()].EndTicks = ticks;
+    profiler->ZoneStack.pop_back();
+#endif
+}
+
+// Called by NewFrame(): move the frame being recorded into the ring buffer and start a new one.
+// Zones still open are closed in the old frame and re-opened in the new one.
+static void ImGui::UpdateProfilerNewFrame()
+{
+#ifdef IMGUI_ENABLE_PROFILER
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    const ImU64 ticks = ProfilerGetTicks();
+    if (profiler->TicksPerSecond == 0)
+        profiler->TicksPerSecond = ProfilerGetTicksPerSecond();
+
+    // Apply change of FramesMax
+    profiler->FramesMax = ImMax(profiler->FramesMax, 0);
+    if (profiler->Frames.Size != profiler->FramesMax)
+    {
+        profiler->Frames.clear_destruct();
+        profiler->Frames.resize(profiler->FramesMax);
+        for (int n = 0; n < profiler->Frames.Size; n++)
+            IM_PLACEMENT_NEW(&profiler->Frames[n]) ImGuiProfilerFrame();
+        profiler->FramesCount = profiler->FramesHead = 0;
+    }
+
+    // Close frame. Zones recorded before the first NewFrame() are discarded (StartTicks == 0).
+    ImGuiProfilerFrame* frame = &profiler->Frame;
+    ImVector<int>& stack = profiler->ZoneStack;
+    for (int n = 0; n < stack.Size; n++)
+        frame->Zones[stack[n]].EndTicks = ticks;
+    frame->EndTicks = ticks;
+
+    // Move into ring buffer. Swapping storage with the oldest frame lets the new frame reuse its buffer.
+    const ImVector<ImGuiProfilerZone>* prev_zones = &frame->Zones;
+    if (frame->StartTicks != 0 && !profiler->Paused && profiler->Frames.Size > 0)
+    {
+        int dst_idx;
+        if (profiler->FramesCount < profiler->Frames.Size)
+        {
+            dst_idx = profiler->FramesHead + profiler->FramesCount++;
+            if (dst_idx >= profiler->Frames.Size)
+                dst_idx -= profiler->Frames.Size;
+        }
+        else
+        {
+            dst_idx = profiler->FramesHead;
+            profiler->FramesHead = (profiler->FramesHead + 1) % profiler->Frames.Size;
+        }
+        ImGuiProfilerFrame* dst = &profiler->Frames[dst_idx];
+        dst->FrameCount = frame->FrameCount;
+        dst->StartTicks = frame->StartTicks;
+        dst->EndTicks = frame->EndTicks;
+        dst->Zones.swap(frame->Zones);
+        frame->Zones.resize(0);
+        prev_zones = &dst->Zones;
+    }
+
+    // Start frame, re-opening zones. When the previous frame was not kept, compact in place (stack indices are increasing, so stack[n] >= n).
+    for (int n = 0; n < stack.Size; n++)
+    {
+        if (prev_zones == &frame->Zones)
+            frame->Zones[n] = frame->Zones[stack[n]];
+        else
+            frame->Zones.push_back((*prev_zones)[stack[n]]);
+        frame->Zones[n].StartTicks = ticks;
+        frame->Zones[n].EndTicks = 0;
+        stack[n] = n;
+    }
+    frame->Zones.resize(stack.Size);
+    frame->FrameCount = g.FrameCount + 1; // g.FrameCount is incremented later in NewFrame()
+    frame->StartTicks = ticks;
+    frame->EndTicks = 0;
+#endif
+}
+
+ImGuiProfiler* ImGui::GetProfiler()
+{
+    ImGuiContext& g = *GImGui;
+    return &g.DebugProfiler;
+}
+
+static void ProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* s)
+{
+    for (const char* s_begin = s; ; s++)
+    {
+        const unsigned char c = (unsigned char)*s;
+        if (c != 0 && c != '"' && c != '\\' && c >= 0x20)
+            continue;
+        buf->append(s_begin, s);
+        if (c == 0)
+            return;
+        if (c == '"' || c == '\\')
+            buf->appendf("\\%c", c);
+        else
+            buf->appendf("\\u%04x", c);
+        s_begin = s + 1;
+    }
+}
+
+// Export completed frames as Chrome trace event JSON, with one complete event ("ph":"X") per frame and per zone.
+// Timestamps are in microseconds since the start of the oldest frame.
+const char* ImGui::ProfilerSaveChromeTraceToMemory(size_t* out_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+    ImGuiTextBuffer* buf = &profiler->ExportBuf;
+    buf->Buf.resize(0);
+    buf->append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    const ImU64 base_ticks = (profiler->FramesCount > 0) ? profiler->GetFrame(0)->StartTicks : 0;
+    const double us_per_tick = (profiler->TicksPerSecond > 0) ? 1000000.0 / (double)profiler->TicksPerSecond : 0.0;
+    for (int frame_n = 0; frame_n < profiler->FramesCount; frame_n++)
+    {
+        const ImGuiProfilerFrame* frame = profiler->GetFrame(frame_n);
+        buf->appendf("%s\n{\"name\":\"Frame %d\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}", (frame_n > 0) ? "," : "",
+            frame->FrameCount, (double)(frame->StartTicks - base_ticks) * us_per_tick, (double)(frame->EndTicks - frame->StartTicks) * us_per_tick);
+        for (const ImGuiProfilerZone* zone = frame->Zones.begin(); zone != frame->Zones.end(); zone++)
+        {
+            buf->append(",\n{\"name\":\"");
+            ProfilerAppendJsonString(buf, zone->Name);
+            buf->appendf("\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}",
+                (double)(zone->StartTicks - base_ticks) * us_per_tick, (double)(zone->EndTicks - zone->StartTicks) * us_per_tick);
+        }
+    }
+    buf->append("\n]}\n");
+    if (out_size)
+        *out_size = (size_t)buf->size();
+    return buf->c_str();
+}
+
+// Names are stored by pointer: the same string may come from different pointers (e.g. literals in different DLL), so we compare contents.
+static int ProfilerFindOrAddName(ImGuiStorage* names_map, ImVector<const char*>* names, const char* name)
+{
+    const ImGuiID name_id = ImHashStr(name);
+    int name_idx = names_map->GetInt(name_id, -1);
+    if (name_idx != -1 && strcmp((*names)[name_idx], name) == 0)
+        return name_idx;
+    for (name_idx = 0; name_idx < names->Size; name_idx++) // Hash collision
+        if (strcmp((*names)[name_idx], name) == 0)
+            return name_idx;
+    if (names_map->GetInt(name_id, -1) == -1)
+        names_map->SetInt(name_id, names->Size);
+    names->push_back(name);
+    return names->Size - 1;
+}
+
+const void* ImGui::ProfilerSaveCaptureToMemory(size_t* out_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiProfiler* profiler = &g.DebugProfiler;
+
+    // Gather names
+    ImGuiStorage names_map;
+    ImVector<const char*> names;
+    ImVector<int> zones_name_idx;
+    for (int frame_n = 0; frame_n < profiler->FramesCount; frame_n++)
+    {
+        const ImGuiProfilerFrame* frame = profiler->GetFrame(frame_n);
+        for (const ImGuiProfilerZone* zone = frame->Zones.begin(); zone != frame->Zones.end(); zone++)
+            zones_name_idx.push_back(ProfilerFindOrAddName(&names_map, &names, zone->Name));
+    }
+
+    ImGuiTextBuffer* buf = &profiler->ExportBuf;
+    buf->Buf.resize(0);
+    BinaryWriteU32(buf, 0x46504D49); // 'IMPF'
+    BinaryWriteU32(buf, 1);
+    BinaryWriteU64(buf, profiler->TicksPerSecond);
+    BinaryWriteVarint(buf, (ImU64)names.Size);
+    BinaryWriteVarint(buf, (ImU64)profiler->FramesCount);
+    for (int name_n = 0; name_n < names.Size; name_n++)
+    {
+        const size_t name_len = strlen(names[name_n]);
+        BinaryWriteVarint(buf, (ImU64)name_len);
+        buf->append(names[name_n], names[name_n] + name_len);
+    }
+    const int* zone_name_idx = zones_name_idx.Data;
+    for (int frame_n = 0; frame_n < profiler->FramesCount; frame_n++)
+    {
+        const ImGuiProfilerFrame* frame = profiler->GetFrame(frame_n);
+        BinaryWriteVarint(buf, (ImU64)frame->FrameCount);
+        BinaryWriteU64(buf, frame->StartTicks);
+        BinaryWriteVarint(buf, frame->EndTicks - frame->StartTicks);
+        BinaryWriteVarint(buf, (ImU64)frame->Zones.Size);
+        for (const ImGuiProfilerZone* zone = frame->Zones.begin(); zone != frame->Zones.end(); zone++)
+        {
+            BinaryWriteVarint(buf, (ImU64)*zone_name_idx++);
+            BinaryWriteVarint(buf, (ImU64)zone->Depth);
+            BinaryWriteVarint(buf, zone->StartTicks - frame->StartTicks);
+            BinaryWriteVarint(buf, zone->EndTicks - zone->StartTicks);
+        }
+    }
+    if (out_size)
+        *out_size = (size_t)buf->size();
+    return buf->begin();
+}
+
+bool ImGui::ProfilerSaveToDisk(const char* filename)
+{
+    const size_t filename_len = strlen(filename);
+    const bool is_json = (filename_len >= 5 && ImStricmp(filename + filename_len - 5, ".json") == 0);
+    size_t data_size = 0;
+    const void* data = is_json ? (const void*)ProfilerSaveChromeTraceToMemory(&data_size) : ProfilerSaveCaptureToMemory(&data_size);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = (ImFileWrite(data, sizeof(char), data_size, f) == (ImU64)data_size);
+    ImFileClose(f);
+    return ret;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] INPUT RECORDING
+//-----------------------------------------------------------------------------
+// - InputRecordingWriteFrame() [Internal]
+// - InputRecordingReadFrame() [Internal]
+// - UpdateInputRecording() [Internal]
+// - StartInputRecording()
+// - StopInputRecording()
+// - SaveInputRecordingToMemory()
+// - SaveInputRecordingToDisk()
+// - LoadInputRecordingFromMemory()
+// - LoadInputRecordingFromDisk()
+// - StopInputReplay()
+// - IsInputReplayActive()
+//-----------------------------------------------------------------------------
+// Binary format, as written by SaveInputRecordingToMemory():
+// - Integers and floats are little-endian, 'varint' is an unsigned LEB128 integer (see BinaryWriteVarint()).
+// - Header: u32 magic ('IMIR' = 0x52494D49), u32 version (= 1), varint frames_count
+// - Frames: frames_count x { u8 flags, [f32 display_w, f32 display_h], f32 delta_time, varint events_count, events_count x Event }
+//   flags & 1: display size follows. Always set on the first frame, then only when io.DisplaySize changed.
+// - Event:  u8 type (ImGuiInputEventType), u8 source (ImGuiInputSource), then depending on type:
+//   MousePos:    f32 x, f32 y, u8 mouse_source
+//   MouseWheel:  f32 wheel_x, f32 wheel_y, u8 mouse_source
+//   MouseButton: u8 button, u8 down, u8 mouse_source
+//   Key:         varint key, u8 down, f32 analog_value
+//   Text:        varint char
+//   Focus:       u8 focused
+// A frame holds the events submitted between two NewFrame() calls. The first frame also holds events left in the queue
+// by input trickling, so replay can start from an empty queue. Typical size is ~8 bytes per idle frame, ~20 bytes per mouse move.
+//-----------------------------------------------------------------------------
+
+static const ImU32 IM_INPUT_RECORDING_MAGIC = 0x52494D49; // 'IMIR'
+static const ImU32 IM_INPUT_RECORDING_VERSION = 1;
+
+struct ImGuiInputRecordingFrame
+{
+    bool    HasDisplaySize;
+    ImVec2  DisplaySize;
+    float   DeltaTime;
+};
+
+static void InputRecordingWriteFrame(ImGuiTextBuffer* buf, const ImGuiInputRecordingFrame* frame, const ImGuiInputEvent* events, int events_count)
+{
+    BinaryWriteU8(buf, frame->HasDisplaySize ? 1 : 0);
+    if (frame->HasDisplaySize)
+    {
+        BinaryWriteFloat(buf, frame->DisplaySize.x);
+        BinaryWriteFloat(buf, frame->DisplaySize.y);
+    }
+    BinaryWriteFloat(buf, frame->DeltaTime);
+    BinaryWriteVarint(buf, (ImU64)events_count);
+    for (const ImGuiInputEvent* e = events; e < events + events_count; e++)
+    {
+        BinaryWriteU8(buf, (ImU8)e->Type);
+        BinaryWriteU8(buf, (ImU8)e->Source);
+        switch (e->Type)
+        {
+        case ImGuiInputEventType_MousePos:      BinaryWriteFloat(buf, e->MousePos.PosX); BinaryWriteFloat(buf, e->MousePos.PosY); BinaryWriteU8(buf, (ImU8)e->MousePos.MouseSource); break;
+        case ImGuiInputEventType_MouseWheel:    BinaryWriteFloat(buf, e->MouseWheel.WheelX); BinaryWriteFloat(buf, e->MouseWheel.WheelY); BinaryWriteU8(buf, (ImU8)e->MouseWheel.MouseSource); break;
+        case ImGuiInputEventType_MouseButton:   BinaryWriteU8(buf, (ImU8)e->MouseButton.Button); BinaryWriteU8(buf, e->MouseButton.Down ? 1 : 0); BinaryWriteU8(buf, (ImU8)e->MouseButton.MouseSource); break;
+        case ImGuiInputEventType_Key:           BinaryWriteVarint(buf, (ImU64)e->Key.Key); BinaryWriteU8(buf, e->Key.Down ? 1 : 0); BinaryWriteFloat(buf, e->Key.AnalogValue); break;
+        case ImGuiInputEventType_Text:          BinaryWriteVarint(buf, (ImU64)e->Text.Char); break;
+        case ImGuiInputEventType_Focus:         BinaryWriteU8(buf, e->AppFocused.Focused ? 1 : 0); break;
+        default: IM_ASSERT(0); break;
+        }
+    }
+}
+
+// Append the frame events to 'out_events'. Return false if data is truncated or holds values that would trip NewFrame() (EventId is left to the caller).
+static bool InputRecordingReadFrame(ImBinaryReader* r, ImGuiInputRecordingFrame* frame, ImVector<ImGuiInputEvent>* out_events)
+{
+    const ImU8 flags = BinaryReadU8(r);
+    frame->HasDisplaySize = (flags & 1) != 0;
+    if (frame->HasDisplaySize)
+    {
+        frame->DisplaySize.x = BinaryReadFloat(r);
+        frame->DisplaySize.y = BinaryReadFloat(r);
+        if (!(frame->DisplaySize.x >= 0.0f && frame->DisplaySize.y >= 0.0f)) // Also reject NaN
+            return false;
+    }
+    frame->DeltaTime = BinaryReadFloat(r);
+    if ((flags & ~1) != 0 || !(frame->DeltaTime > 0.0f) || r->Error)
+        return false;
+    const ImU64 events_count = BinaryReadVarint(r);
+    if (events_count > (ImU64)(r->DataEnd - r->Data) / 2) // Each event takes at least 2 bytes
+        return false;
+    for (ImU64 n = 0; n < events_count && !r->Error; n++)
+    {
+        ImGuiInputEvent e;
+        const ImU8 type = BinaryReadU8(r);
+        const ImU8 source = BinaryReadU8(r);
+        if (type <= ImGuiInputEventType_None || type >= ImGuiInputEventType_COUNT || source >= ImGuiInputSource_COUNT)
+            return false;
+        e.Type = (ImGuiInputEventType)type;
+        e.Source = (ImGuiInputSource)source;
+        int mouse_source = 0;
+        switch (e.Type)
+        {
+        case ImGuiInputEventType_MousePos:
+            e.MousePos.PosX = BinaryReadFloat(r);
+            e.MousePos.PosY = BinaryReadFloat(r);
+            e.MousePos.MouseSource = (ImGuiMouseSource)(mouse_source = BinaryReadU8(r));
+            break;
+        case ImGuiInputEventType_MouseWheel:
+            e.MouseWheel.WheelX = BinaryReadFloat(r);
+            e.MouseWheel.WheelY = BinaryReadFloat(r);
+            e.MouseWheel.MouseSource = (ImGuiMouseSource)(mouse_source = BinaryReadU8(r));
+            break;
+        case ImGuiInputEventType_MouseButton:
+            e.MouseButton.Button = BinaryReadU8(r);
+            e.MouseButton.Down = BinaryReadU8(r) != 0;
+            e.MouseButton.MouseSource = (ImGuiMouseSource)(mouse_source = BinaryReadU8(r));
+            if (e.MouseButton.Button >= ImGuiMouseButton_COUNT)
+                return false;
+            break;
+        case ImGuiInputEventType_Key:
+        {
+            const ImU64 key = BinaryReadVarint(r);
+            e.Key.Key = (key <= ImGuiMod_Mask_) ? (ImGuiKey)key : ImGuiKey_None;
+            e.Key.Down = BinaryReadU8(r) != 0;
+            e.Key.AnalogValue = BinaryReadFloat(r);
+            if (!ImGui::IsNamedKeyOrModKey(e.Key.Key))
+                return false;
+            break;
+        }
+        case ImGuiInputEventType_Text:
+        {
+            const ImU64 c = BinaryReadVarint(r);
+            if (c > IM_UNICODE_CODEPOINT_MAX)
+                return false;
+            e.Text.Char = (unsigned int)c;
+            break;
+        }
+        case ImGuiInputEventType_Focus:
+            e.AppFocused.Focused = BinaryReadU8(r) != 0;
+            break;
+        default:
+            break;
+        }
+        if (mouse_source >= ImGuiMouseSource_COUNT)
+            return false;
+        out_events->push_back(e);
+    }
+    return !r->Error;
+}
+
+// Called by NewFrame() before input events are processed.
+// Events with an EventId >= NextEventId were submitted since the previous NewFrame(): those are the ones we record, or discard while replaying.
+static void ImGui::UpdateInputRecording()
 {
-    ImGuiContext& g = *(ImGuiContext*)user_data_ctx;
-    if (!main_clipboard)
-        PasteboardCreate(kPasteboardClipboard, &main_clipboard);
-    PasteboardSynchronize(main_clipboard);
-
-    ItemCount item_count = 0;
-    PasteboardGetItemCount(main_clipboard, &item_count);
-    for (ItemCount i = 0; i < item_count; i++)
-    {
-        PasteboardItemID item_id = 0;
-        PasteboardGetItemIdentifier(main_clipboard, i + 1, &item_id);
-        CFArrayRef flavor_type_array = 0;
-        PasteboardCopyItemFlavors(main_clipboard, item_id, &flavor_type_array);
-        for (CFIndex j = 0, nj = CFArrayGetCount(flavor_type_array); j < nj; j++)
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    ImGuiInputRecorder* rec = &g.InputRecorder;
+    if (rec->Replaying)
+    {
+        // On the first frame also discard events left by input trickling, as the recording holds its own.
+        const ImU32 discard_event_id = (rec->ReplayFrameIdx == 0) ? 0 : rec->NextEventId;
+        for (int n = g.InputEventsQueue.Size - 1; n >= 0; n--)
+            if (g.InputEventsQueue[n].EventId >= discard_event_id)
+                g.InputEventsQueue.erase(&g.InputEventsQueue[n]);
+
+        ImBinaryReader r(rec->ReplayData.begin() + rec->ReplayOffset, (size_t)(rec->ReplayData.size() - rec->ReplayOffset));
+        ImGuiInputRecordingFrame frame;
+        const int events_start = g.InputEventsQueue.Size;
+        const bool ok = InputRecordingReadFrame(&r, &frame, &g.InputEventsQueue);
+        IM_ASSERT(ok); // Data was validated by LoadInputRecordingFromMemory()
+        IM_UNUSED(ok);
+        for (int n = events_start; n < g.InputEventsQueue.Size; n++)
+            g.InputEventsQueue[n].EventId = g.InputEventsNextEventId++;
+        if (frame.HasDisplaySize)
+            rec->ReplayDisplaySize = frame.DisplaySize;
+        io.DisplaySize = rec->ReplayDisplaySize;
+        io.DeltaTime = frame.DeltaTime;
+        rec->ReplayOffset = (int)((const char*)r.Data - rec->ReplayData.begin());
+        if (++rec->ReplayFrameIdx >= rec->ReplayFramesCount)
         {
-            CFDataRef cf_data;
-            if (PasteboardCopyItemFlavorData(main_clipboard, item_id, CFSTR("public.utf8-plain-text"), &cf_data) == noErr)
-            {
-                g.ClipboardHandlerData.clear();
-                int length = (int)CFDataGetLength(cf_data);
-                g.ClipboardHandlerData.resize(length + 1);
-                CFDataGetBytes(cf_data, CFRangeMake(0, length), (UInt8*)g.ClipboardHandlerData.Data);
-                g.ClipboardHandlerData[length] = 0;
-                CFRelease(cf_data);
-                return g.ClipboardHandlerData.Data;
-            }
+            IMGUI_DEBUG_LOG_IO("[io] Input replay finished after %d frames.\n", rec->ReplayFramesCount);
+            StopInputReplay();
         }
     }
-    return NULL;
-}
 
-#else
+    if (rec->Recording)
+    {
+        // Events were pushed in EventId order, and trickled events are kept in order at the front of the queue.
+        const ImU32 first_event_id = (rec->RecordFramesCount == 0) ? 0 : rec->NextEventId;
+        int events_start = g.InputEventsQueue.Size;
+        while (events_start > 0 && g.InputEventsQueue[events_start - 1].EventId >= first_event_id)
+            events_start--;
+        ImGuiInputRecordingFrame frame;
+        frame.HasDisplaySize = (io.DisplaySize.x != rec->RecordDisplaySize.x || io.DisplaySize.y != rec->RecordDisplaySize.y);
+        frame.DisplaySize = rec->RecordDisplaySize = io.DisplaySize;
+        frame.DeltaTime = io.DeltaTime;
+        InputRecordingWriteFrame(&rec->RecordData, &frame, g.InputEventsQueue.Data + events_start, g.InputEventsQueue.Size - events_start);
+        rec->RecordFramesCount++;
+    }
+    rec->NextEventId = g.InputEventsNextEventId;
+}
 
-// Local Dear ImGui-only clipboard implementation, if user hasn't defined better clipboard handlers.
-static const char* GetClipboardTextFn_DefaultImpl(void* user_data_ctx)
+void ImGui::StartInputRecording()
 {
-    ImGuiContext& g = *(ImGuiContext*)user_data_ctx;
-    return g.ClipboardHandlerData.empty() ? NULL : g.ClipboardHandlerData.begin();
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder* rec = &g.InputRecorder;
+    rec->Recording = true;
+    rec->RecordFramesCount = 0;
+    rec->RecordDisplaySize = ImVec2(-1.0f, -1.0f);
+    rec->RecordData.clear();
 }
 
-static void SetClipboardTextFn_DefaultImpl(void* user_data_ctx, const char* text)
+void ImGui::StopInputRecording()
 {
-    ImGuiContext& g = *(ImGuiContext*)user_data_ctx;
-    g.ClipboardHandlerData.clear();
-    const char* text_end = text + strlen(text);
-    g.ClipboardHandlerData.resize((int)(text_end - text) + 1);
-    memcpy(&g.ClipboardHandlerData[0], text, (size_t)(text_end - text));
-    g.ClipboardHandlerData[(int)(text_end - text)] = 0;
+    ImGuiContext& g = *GImGui;
+    g.InputRecorder.Recording = false;
 }
 
-#endif
-
-// Win32 API IME support (for Asian languages, etc.)
-#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
-
-#include <imm.h>
-#ifdef _MSC_VER
-#pragma comment(lib, "imm32")
-#endif
+// Can be called while recording, to take a snapshot of the frames recorded so far.
+const void* ImGui::SaveInputRecordingToMemory(size_t* out_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder* rec = &g.InputRecorder;
+    ImGuiTextBuffer* buf = &rec->SaveBuf;
+    buf->Buf.resize(0);
+    buf->reserve(rec->RecordData.size() + 16);
+    BinaryWriteU32(buf, IM_INPUT_RECORDING_MAGIC);
+    BinaryWriteU32(buf, IM_INPUT_RECORDING_VERSION);
+    BinaryWriteVarint(buf, (ImU64)rec->RecordFramesCount);
+    buf->append(rec->RecordData.begin(), rec->RecordData.end());
+    if (out_size)
+        *out_size = (size_t)buf->size();
+    return buf->begin();
+}
 
-static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport* viewport, ImGuiPlatformImeData* data)
+bool ImGui::SaveInputRecordingToDisk(const char* filename)
 {
-    // Notify OS Input Method Editor of text input position
-    HWND hwnd = (HWND)viewport->PlatformHandleRaw;
-    if (hwnd == 0)
-        return;
+    size_t data_size = 0;
+    const void* data = SaveInputRecordingToMemory(&data_size);
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = (ImFileWrite(data, sizeof(char), data_size, f) == (ImU64)data_size);
+    ImFileClose(f);
+    return ret;
+}
 
-    //::ImmAssociateContextEx(hwnd, NULL, data->WantVisible ? IACE_DEFAULT : 0);
-    if (HIMC himc = ::ImmGetContext(hwnd))
+// The whole recording is validated before replay starts, so a truncated or corrupted file never feeds partial frames to NewFrame().
+bool ImGui::LoadInputRecordingFromMemory(const void* data, size_t data_size)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder* rec = &g.InputRecorder;
+    ImBinaryReader r(data, data_size);
+    const ImU32 magic = BinaryReadU32(&r);
+    const ImU32 version = BinaryReadU32(&r);
+    const ImU64 frames_count = BinaryReadVarint(&r);
+    if (r.Error || magic != IM_INPUT_RECORDING_MAGIC || version != IM_INPUT_RECORDING_VERSION || frames_count > (ImU64)(r.DataEnd - r.Data))
+        return false;
+    const ImU8* frames_data = r.Data;
+    ImVector<ImGuiInputEvent> events;
+    for (ImU64 n = 0; n < frames_count; n++)
     {
-        COMPOSITIONFORM composition_form = {};
-        composition_form.ptCurrentPos.x = (LONG)data->InputPos.x;
-        composition_form.ptCurrentPos.y = (LONG)data->InputPos.y;
-        composition_form.dwStyle = CFS_FORCE_POSITION;
-        ::ImmSetCompositionWindow(himc, &composition_form);
-        CANDIDATEFORM candidate_form = {};
-        candidate_form.dwStyle = CFS_CANDIDATEPOS;
-        candidate_form.ptCurrentPos.x = (LONG)data->InputPos.x;
-        candidate_form.ptCurrentPos.y = (LONG)data->InputPos.y;
-        ::ImmSetCandidateWindow(himc, &candidate_form);
-        ::ImmReleaseContext(hwnd, himc);
+        ImGuiInputRecordingFrame frame;
+        events.resize(0);
+        if (!InputRecordingReadFrame(&r, &frame, &events) || (n == 0 && !frame.HasDisplaySize))
+        {
+            IMGUI_DEBUG_LOG_IO("[io] Input recording rejected: invalid frame %d.\n", (int)n);
+            return false;
+        }
     }
+
+    rec->ReplayData.Buf.resize(0);
+    rec->ReplayData.append((const char*)frames_data, (const char*)r.Data);
+    rec->ReplayFramesCount = (int)frames_count;
+    rec->ReplayFrameIdx = 0;
+    rec->ReplayOffset = 0;
+    rec->Replaying = (frames_count > 0);
+    return true;
 }
 
-#else
+bool ImGui::LoadInputRecordingFromDisk(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (!data)
+        return false;
+    const bool ret = LoadInputRecordingFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
 
-static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeData*) {}
+void ImGui::StopInputReplay()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiInputRecorder* rec = &g.InputRecorder;
+    rec->Replaying = false;
+    rec->ReplayData.clear();
+    rec->ReplayFramesCount = rec->ReplayFrameIdx = rec->ReplayOffset = 0;
+}
 
-#endif
+bool ImGui::IsInputReplayActive()
+{
+    ImGuiContext& g = *GImGui;
+    return g.InputRecorder.Replaying;
+}
 
 //-----------------------------------------------------------------------------
 // [SECTION] METRICS/DEBUGGER WINDOW
@@ -13304,6 +15444,11 @@ static void SetPlatformImeDataFn_DefaultImpl(ImGuiViewport*, ImGuiPlatformImeDat
 // - MetricsHelpMarker() [Internal]
 // - ShowFontAtlas() [Internal]
 // - ShowMetricsWindow()
+// - DebugNodeAllocStats() [Internal]
+// - DebugNodeProfiler() [Internal]
+// - UpdateDebugMetricsHistory() [Internal]
+// - DebugNodeMetricsHistory() [Internal]
+// - DebugNodeInputRecorder() [Internal]
 // - DebugNodeColumns() [Internal]
 // - DebugNodeDrawList() [Internal]
 // - DebugNodeDrawCmdShowMeshAndBoundingBox() [Internal]
@@ -13479,7 +15624,7 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         DebugNodeFont(font);
         PopID();
     }
-    if (TreeNode("Font Atlas", "Font Atlas (%dx%d pixels)", atlas->TexWidth, atlas->TexHeight))
+    if (TreeNode("Font Atlas", "Font Atlas (%dx%d pixels, %.1f%% filled)", atlas->TexWidth, atlas->TexHeight, (atlas->TexWidth > 0 && atlas->TexHeight > 0) ? atlas->TexPackedSurface * 100.0f / ((float)atlas->TexWidth * atlas->TexHeight) : 0.0f))
     {
         ImGuiContext& g = *GImGui;
         ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
@@ -13489,6 +15634,20 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         Image(atlas->TexID, ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), tint_col, border_col);
         TreePop();
     }
+    if (TreeNode("Scale Variants", "Scale Variants (%d), baked scale %.2f%s%s", atlas->Variants.Size, atlas->BakedScale, atlas->IsBakedScalePending() ? " (pending)" : "", atlas->IsBuildAsyncPending() ? ", build pending" : ""))
+    {
+        static const char* status_names[] = { "Building", "Ready", "Discarded" };
+        for (int n = 0; n < atlas->Variants.Size; n++)
+        {
+            ImFontAtlasVariant* variant = atlas->Variants[n];
+            const char* kind = variant->IsBuildAsync ? " (BuildAsync)" : "";
+            if (variant->Status == ImFontAtlasVariantStatus_Building)
+                BulletText("Scale %.2f%s: %s", variant->Scale, kind, status_names[variant->Status]);
+            else
+                BulletText("Scale %.2f%s: %s, %dx%d pixels, TexID 0x%p, last used %d", variant->Scale, kind, status_names[variant->Status], variant->Atlas->TexWidth, variant->Atlas->TexHeight, (void*)(intptr_t)variant->Atlas->TexID, variant->LastUsed);
+        }
+        TreePop();
+    }
 }
 
 void ImGui::ShowMetricsWindow(bool* p_open)
@@ -13511,8 +15670,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Dear ImGui %s", GetVersion());
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
-    Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
+    Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, ImAtomicLoad(&io.MetricsActiveAllocations));
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
+    DebugNodeAllocStats(GetAllocStats());
+    DebugNodeProfiler(GetProfiler());
+    DebugNodeMetricsHistory(&g.DebugMetricsHistory);
+    DebugNodeInputRecorder(&g.InputRecorder);
+    if (io.ConfigMemoryCompactBudget > 0)
+        Text("Transient buffers: %.1f KB / %.1f KB budget", g.GcTransientBytes / 1024.0f, io.ConfigMemoryCompactBudget / 1024.0f);
+    Text("Compacted buffers: %d (%.1f KB reclaimed)", g.GcReclaimedCount, (double)g.GcReclaimedBytes / 1024.0);
 
     Separator();
 
@@ -13612,6 +15778,9 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             Unindent();
         }
 
+        Checkbox("Disable tables layout cache", &cfg->DisableTablesLayoutCache);
+        SameLine();
+        MetricsHelpMarker("Solve columns widths of all tables every frame, instead of reusing the last solve when its inputs are unchanged.");
         Checkbox("Show tables rectangles", &cfg->ShowTablesRects);
         SameLine();
         SetNextItemWidth(GetFontSize() * 12);
@@ -13793,6 +15962,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         else
             TextUnformatted("<NULL>");
         Text("SettingsDirtyTimer %.2f", g.SettingsDirtyTimer);
+        Text("SettingsBinaryData: %d bytes (%d in killed records), %d records to patch", g.SettingsBinaryData.Size, g.SettingsBinaryDeadSize, g.SettingsBinaryDirty.Size);
         if (TreeNode("SettingsHandlers", "Settings handlers: (%d)", g.SettingsHandlers.Size))
         {
             for (int n = 0; n < g.SettingsHandlers.Size; n++)
@@ -14018,6 +16188,429 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     End();
 }
 
+// [DEBUG] Display allocation counters per subsystem (requires IMGUI_ENABLE_ALLOC_TRACKING)
+void ImGui::DebugNodeAllocStats(const ImGuiAllocStats* stats)
+{
+    if (!TreeNode("Allocations", "Allocations (%d live, %.1f KB)", stats->Total.LiveCount, stats->Total.LiveBytes / 1024.0f))
+        return;
+#ifndef IMGUI_ENABLE_ALLOC_TRACKING
+    TextDisabled("Define IMGUI_ENABLE_ALLOC_TRACKING in imconfig.h to track allocations per subsystem.");
+#else
+    static const char* tag_names[ImGuiAllocTag_COUNT] = { "Misc", "Windows", "DrawLists", "Tables", "Fonts", "Settings", "InputText" };
+
+    // Export as CSV so external tools and benchmarks can diff allocation budgets
+    if (SmallButton("Copy as CSV"))
+    {
+        ImGuiTextBuffer buf;
+        buf.append("tag,live_count,live_bytes,peak_bytes,frame_alloc_count,frame_alloc_bytes\n");
+        for (int tag = 0; tag <= ImGuiAllocTag_COUNT; tag++)
+        {
+            const ImGuiAllocTagStats* ts = (tag < ImGuiAllocTag_COUNT) ? &stats->Tags[tag] : &stats->Total;
+            buf.appendf("%s,%d,%llu,%llu,%d,%llu\n", (tag < ImGuiAllocTag_COUNT) ? tag_names[tag] : "Total", ts->LiveCount,
+                (ImU64)ts->LiveBytes, (ImU64)ts->PeakBytes, ts->LastFrameAllocCount, (ImU64)ts->LastFrameAllocBytes);
+        }
+        SetClipboardText(buf.c_str());
+    }
+    if (BeginTable("##allocs", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        TableSetupColumn("Tag");
+        TableSetupColumn("Live");
+        TableSetupColumn("Live KB");
+        TableSetupColumn("Peak KB");
+        TableSetupColumn("Allocs/frame");
+        TableHeadersRow();
+        for (int tag = 0; tag <= ImGuiAllocTag_COUNT; tag++)
+        {
+            const ImGuiAllocTagStats* ts = (tag < ImGuiAllocTag_COUNT) ? &stats->Tags[tag] : &stats->Total;
+            TableNextColumn(); TextUnformatted((tag < ImGuiAllocTag_COUNT) ? tag_names[tag] : "Total");
+            TableNextColumn(); Text("%d", ts->LiveCount);
+            TableNextColumn(); Text("%.1f", ts->LiveBytes / 1024.0f);
+            TableNextColumn(); Text("%.1f", ts->PeakBytes / 1024.0f);
+            TableNextColumn(); Text("%d (%.1f KB)", ts->LastFrameAllocCount, ts->LastFrameAllocBytes / 1024.0f);
+        }
+        EndTable();
+    }
+#endif
+    TreePop();
+}
+
+// [DEBUG] Display profiler zones as a flame graph (requires IMGUI_ENABLE_PROFILER)
+void ImGui::DebugNodeProfiler(ImGuiProfiler* profiler)
+{
+    const double ms_per_tick = (profiler->TicksPerSecond > 0) ? 1000.0 / (double)profiler->TicksPerSecond : 0.0;
+    const ImGuiProfilerFrame* last_frame = (profiler->FramesCount > 0) ? profiler->GetFrame(profiler->FramesCount - 1) : NULL;
+    if (!TreeNode("Profiler", "Profiler (%.3f ms)", last_frame ? (last_frame->EndTicks - last_frame->StartTicks) * ms_per_tick : 0.0))
+        return;
+#ifndef IMGUI_ENABLE_PROFILER
+    TextDisabled("Define IMGUI_ENABLE_PROFILER in imconfig.h to record timing zones.");
+#else
+    ImGuiContext& g = *GImGui;
+    ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
+    Checkbox("Paused", &profiler->Paused);
+    SameLine();
+    if (SmallButton("Copy Chrome trace"))
+        SetClipboardText(ProfilerSaveChromeTraceToMemory());
+    SameLine();
+    if (SmallButton("Save imgui_profile.json"))
+        ProfilerSaveToDisk("imgui_profile.json");
+    SameLine();
+    MetricsHelpMarker("Zones recorded with IM_PROFILE_SCOPE(), a frame spans from one NewFrame() call to the next.\nPause to browse the last frames.\nOpen the Chrome trace in chrome://tracing, ui.perfetto.dev or speedscope.app.");
+
+    // Select frame. Frames only stay in place while paused.
+    if (!profiler->Paused || cfg->ProfilerFrameIdx >= profiler->FramesCount)
+        cfg->ProfilerFrameIdx = -1;
+    if (profiler->FramesCount == 0)
+    {
+        TextDisabled("No frame recorded.");
+        TreePop();
+        return;
+    }
+    int frame_idx = (cfg->ProfilerFrameIdx >= 0) ? cfg->ProfilerFrameIdx : profiler->FramesCount - 1;
+    if (profiler->Paused)
+    {
+        SetNextItemWidth(GetFontSize() * 20);
+        if (SliderInt("Frame", &frame_idx, 0, profiler->FramesCount - 1))
+            cfg->ProfilerFrameIdx = frame_idx;
+    }
+    const ImGuiProfilerFrame* frame = profiler->GetFrame(frame_idx);
+    const ImU64 frame_ticks = ImMax(frame->EndTicks - frame->StartTicks, (ImU64)1);
+    Text("Frame %d: %.3f ms, %d zones", frame->FrameCount, frame_ticks * ms_per_tick, frame->Zones.Size);
+
+    // Flame graph: one row per depth, time along x
+    int depth_max = 0;
+    for (const ImGuiProfilerZone* zone = frame->Zones.begin(); zone != frame->Zones.end(); zone++)
+        depth_max = ImMax(depth_max, zone->Depth);
+    const float row_height = GetTextLineHeight() + 2.0f;
+    const ImVec2 graph_size(ImMax(GetContentRegionAvail().x, 100.0f), row_height * (depth_max + 1));
+    const ImVec2 graph_pos = GetCursorScreenPos();
+    InvisibleButton("##flame", graph_size);
+    const bool graph_hovered = IsItemHovered();
+    ImDrawList* draw_list = GetWindowDrawList();
+    draw_list->AddRectFilled(graph_pos, graph_pos + graph_size, GetColorU32(ImGuiCol_FrameBg));
+    const ImGuiProfilerZone* hovered_zone = NULL;
+    for (const ImGuiProfilerZone* zone = frame->Zones.begin(); zone != frame->Zones.end(); zone++)
+    {
+        const float x0 = graph_pos.x + (float)((double)(zone->StartTicks - frame->StartTicks) / (double)frame_ticks * graph_size.x);
+        const float x1 = graph_pos.x + (float)((double)(zone->EndTicks - frame->StartTicks) / (double)frame_ticks * graph_size.x);
+        const ImRect bb(x0, graph_pos.y + zone->Depth * row_height, ImMax(x1, x0 + 1.0f), graph_pos.y + (zone->Depth + 1) * row_height - 1.0f);
+        const ImU32 name_hash = ImHashStr(zone->Name);
+        draw_list->AddRectFilled(bb.Min, bb.Max, ImColor::HSV((name_hash & 0xFF) / 255.0f, 0.45f, 0.85f));
+        if (bb.GetWidth() > GetFontSize())
+        {
+            const ImVec4 clip_rect(bb.Min.x, bb.Min.y, bb.Max.x - 2.0f, bb.Max.y);
+            draw_list->AddText(NULL, 0.0f, bb.Min + ImVec2(2.0f, 1.0f), IM_COL32_BLACK, zone->Name, NULL, 0.0f, &clip_rect);
+        }
+        if (graph_hovered && bb.Contains(g.IO.MousePos))
+            hovered_zone = zone;
+    }
+    if (hovered_zone)
+        SetTooltip("%s: %.3f ms", hovered_zone->Name, (hovered_zone->EndTicks - hovered_zone->StartTicks) * ms_per_tick);
+
+    // Totals per name over the selected frame
+    struct ZoneStats { const char* Name; int Calls; ImU64 TotalTicks; ImU64 MaxTicks; };
+    ImGuiStorage stats_map;
+    ImVector<ZoneStats> stats;
+    for (const ImGuiProfilerZone* zone = frame->Zones.begin(); zone != frame->Zones.end(); zone++)
+    {
+        int* stats_idx = stats_map.GetIntRef(ImHashStr(zone->Name), -1);
+        if (*stats_idx == -1)
+        {
+            *stats_idx = stats.Size;
+            ZoneStats new_stats = { zone->Name, 0, 0, 0 };
+            stats.push_back(new_stats);
+        }
+        ZoneStats* zone_stats = &stats[*stats_idx];
+        zone_stats->Calls++;
+        zone_stats->TotalTicks += zone->EndTicks - zone->StartTicks;
+        zone_stats->MaxTicks = ImMax(zone_stats->MaxTicks, zone->EndTicks - zone->StartTicks);
+    }
+    if (BeginTable("##zones", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        TableSetupColumn("Zone");
+        TableSetupColumn("Calls");
+        TableSetupColumn("Total ms");
+        TableSetupColumn("Max ms");
+        TableHeadersRow();
+        for (const ZoneStats* zone_stats = stats.begin(); zone_stats != stats.end(); zone_stats++)
+        {
+            TableNextColumn(); TextUnformatted(zone_stats->Name);
+            TableNextColumn(); Text("%d", zone_stats->Calls);
+            TableNextColumn(); Text("%.3f", zone_stats->TotalTicks * ms_per_tick);
+            TableNextColumn(); Text("%.3f", zone_stats->MaxTicks * ms_per_tick);
+        }
+        EndTable();
+    }
+#endif
+    TreePop();
+}
+
+static int MetricsHistoryAddSeries(ImGuiMetricsHistory* history, const char* name, bool is_time)
+{
+    history->Series.resize(history->Series.Size + 1);
+    ImGuiMetricsSeries* series = IM_PLACEMENT_NEW(&history->Series.back()) ImGuiMetricsSeries();
+    series->Name = name;
+    series->IsTime = is_time;
+    series->Values.SetCapacity(history->Capacity);
+    if (history->Series.Size > 1) // Align with other series
+        for (int n = history->Series[0].Values.Count; n > 0; n--)
+            series->Values.PushBack(0.0f);
+    history->ZoneTotals.push_back(0.0f);
+    return history->Series.Size - 1;
+}
+
+// Zone names are stored by pointer: look up by pointer first, then by contents (e.g. same literal in another DLL).
+static int MetricsHistoryFindOrAddZoneSeries(ImGuiMetricsHistory* history, const char* name)
+{
+    const ImGuiID ptr_id = ImHashData(&name, sizeof(name));
+    int* ptr_series_idx = history->ZoneSeriesMap.GetIntRef(ptr_id, -1);
+    if (*ptr_series_idx != -1)
+        return *ptr_series_idx;
+    const ImGuiID name_id = ImHashStr(name);
+    int series_idx = history->ZoneSeriesNameMap.GetInt(name_id, -1);
+    if (series_idx == -1)
+    {
+        const int zone_series_max = 24;
+        if (history->Series.Size >= ImGuiMetricsSeriesBuiltin_COUNT + zone_series_max)
+            return -1;
+        series_idx = MetricsHistoryAddSeries(history, name, true);
+        history->ZoneSeriesNameMap.SetInt(name_id, series_idx);
+    }
+    history->ZoneSeriesMap.SetInt(ptr_id, series_idx); // ptr_series_idx may have been invalidated
+    return series_idx;
+}
+
+// Called by NewFrame(): append the values of the previous frame to each series.
+// Zone series are taken from the profiler frame before it is closed, so they keep being recorded while the profiler is paused.
+void ImGui::UpdateDebugMetricsHistory()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiMetricsHistory* history = &g.DebugMetricsHistory;
+    const int frame_alloc_count = ImAtomicExchange(&history->FrameAllocCount, 0);
+    if (!history->Enabled || g.FrameCount == 0)
+        return;
+    if (history->Series.Size == 0)
+    {
+        static const char* builtin_names[ImGuiMetricsSeriesBuiltin_COUNT] = { "Frame time (wall)", "UI build time", "Vertices", "Indices", "Draw commands", "Allocations" };
+        for (int n = 0; n < ImGuiMetricsSeriesBuiltin_COUNT; n++)
+            MetricsHistoryAddSeries(history, builtin_names[n], n == ImGuiMetricsSeriesBuiltin_FrameTime || n == ImGuiMetricsSeriesBuiltin_BuildTime);
+    }
+
+    float builtin_values[ImGuiMetricsSeriesBuiltin_COUNT];
+    builtin_values[ImGuiMetricsSeriesBuiltin_FrameTime] = g.IO.DeltaTime * 1000.0f;
+    builtin_values[ImGuiMetricsSeriesBuiltin_BuildTime] = 0.0f;
+    builtin_values[ImGuiMetricsSeriesBuiltin_Vertices] = (float)g.IO.MetricsRenderVertices;
+    builtin_values[ImGuiMetricsSeriesBuiltin_Indices] = (float)g.IO.MetricsRenderIndices;
+    builtin_values[ImGuiMetricsSeriesBuiltin_Allocs] = (float)frame_alloc_count;
+    int draw_cmds = 0;
+    const ImDrawData* draw_data = &g.Viewports[0]->DrawDataP;
+    if (draw_data->Valid)
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+            draw_cmds += draw_data->CmdLists[n]->CmdBuffer.Size;
+    builtin_values[ImGuiMetricsSeriesBuiltin_DrawCmds] = (float)draw_cmds;
+
+    // Sum zones per name. Open zones are skipped: they will be counted in the frame they end in.
+    history->ZoneTotals.resize(history->Series.Size);
+    memset(history->ZoneTotals.Data, 0, (size_t)history->ZoneTotals.size_in_bytes());
+#ifdef IMGUI_ENABLE_PROFILER
+    const ImGuiProfiler* profiler = &g.DebugProfiler;
+    const ImGuiProfilerFrame* frame = &profiler->Frame;
+    const double ms_per_tick = (profiler->TicksPerSecond > 0) ? 1000.0 / (double)profiler->TicksPerSecond : 0.0;
+    bool render_found = false;
+    for (const ImGuiProfilerZone* zone = frame->Zones.begin(); zone != frame->Zones.end() && frame->StartTicks != 0; zone++)
+    {
+        if (zone->EndTicks == 0)
+            continue;
+        if (!render_found && strcmp(zone->Name, "Render") == 0)
+        {
+            builtin_values[ImGuiMetricsSeriesBuiltin_BuildTime] = (float)((zone->StartTicks - frame->StartTicks) * ms_per_tick);
+            render_found = true;
+        }
+        const int series_idx = MetricsHistoryFindOrAddZoneSeries(history, zone->Name);
+        if (series_idx != -1)
+            history->ZoneTotals[series_idx] += (float)((zone->EndTicks - zone->StartTicks) * ms_per_tick);
+    }
+#endif
+
+    // Append values and check for regressions
+    for (int series_n = 0; series_n < history->Series.Size; series_n++)
+    {
+        ImGuiMetricsSeries* series = &history->Series[series_n];
+        const float v = (series_n < ImGuiMetricsSeriesBuiltin_COUNT) ? builtin_values[series_n] : history->ZoneTotals[series_n];
+        series->Values.PushBack(v);
+        if (series->RegressionThreshold > 0.0f && v > series->RegressionThreshold)
+        {
+            series->RegressionCount++;
+            series->RegressionLastFrame = g.FrameCount - 1;
+            series->RegressionLastValue = v;
+            IMGUI_DEBUG_LOG("[metrics] Frame %d: %s %.3f above threshold %.3f\n", g.FrameCount - 1, series->Name, v, series->RegressionThreshold);
+        }
+    }
+}
+
+static int IMGUI_CDECL MetricsCompareFloat(const void* lhs, const void* rhs)
+{
+    const float a = *(const float*)lhs;
+    const float b = *(const float*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Sort the last WindowSeconds of each series to get p50/p95/p99/max. Only refreshed a few times per second.
+static void MetricsHistoryUpdatePercentiles(ImGuiMetricsHistory* history)
+{
+    ImGuiContext& g = *GImGui;
+    if (history->Series.Size == 0 || (history->PercentilesTime >= 0.0 && g.Time - history->PercentilesTime < 0.25))
+        return;
+    history->PercentilesTime = g.Time;
+
+    // Frames covered by the window, from the frame times
+    const ImGuiPlotBuffer* frame_times = &history->Series[ImGuiMetricsSeriesBuiltin_FrameTime].Values;
+    int frames_count = 0;
+    for (float window_ms = 0.0f; frames_count < frame_times->Count && window_ms < history->WindowSeconds * 1000.0f; frames_count++)
+        window_ms += (*frame_times)[frame_times->Count - 1 - frames_count];
+    history->PercentilesFrames = frames_count;
+
+    static const float percentiles[4] = { 0.50f, 0.95f, 0.99f, 1.00f };
+    history->SortBuffer.resize(frames_count);
+    for (ImGuiMetricsSeries* series = history->Series.begin(); series != history->Series.end(); series++)
+    {
+        if (frames_count == 0)
+        {
+            memset(series->Percentiles, 0, sizeof(series->Percentiles));
+            continue;
+        }
+        for (int n = 0; n < frames_count; n++)
+            history->SortBuffer[n] = series->Values[series->Values.Count - frames_count + n];
+        ImQsort(history->SortBuffer.Data, (size_t)frames_count, sizeof(float), MetricsCompareFloat);
+        for (int n = 0; n < IM_ARRAYSIZE(percentiles); n++) // Nearest rank
+            series->Percentiles[n] = history->SortBuffer[ImClamp((int)ImCeil(percentiles[n] * frames_count) - 1, 0, frames_count - 1)];
+    }
+}
+
+// [DEBUG] Display rolling percentiles and plots of frame timings and work counters
+void ImGui::DebugNodeMetricsHistory(ImGuiMetricsHistory* history)
+{
+    ImGuiContext& g = *GImGui;
+    if (!history->Enabled)
+        ImAtomicExchange(&history->Enabled, 1); // Start recording as soon as the Metrics window is visible
+    MetricsHistoryUpdatePercentiles(history);
+    const ImGuiMetricsSeries* frame_time = (history->Series.Size > 0) ? &history->Series[ImGuiMetricsSeriesBuiltin_FrameTime] : NULL;
+    if (!TreeNode("Frame histograms", "Frame histograms (wall frame time p99 %.2f ms, %d spikes)", frame_time ? frame_time->Percentiles[2] : 0.0f, frame_time ? frame_time->RegressionCount : 0))
+        return;
+    SetNextItemWidth(GetFontSize() * 8);
+    if (SliderFloat("Window", &history->WindowSeconds, 1.0f, 60.0f, "%.0f s"))
+        history->PercentilesTime = -1.0;
+    SameLine();
+    if (SmallButton("Reset"))
+    {
+        for (ImGuiMetricsSeries* series = history->Series.begin(); series != history->Series.end(); series++)
+        {
+            series->Values.Clear();
+            series->RegressionCount = series->RegressionLastFrame = 0;
+            series->RegressionLastValue = 0.0f;
+        }
+        history->PercentilesTime = -1.0;
+    }
+    SameLine();
+    MetricsHelpMarker("Percentiles are computed over the last frames covering 'Window' seconds, plots show the last frames kept.\nValues above a spike threshold are counted and logged to the Debug Log (0: disabled).\nFrame time is io.DeltaTime: wall clock time, including vsync and the rest of the application. UI build time only covers NewFrame() to Render().\nSeries other than frame time and counters need IMGUI_ENABLE_PROFILER.");
+    Text("%d frames in window, %d frames kept.", history->PercentilesFrames, frame_time ? frame_time->Values.Count : 0);
+
+    if (BeginTable("##series", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        TableSetupColumn("Series");
+        TableSetupColumn("p50");
+        TableSetupColumn("p95");
+        TableSetupColumn("p99");
+        TableSetupColumn("Max");
+        TableSetupColumn("Spike threshold");
+        TableSetupColumn("Spikes");
+        TableSetupColumn("History", ImGuiTableColumnFlags_WidthStretch);
+        TableHeadersRow();
+        for (int series_n = 0; series_n < history->Series.Size; series_n++)
+        {
+            ImGuiMetricsSeries* series = &history->Series[series_n];
+#ifndef IMGUI_ENABLE_PROFILER
+            if (series_n == ImGuiMetricsSeriesBuiltin_BuildTime)
+                continue;
+#endif
+            PushID(series_n);
+            const char* fmt = series->IsTime ? "%.3f" : "%.0f";
+            TableNextColumn(); Text(series->IsTime ? "%s (ms)" : "%s", series->Name);
+            for (int n = 0; n < IM_ARRAYSIZE(series->Percentiles); n++)
+            {
+                TableNextColumn();
+                if (series->RegressionThreshold > 0.0f && series->Percentiles[n] > series->RegressionThreshold)
+                    TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), fmt, series->Percentiles[n]);
+                else
+                    Text(fmt, series->Percentiles[n]);
+            }
+            TableNextColumn();
+            SetNextItemWidth(GetFontSize() * 6);
+            DragFloat("##threshold", &series->RegressionThreshold, series->IsTime ? 0.1f : 10.0f, 0.0f, FLT_MAX, fmt, ImGuiSliderFlags_AlwaysClamp);
+            TableNextColumn();
+            if (series->RegressionCount > 0)
+            {
+                TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%d", series->RegressionCount);
+                if (IsItemHovered())
+                    SetTooltip(series->IsTime ? "Last: frame %d, %.3f" : "Last: frame %d, %.0f", series->RegressionLastFrame, series->RegressionLastValue);
+            }
+            else
+            {
+                TextDisabled("0");
+            }
+
+            // Plot all frames kept, with a line at the threshold
+            TableNextColumn();
+            float v_min = 0.0f, v_max = 0.0f;
+            series->Values.GetMinMax(0, series->Values.Count, &v_min, &v_max);
+            const float scale_max = ImMax(ImMax(v_max, series->RegressionThreshold * 1.25f), 1.0f);
+            SetNextItemWidth(-FLT_MIN);
+            PlotLines("##history", &series->Values, NULL, 0.0f, scale_max, ImVec2(0.0f, GetFrameHeight()));
+            if (series->RegressionThreshold > 0.0f)
+            {
+                const ImRect plot_bb(GetItemRectMin() + g.Style.FramePadding, GetItemRectMax() - g.Style.FramePadding);
+                const float y = IM_FLOOR(plot_bb.Max.y - series->RegressionThreshold / scale_max * plot_bb.GetHeight());
+                GetWindowDrawList()->AddLine(ImVec2(plot_bb.Min.x, y), ImVec2(plot_bb.Max.x, y), IM_COL32(255, 100, 100, 200));
+            }
+            PopID();
+        }
+        EndTable();
+    }
+    TreePop();
+}
+
+void ImGui::DebugNodeInputRecorder(ImGuiInputRecorder* rec)
+{
+    const char* filename = "imgui_inputs.bin";
+    if (!TreeNode("Input recording", "Input recording (%s)", rec->Recording ? "recording" : rec->Replaying ? "replaying" : "idle"))
+        return;
+    if (rec->Recording ? SmallButton("Stop recording") : SmallButton("Start recording"))
+    {
+        if (rec->Recording)
+            StopInputRecording();
+        else
+            StartInputRecording();
+    }
+    SameLine();
+    BeginDisabled(rec->RecordFramesCount == 0);
+    if (SmallButton("Save"))
+        SaveInputRecordingToDisk(filename);
+    EndDisabled();
+    SameLine();
+    if (rec->Replaying ? SmallButton("Stop replay") : SmallButton("Replay"))
+    {
+        if (rec->Replaying)
+            StopInputReplay();
+        else if (!LoadInputRecordingFromDisk(filename))
+            IMGUI_DEBUG_LOG("[io] Failed to load input recording from '%s'.\n", filename);
+    }
+    SameLine();
+    MetricsHelpMarker("Record input events, io.DeltaTime and io.DisplaySize of each frame and replay them.\nSave and Replay use 'imgui_inputs.bin' in the working directory.\nInputs written directly to io (legacy io.MousePos/io.MouseDown[] writes) are not recorded.");
+    Text("Recorded: %d frames, %d bytes", rec->RecordFramesCount, rec->RecordData.size());
+    if (rec->Replaying)
+        Text("Replaying: frame %d/%d", rec->ReplayFrameIdx, rec->ReplayFramesCount);
+    TreePop();
+}
+
 // [DEBUG] Display contents of Columns
 void ImGui::DebugNodeColumns(ImGuiOldColumns* columns)
 {
@@ -14035,9 +16628,13 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
     ImGuiContext& g = *GImGui;
     ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
     int cmd_count = draw_list->CmdBuffer.Size;
-    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
+    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().QuadCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open;
+    if (draw_list->QuadBuffer.Size > 0)
+        node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d quads, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->QuadBuffer.Size, cmd_count);
+    else
+        node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -14065,8 +16662,31 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
         }
 
         char buf[300];
-        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex 0x%p, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
-            pcmd->ElemCount / 3, (void*)(intptr_t)pcmd->TextureId,
+        if (pcmd->QuadCount != 0)
+        {
+            // Quad stream command: display individual quads. Hover on to get the corresponding rectangle highlighted.
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d quads, Tex 0x%p%s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+                pcmd->QuadCount, (void*)(intptr_t)pcmd->TextureId, pcmd->SdfText ? " (SDF)" : "",
+                pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+            if (!TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf))
+                continue;
+            ImGuiListClipper clipper;
+            clipper.Begin(pcmd->QuadCount);
+            while (clipper.Step())
+                for (int quad_n = clipper.DisplayStart; quad_n < clipper.DisplayEnd; quad_n++)
+                {
+                    const ImDrawQuad& quad = draw_list->QuadBuffer[pcmd->QuadOffset + quad_n];
+                    ImFormatString(buf, IM_ARRAYSIZE(buf), "quad %04d: pos (%8.2f,%8.2f)-(%8.2f,%8.2f), uv (%.6f,%.6f)-(%.6f,%.6f), col %08X",
+                        pcmd->QuadOffset + quad_n, quad.Min.x, quad.Min.y, quad.Max.x, quad.Max.y, quad.UvMin.x, quad.UvMin.y, quad.UvMax.x, quad.UvMax.y, quad.Col);
+                    Selectable(buf);
+                    if (IsItemHovered() && fg_draw_list)
+                        fg_draw_list->AddRect(quad.Min, quad.Max, IM_COL32(255, 255, 0, 255));
+                }
+            TreePop();
+            continue;
+        }
+        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex 0x%p%s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+            pcmd->ElemCount / 3, (void*)(intptr_t)pcmd->TextureId, pcmd->SdfText ? " (SDF)" : "",
             pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
         bool pcmd_node_open = TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
         if (IsItemHovered() && (cfg->ShowDrawCmdMesh || cfg->ShowDrawCmdBoundingBoxes) && fg_draw_list)
@@ -14187,8 +16807,8 @@ void ImGui::DebugNodeFont(ImFont* font)
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
         if (font->ConfigData)
             if (const ImFontConfig* cfg = &font->ConfigData[config_i])
-                BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Offset: (%.1f,%.1f)",
-                    config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->GlyphOffset.x, cfg->GlyphOffset.y);
+                BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d, Offset: (%.1f,%.1f)%s%s",
+                    config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH, cfg->GlyphOffset.x, cfg->GlyphOffset.y, cfg->PrebakedData ? ", Prebaked" : "", cfg->SignedDistanceField ? ", SDF" : "");
 
     // Display all glyphs of the fonts in separate pages of 256 characters
     if (TreeNode("Glyphs", "Glyphs (%d)", font->Glyphs.Size))
@@ -14352,6 +16972,8 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
 
     ImGuiWindowFlags flags = window->Flags;
     DebugNodeDrawList(window, window->DrawList, "DrawList");
+    if (window->DrawListsAppended.Size > 0)
+        BulletText("DrawListsAppended: %d (not displayed: may be in use by other threads)", window->DrawListsAppended.Size);
     BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), ContentSize (%.1f,%.1f) Ideal (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->ContentSize.x, window->ContentSize.y, window->ContentSizeIdeal.x, window->ContentSizeIdeal.y);
     BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
         (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
@@ -14766,6 +17388,11 @@ void ImGui::ShowStackToolWindow(bool* p_open)
 
 void ImGui::ShowMetricsWindow(bool*) {}
 void ImGui::ShowFontAtlas(ImFontAtlas*) {}
+void ImGui::DebugNodeAllocStats(const ImGuiAllocStats*) {}
+void ImGui::DebugNodeProfiler(ImGuiProfiler*) {}
+void ImGui::DebugNodeMetricsHistory(ImGuiMetricsHistory*) {}
+void ImGui::DebugNodeInputRecorder(ImGuiInputRecorder*) {}
+void ImGui::UpdateDebugMetricsHistory() {}
 void ImGui::DebugNodeColumns(ImGuiOldColumns*) {}
 void ImGui::DebugNodeDrawList(ImGuiWindow*, const ImDrawList*, const char*) {}
 void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList*, const ImDrawList*, const ImDrawCmd*, bool, bool) {}
@@ -136,21 +136,29 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
+struct ImDrawQuad;                  // A single axis-aligned textured rectangle record (min + max + uv min + uv max + col = 36 bytes), for backends supporting ImGuiBackendFlags_RendererHasQuadStream
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasVariant;          // Fonts of an atlas baked at another scale in the background, see ImFontAtlas::RequestBakedScale()
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontPrebakedData;          // Pre-rasterized glyphs of a font source (e.g. embedded default font), see AddFontDefault()
+struct ImGuiAllocStats;             // Allocation counters per subsystem, see GetAllocStats() (requires IMGUI_ENABLE_ALLOC_TRACKING)
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store per-item heights for ImGuiListClipper when items don't have the same height
+struct ImGuiTableSorter;            // Helper to maintain a sorted order of your rows according to a table sort specs
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotBuffer;             // Helper to store a large series of values to plot, with a min/max pyramid for fast downsampling
+struct ImGuiProfiler;               // Timing zones of the last frames recorded with IM_PROFILE_SCOPE(), see GetProfiler() (requires IMGUI_ENABLE_PROFILER)
 struct ImGuiPlatformImeData;        // Platform IME data for io.SetPlatformImeDataFn() function.
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
@@ -168,6 +176,7 @@ struct ImGuiViewport;               // A Platform Window (always only one in 'ma
 //   With Visual Assist installed: ALT+G ("VAssistX.GoToImplementation") can also follow symbols in comments.
 enum ImGuiKey : int;                // -> enum ImGuiKey              // Enum: A key identifier (ImGuiKey_XXX or ImGuiMod_XXX value)
 enum ImGuiMouseSource : int;        // -> enum ImGuiMouseSource      // Enum; A mouse input source identifier (Mouse, TouchScreen, Pen)
+typedef int ImGuiAllocTag;          // -> enum ImGuiAllocTag_        // Enum: A subsystem tag for allocation tracking
 typedef int ImGuiCol;               // -> enum ImGuiCol_             // Enum: A color identifier for styling
 typedef int ImGuiCond;              // -> enum ImGuiCond_            // Enum: A condition for many Set*() functions
 typedef int ImGuiDataType;          // -> enum ImGuiDataType_        // Enum: A primary data type
@@ -185,6 +194,8 @@ typedef int ImGuiTableBgTarget;     // -> enum ImGuiTableBgTarget_   // Enum: A
 typedef int ImDrawFlags;            // -> enum ImDrawFlags_          // Flags: for ImDrawList functions
 typedef int ImDrawListFlags;        // -> enum ImDrawListFlags_      // Flags: for ImDrawList instance
 typedef int ImFontAtlasFlags;       // -> enum ImFontAtlasFlags_     // Flags: for ImFontAtlas build
+typedef int ImFontAtlasPackMode;    // -> enum ImFontAtlasPackMode_  // Enum: A rectangle packing heuristic for ImFontAtlas::TexPackMode
+typedef int ImFontAtlasVariantStatus;// -> enum ImFontAtlasVariantStatus_// Enum: A state of ImFontAtlasVariant, for renderer backends
 typedef int ImGuiBackendFlags;      // -> enum ImGuiBackendFlags_    // Flags: for io.BackendFlags
 typedef int ImGuiButtonFlags;       // -> enum ImGuiButtonFlags_     // Flags: for InvisibleButton()
 typedef int ImGuiColorEditFlags;    // -> enum ImGuiColorEditFlags_  // Flags: for ColorEdit4(), ColorPicker4() etc.
@@ -245,6 +256,10 @@ typedef ImWchar16 ImWchar;
 // Callback and functions types
 typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);    // Callback function for ImGui::InputText()
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
+typedef float   (*ImGuiListClipperHeightCallback)(int item_n, void* user_data); // Callback function for ImGuiListClipperHeights: return height of an item, including item spacing
+typedef void    (*ImGuiTableRowCallback)(int row_n, void* user_data);           // Callback function for ImGui::TableVirtualRows(): submit contents of a row
+typedef int     (*ImGuiTableSortCompareFunc)(int row_a, int row_b, void* user_data); // Callback function for ImGuiTableSorter: compare two rows in ascending order, return <0, 0 or >0
+typedef void    (*ImFontAtlasBuildCallback)(ImFontAtlas* atlas, bool success, void* user_data); // Callback function for ImFontAtlas::BuildAsync(): called from NewFrame() once the new fonts are in use
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
 
@@ -642,6 +657,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));     // Cost is O(pixels) regardless of buffer size, spikes are preserved.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0)); // "
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -744,6 +761,14 @@ namespace ImGui
     IMGUI_API bool          TableNextColumn();                                  // append into the next column (or first column of next row if currently in last column). Return true when column is visible.
     IMGUI_API bool          TableSetColumnIndex(int column_n);                  // append into the specified column. Return true when column is visible.
 
+    // Tables: Virtualized rows
+    // - Submit a large number of rows while only processing visible ones: the table drives an ImGuiListClipper and calls 'render_row' for visible rows only,
+    //   after starting each of them with TableNextRow(row_flags, min_row_height). In 'render_row', use TableSetColumnIndex()/TableNextColumn()/TableSetBgColor() as usual.
+    // - Call after TableSetupScrollFreeze()/TableHeadersRow(): frozen rows are kept visible, and ImGuiTableFlags_RowBg alternation stays correct across skipped rows.
+    // - Rows are expected to have the same height. For rows of different heights, pass a persistent ImGuiListClipperHeights instance (it is resized to 'rows_count').
+    // - Per-frame cost only depends on the number of visible rows. Use 'row_n' to fetch your data, TableGetRowIndex() is not valid for skipped rows.
+    IMGUI_API void          TableVirtualRows(int rows_count, ImGuiTableRowCallback render_row, void* user_data = NULL, ImGuiTableRowFlags row_flags = 0, float min_row_height = 0.0f, ImGuiListClipperHeights* row_heights = NULL);
+
     // Tables: Headers & Columns declaration
     // - Use TableSetupColumn() to specify label, resizing policy, default width/weight, id, various other flags etc.
     // - Use TableHeadersRow() to create a header row and automatically submit a TableHeader() for each column.
@@ -864,6 +889,23 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendered one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
 
+    // Draw Lists built on other threads
+    // - An ImDrawList only reads from its ImDrawListSharedData and from the font atlas, so you can fill your own ImDrawList instances from worker threads
+    //   and hand them to Dear ImGui for rendering. Typical frame:
+    //     main thread, after NewFrame():  ImGui::UpdateDrawListSharedData(worker_shared_data);     // one ImDrawListSharedData per worker (created with CreateDrawListSharedData())
+    //     worker thread:                  ImDrawList* dl = worker_draw_list;                       // created with IM_NEW(ImDrawList)(worker_shared_data)
+    //                                     dl->_ResetForNewFrame(); dl->PushTextureID(io.Fonts->TexID); dl->PushClipRect(...); dl->AddXXX(...);
+    //     main thread, after joining:     ImGui::Begin("Hello"); ImGui::AppendWindowDrawList(worker_draw_list); ImGui::End();
+    // - Never share an ImDrawListSharedData between threads: it holds scratch buffers and caches which are written to while drawing. Copies are cheap.
+    // - Don't modify or rebuild the font atlas while worker threads are running.
+    // - Appended draw lists are referenced, not copied: keep them alive and unmodified until your renderer is done with the frame's ImDrawData.
+    IMGUI_API ImDrawListSharedData* CreateDrawListSharedData();                                 // create a copy of GetDrawListSharedData() which can be used by an ImDrawList on another thread.
+    IMGUI_API void          UpdateDrawListSharedData(ImDrawListSharedData* shared_data);        // refresh a copy made with CreateDrawListSharedData(). Call after NewFrame(): current font/size, clip rect and flags may change every frame.
+    IMGUI_API void          DestroyDrawListSharedData(ImDrawListSharedData* shared_data);
+    IMGUI_API void          AppendWindowDrawList(ImDrawList* draw_list);                        // render 'draw_list' after the contents of the current window (before its child windows). Must be called between Begin()/End().
+    IMGUI_API void          AppendBackgroundDrawList(ImDrawList* draw_list);                    // render 'draw_list' right after the background draw list (behind all windows).
+    IMGUI_API void          AppendForegroundDrawList(ImDrawList* draw_list);                    // render 'draw_list' right after the foreground draw list (over all windows).
+
     // Miscellaneous Utilities
     IMGUI_API bool          IsRectVisible(const ImVec2& size);                                  // test if rectangle (of given size, starting from cursor position) is visible / not clipped.
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
@@ -932,10 +974,44 @@ namespace ImGui
     IMGUI_API void          SaveIniSettingsToDisk(const char* ini_filename);                    // this is automatically called (if io.IniFilename is not empty) a few seconds after any modification that should be reflected in the .ini file (and also by DestroyContext).
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
 
+    // Settings/Binary Utilities
+    // - The disk functions are automatically called if io.IniBinaryFilename != NULL (default is NULL), in place of the .ini functions.
+    // - The binary file is a list of typed records (one per window, table etc.). Saving patches modified records in place and appends new ones instead of rewriting the whole file.
+    // - The .ini functions above still work as import/export: when the binary file cannot be loaded, io.IniFilename is loaded instead.
+    IMGUI_API bool          LoadBinarySettingsFromDisk(const char* filename);                   // return false if the file is missing or not a valid binary settings file.
+    IMGUI_API bool          LoadBinarySettingsFromMemory(const void* data, size_t data_size);   // call after CreateContext() and before the first call to NewFrame() to provide binary settings data from your own data source.
+    IMGUI_API void          SaveBinarySettingsToDisk(const char* filename);                     // this is automatically called (if io.IniBinaryFilename is not empty) a few seconds after any modification that should be reflected in the settings file (and also by DestroyContext).
+    IMGUI_API const void*   SaveBinarySettingsToMemory(size_t* out_data_size = NULL);           // return the binary settings data which you can save by your own mean.
+
     // Debug Utilities
     IMGUI_API void          DebugTextEncoding(const char* text);
     IMGUI_API bool          DebugCheckVersionAndDataLayout(const char* version_str, size_t sz_io, size_t sz_style, size_t sz_vec2, size_t sz_vec4, size_t sz_drawvert, size_t sz_drawidx); // This is called by IMGUI_CHECKVERSION() macro.
 
+    // Debug Utilities: Profiler
+    // - Record zones with IM_PROFILE_SCOPE() when '#define IMGUI_ENABLE_PROFILER' is set in imconfig.h. Otherwise nothing is recorded and exports are empty.
+    // - Exports contain the completed frames of the ring buffer. Returned pointers are valid until the next export.
+    IMGUI_API void          ProfilerBeginZone(const char* name);                                // prefer using IM_PROFILE_SCOPE(). 'name' is stored by pointer.
+    IMGUI_API void          ProfilerEndZone();
+    IMGUI_API ImGuiProfiler* GetProfiler();                                                     // recorded frames and settings (e.g. Paused) of the current context.
+    IMGUI_API const char*   ProfilerSaveChromeTraceToMemory(size_t* out_size = NULL);           // return zones as Chrome trace event JSON (open in chrome://tracing, ui.perfetto.dev or speedscope.app).
+    IMGUI_API const void*   ProfilerSaveCaptureToMemory(size_t* out_size = NULL);               // return zones as compact binary capture (format described in imgui.cpp).
+    IMGUI_API bool          ProfilerSaveToDisk(const char* filename);                           // save Chrome trace JSON if 'filename' ends with ".json", binary capture otherwise.
+
+    // Debug Utilities: Input Recording
+    // - Record the input events queue (io.AddXXXEvent() functions), io.DeltaTime and io.DisplaySize of each frame, and replay them later.
+    // - Replay overrides io.DeltaTime/io.DisplaySize and discards events submitted by the backend, until the last recorded frame or StopInputReplay().
+    // - Replay is deterministic if the application submits the same windows/widgets and starts from the same state (same .ini settings, fonts, style).
+    // - Inputs written directly to io (e.g. legacy io.MousePos, io.MouseDown[], io.KeysDown[] writes) don't go through the queue and are not recorded.
+    // - Headless replay: create a context, load the recording, then call NewFrame()/Render() in a loop while IsInputReplayActive() returns true.
+    IMGUI_API void          StartInputRecording();                                              // start recording from the next NewFrame(). Discards previous recording.
+    IMGUI_API void          StopInputRecording();
+    IMGUI_API const void*   SaveInputRecordingToMemory(size_t* out_size = NULL);                // return recording as compact binary data (format described in imgui.cpp). Valid until next call.
+    IMGUI_API bool          SaveInputRecordingToDisk(const char* filename);
+    IMGUI_API bool          LoadInputRecordingFromMemory(const void* data, size_t data_size);   // validate and start replaying from the next NewFrame(). Return false if data is invalid.
+    IMGUI_API bool          LoadInputRecordingFromDisk(const char* filename);
+    IMGUI_API void          StopInputReplay();
+    IMGUI_API bool          IsInputReplayActive();
+
     // Memory Allocators
     // - Those functions are not reliant on the current context.
     // - DLL users: heaps and globals are not shared across DLL boundaries! You will need to call SetCurrentContext() + SetAllocatorFunctions()
@@ -944,6 +1020,7 @@ namespace ImGui
     IMGUI_API void          GetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func, ImGuiMemFreeFunc* p_free_func, void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API const ImGuiAllocStats* GetAllocStats();                                               // per-subsystem live/peak bytes and per-frame allocation counts. Only updated when IMGUI_ENABLE_ALLOC_TRACKING is defined, otherwise all zero.
 
 } // namespace ImGui
 
@@ -1015,6 +1092,7 @@ enum ImGuiInputTextFlags_
     ImGuiInputTextFlags_CallbackResize      = 1 << 18,  // Callback on buffer capacity changes request (beyond 'buf_size' parameter value), allowing the string to grow. Notify when the string wants to be resized (for string types which hold a cache of their Size). You will be provided a new BufSize in the callback and NEED to honor it. (see misc/cpp/imgui_stdlib.h for an example of using this)
     ImGuiInputTextFlags_CallbackEdit        = 1 << 19,  // Callback on any edit (note that InputText() already returns true on edit, the callback is useful mainly to manipulate the underlying buffer while focus is active)
     ImGuiInputTextFlags_EscapeClearsAll     = 1 << 20,  // Escape key clears content if not empty, and deactivate otherwise (contrast to default behavior of Escape to revert)
+    ImGuiInputTextFlags_LargeText           = 1 << 21,  // For InputTextMultiline(): edit large texts (megabytes) with a cost per keystroke independent of text size. Text is stored in a gap buffer with a line index, only visible lines are rendered and 'buf' is patched in place instead of rewritten. 'buf' must not be modified while the widget is active. Not compatible with Password and CallbackCompletion/History/Always/Edit.
 
     // Obsolete names
     //ImGuiInputTextFlags_AlwaysInsertMode  = ImGuiInputTextFlags_AlwaysOverwrite   // [renamed in 1.82] name was not matching behavior
@@ -1514,6 +1592,9 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasQuadStream = 1 << 4,   // Backend Renderer supports ImDrawCmd::QuadOffset/QuadCount. Rectangles and glyphs are then output as ImDrawQuad records instead of 4 vertices + 6 indices each.
+    ImGuiBackendFlags_RendererHasSdfText    = 1 << 5,   // Backend Renderer supports ImDrawCmd::SdfText. This enables rendering of fonts built with ImFontConfig::SignedDistanceField.
+    ImGuiBackendFlags_RendererHasAtlasVariants = 1 << 6, // Backend Renderer uploads and releases textures of io.Fonts->Variants[] (see ImFontAtlasVariantStatus_), and (re)creates the texture of io.Fonts when its TexID is 0 (ImFontAtlas::Build() clears TexID without releasing the previous texture: backend needs to keep track of it). This enables ImFontAtlas::RequestBakedScale() and ImFontAtlas::BuildAsync().
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1740,6 +1821,20 @@ enum ImGuiCond_
     ImGuiCond_Appearing     = 1 << 3,   // Set the variable if the object/window is appearing after being hidden/inactive (or the first time)
 };
 
+// Enumeration for GetAllocStats()
+// Subsystem an allocation is attributed to. Tags are set by scopes inside Dear ImGui, the innermost scope wins.
+enum ImGuiAllocTag_
+{
+    ImGuiAllocTag_Misc,                 // Anything not covered by a more specific scope (including user calls to IM_ALLOC() outside of a frame)
+    ImGuiAllocTag_Windows,              // Window creation, window stacks and per-window storage
+    ImGuiAllocTag_DrawLists,            // Vertex/index buffers, draw commands and channels of ImDrawList/ImDrawListSplitter
+    ImGuiAllocTag_Tables,               // Tables, table columns and table temp data
+    ImGuiAllocTag_Fonts,                // Font atlas building, glyphs and lookup tables
+    ImGuiAllocTag_Settings,             // .ini loading/saving and settings entries
+    ImGuiAllocTag_InputText,            // InputText() edit state and buffers
+    ImGuiAllocTag_COUNT
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers: Memory allocations macros, ImVector<>
 //-----------------------------------------------------------------------------
@@ -1835,6 +1930,31 @@ struct ImVector
 };
 IM_MSVC_RUNTIME_CHECKS_RESTORE
 
+//-----------------------------------------------------------------------------
+// ImGuiAllocStats
+// Counters maintained by MemAlloc()/MemFree() when IMGUI_ENABLE_ALLOC_TRACKING is defined. Read with ImGui::GetAllocStats().
+// - Counters are global (not per-context), as allocators are.
+// - 'Frame' counters are reset by NewFrame(), the 'LastFrame' counters hold the values of the previous complete frame.
+//-----------------------------------------------------------------------------
+
+struct ImGuiAllocTagStats
+{
+    int         LiveCount;                  // Number of allocations currently alive
+    size_t      LiveBytes;                  // Bytes currently allocated (excluding tracking headers)
+    size_t      PeakBytes;                  // Highest value LiveBytes ever reached
+    int         FrameAllocCount;            // Number of allocations since last NewFrame()
+    size_t      FrameAllocBytes;            // Bytes allocated since last NewFrame()
+    int         LastFrameAllocCount;        // Value of FrameAllocCount at the end of the previous frame
+    size_t      LastFrameAllocBytes;        // Value of FrameAllocBytes at the end of the previous frame
+};
+
+struct ImGuiAllocStats
+{
+    ImGuiAllocTagStats  Tags[ImGuiAllocTag_COUNT];  // Indexed by ImGuiAllocTag_
+    ImGuiAllocTagStats  Total;                      // Sum of all tags (Total.PeakBytes is the actual peak of the sum, not the sum of peaks)
+    int                 FrameCount;                 // Number of frames seen by the tracker
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiStyle
 //-----------------------------------------------------------------------------
@@ -1923,6 +2043,7 @@ struct ImGuiIO
     float       DeltaTime;                      // = 1.0f/60.0f     // Time elapsed since last frame, in seconds. May change every frame.
     float       IniSavingRate;                  // = 5.0f           // Minimum time between saving positions/sizes to .ini file, in seconds.
     const char* IniFilename;                    // = "imgui.ini"    // Path to .ini file (important: default "imgui.ini" is relative to current working dir!). Set NULL to disable automatic .ini loading/saving or if you want to manually call LoadIniSettingsXXX() / SaveIniSettingsXXX() functions.
+    const char* IniBinaryFilename;              // = NULL           // Path to binary settings file. When set, it is used for automatic loading/saving instead of IniFilename, which is only read when the binary file cannot be loaded.
     const char* LogFilename;                    // = "imgui_log.txt"// Path to .log file (default parameter to ImGui::LogToFile when no file is specified).
     float       MouseDoubleClickTime;           // = 0.30f          // Time for a double-click, in seconds.
     float       MouseDoubleClickMaxDist;        // = 6.0f           // Distance threshold to stay in to validate a double-click, in pixels.
@@ -1949,6 +2070,7 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    int         ConfigMemoryCompactBudget;      // = 0              // Budget (in bytes) for transient windows/tables/text edit memory buffers. When exceeded, buffers of the least recently active windows/tables are freed first until back under budget. Set to 0 to disable.
 
     // Debug options
     // - tools to test correct Begin/End and BeginChild/EndChild behaviors.
@@ -1983,6 +2105,11 @@ struct ImGuiIO
     // Optional: Notify OS Input Method Editor of the screen position of your cursor for text input position (e.g. when using Japanese/Chinese IME on Windows)
     // (default to use native imm32 api on Windows)
     void        (*SetPlatformImeDataFn)(ImGuiViewport* viewport, ImGuiPlatformImeData* data);
+
+    // Optional: Write .ini file yourself when SaveIniSettingsToDisk() is called (e.g. to hand it to a background thread)
+    // (default to fopen/fwrite on the calling thread. 'ini_data' is only valid during the call: copy it if you write it later)
+    void        (*WriteIniFileFn)(void* user_data, const char* ini_filename, const char* ini_data, size_t ini_size);
+    void*       WriteIniFileUserData;
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     void*       ImeWindowHandle;                // = NULL           // [Obsolete] Set ImGuiViewport::PlatformHandleRaw instead. Set this to your HWND to get automatic IME cursor positioning.
 #else
@@ -2020,7 +2147,7 @@ struct ImGuiIO
     bool        WantCaptureKeyboard;                // Set when Dear ImGui will use keyboard inputs, in this case do not dispatch them to your main game/application (either way, always pass keyboard inputs to imgui). (e.g. InputText active, or an imgui window is focused and navigation is enabled, etc.).
     bool        WantTextInput;                      // Mobile/console: when set, you may display an on-screen keyboard. This is set by Dear ImGui when it wants textual keyboard input to happen (e.g. when a InputText widget is active).
     bool        WantSetMousePos;                    // MousePos has been altered, backend should reposition mouse on next frame. Rarely used! Set only when ImGuiConfigFlags_NavEnableSetMousePos flag is enabled.
-    bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
+    bool        WantSaveIniSettings;                // When manual .ini load/save is active (io.IniFilename == NULL and io.IniBinaryFilename == NULL), this will be set to notify your application that you can call SaveIniSettingsToMemory() and save yourself. Important: clear io.WantSaveIniSettings yourself after saving!
     bool        NavActive;                          // Keyboard/Gamepad navigation is currently allowed (will handle ImGuiKey_NavXXX events) = a window is focused and it doesn't use the ImGuiWindowFlags_NoNavInputs flag.
     bool        NavVisible;                         // Keyboard/Gamepad navigation is visible and allowed (will handle ImGuiKey_NavXXX events).
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
@@ -2028,7 +2155,7 @@ struct ImGuiIO
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
-    int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsActiveAllocations;           // Number of active allocations, updated (atomically) by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     // Legacy: before 1.87, we required backend to fill io.KeyMap[] (imgui->native map) during initialization and io.KeysDown[] (native indices) every frame.
@@ -2214,8 +2341,10 @@ struct ImGuiTextFilter
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API bool      PassFilterCached(int key, const char* text, const char* text_end = NULL); // Same as PassFilter(), result is cached for 'key' (e.g. index of a row, keep them small) until filter changes. Text for a given key must not change: call ClearCache() if it does.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
+    void                ClearCache()     { CachedResults.resize(0); }
     bool                IsActive() const { return !Filters.empty(); }
 
     // [Internal]
@@ -2232,6 +2361,7 @@ struct ImGuiTextFilter
     char                    InputBuf[256];
     ImVector<ImGuiTextRange>Filters;
     int                     CountGrep;
+    ImVector<ImU8>          CachedResults;  // For PassFilterCached(): 0 = unknown, 1 = fail, 2 = pass
 };
 
 // Helper: Growable text buffer for logging/accumulating text
@@ -2326,6 +2456,7 @@ struct ImGuiStorage
 // - Clipper calculate the actual range of elements to display based on the current clipping rectangle, position the cursor before the first visible element.
 // - User code submit visible elements.
 // - The clipper also handles various subtleties related to keyboard/gamepad navigation, wrapping etc.
+// Items of different heights (wrapped text, expandable rows...): use BeginVariableHeight() with a persistent ImGuiListClipperHeights instance, see below.
 struct ImGuiListClipper
 {
     ImGuiContext*   Ctx;                // Parent UI context
@@ -2333,6 +2464,7 @@ struct ImGuiListClipper
     int             DisplayEnd;         // End of items to display (exclusive)
     int             ItemsCount;         // [Internal] Number of items
     float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
+    ImGuiListClipperHeights* ItemsHeights; // [Internal] Per-item heights when using BeginVariableHeight(), otherwise NULL
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     void*           TempData;           // [Internal] Internal data
 
@@ -2341,6 +2473,7 @@ struct ImGuiListClipper
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  BeginVariableHeight(ImGuiListClipperHeights* items_heights); // Clip items of different heights. items_count is items_heights->Heights.Size: call items_heights->Resize() first.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2354,6 +2487,178 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Per-item heights for ImGuiListClipper::BeginVariableHeight().
+// Keep one instance alive alongside your list data, and call Resize() every frame before using the clipper (cheap when the count doesn't change).
+// - Heights include item spacing (distance from the top of an item to the top of the next one).
+// - Heights are either provided by you (HeightCallback, SetItemHeight()) or measured by the clipper when items are submitted.
+//   Items not known yet use DefaultHeight, so the scrollbar may slightly adjust as items get measured.
+//   When measuring, the clipper submits visible items one by one and measures them again every frame: rows which grow/shrink are picked up automatically.
+// - A Fenwick tree (binary indexed tree) of heights is maintained, so finding the items at a given scroll position and updating a height are O(log N).
+//   Scrolling through millions of items costs about the same as scrolling through a hundred.
+// Usage:
+//   static ImGuiListClipperHeights heights;
+//   heights.Resize(items.Size, ImGui::GetTextLineHeightWithSpacing());
+//   ImGuiListClipper clipper;
+//   clipper.BeginVariableHeight(&heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", items[i]);
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;                // Height of each item. Negative when not known yet (DefaultHeight is used).
+    ImVector<double>    Tree;                   // [Internal] Fenwick tree, 1-based: Tree[i] is the sum of heights of items [i - (i & -i), i)
+    float               DefaultHeight;          // Height used for items not known yet
+    ImGuiListClipperHeightCallback HeightCallback; // Optional: query heights of new/invalidated items instead of having the clipper measure them
+    void*               HeightCallbackUserData;
+
+    ImGuiListClipperHeights()                   { DefaultHeight = 0.0f; HeightCallback = NULL; HeightCallbackUserData = NULL; }
+    IMGUI_API void      Resize(int items_count, float default_height); // Added items are unknown (or queried from HeightCallback). O(log N) per added item, O(N) if default_height changed.
+    IMGUI_API void      Clear();                                       // Forget all heights
+    IMGUI_API void      SetItemHeight(int item_n, float height);       // O(log N)
+    IMGUI_API void      InvalidateItem(int item_n);                    // Forget height of an item which changed (queried again from HeightCallback, or measured again next time it is visible)
+    IMGUI_API double    GetItemOffset(int item_n) const;               // Sum of heights of items [0, item_n). O(log N)
+    IMGUI_API int       FindItemAtOffset(double offset) const;         // Index of the item covering 'offset' from the top of the list, clamped to [0, items_count - 1]. O(log N)
+    float               GetItemHeight(int item_n) const                { return Heights[item_n] >= 0.0f ? Heights[item_n] : DefaultHeight; }
+    bool                IsItemKnown(int item_n) const                  { return Heights[item_n] >= 0.0f; }
+    double              GetTotalHeight() const                         { return GetItemOffset(Heights.Size); }
+};
+
+// Helper: Maintain a sorted order of your rows according to the sort specs of a table, without sorting your data itself.
+// - Describe how to compare each sortable column with SetupColumn(): either a scalar stored in your rows (read from 'rows_data + row_n * row_stride + offset'),
+//   or a comparison callback (e.g. for strings). Column indices match ImGuiTableColumnSortSpecs::ColumnIndex.
+// - Call Sort() every frame after submitting headers. It only does work when something changed:
+//   - Sort specs changed: full sort. O(N log N)
+//   - Rows appended, or marked with MarkRowChanged(): changed rows are sorted and merged back in the existing order. O(K log N) comparisons + O(N) moves.
+//   - Rows removed or reordered: call MarkAllRowsChanged() (a smaller rows count is detected automatically).
+// - Multi-column sort specs are supported. Rows comparing equal are ordered by row index, so the order is stable and doesn't depend on history.
+// Usage:
+//   static ImGuiTableSorter sorter;
+//   sorter.SetupColumn(0, ImGuiDataType_S32, offsetof(MyItem, ID));
+//   sorter.SetupColumn(1, MyCompareNames, &items);
+//   sorter.Sort(ImGui::TableGetSortSpecs(), items.Size, items.Data, sizeof(MyItem));
+//   for (int n = 0; n < sorter.Indices.Size; n++)
+//       DrawRow(items[sorter.Indices[n]]);
+struct ImGuiTableSorterColumn
+{
+    ImGuiDataType               DataType;       // ImGuiDataType_COUNT when using a callback
+    int                         DataOffset;
+    ImGuiTableSortCompareFunc   CompareFunc;
+    void*                       CompareUserData;
+
+    ImGuiTableSorterColumn()    { DataType = ImGuiDataType_COUNT; DataOffset = 0; CompareFunc = NULL; CompareUserData = NULL; }
+};
+
+struct ImGuiTableSorter
+{
+    ImVector<int>                       Indices;        // Row indices in display order
+    ImVector<ImGuiTableSorterColumn>    Columns;        // [Internal] Per-column comparison, indexed by column index
+    ImVector<ImGuiTableColumnSortSpecs> Specs;          // [Internal] Copy of the sort specs Indices is sorted with
+    ImVector<int>                       ChangedRows;    // [Internal] Rows to re-insert on next Sort()
+    ImVector<ImU32>                     ChangedMask;    // [Internal] 1 bit per row, set for rows in ChangedRows
+    ImVector<int>                       TempBuffer;     // [Internal]
+    const void*                         RowsData;       // [Internal] Valid during Sort()
+    int                                 RowsStride;     // [Internal] Valid during Sort()
+    bool                                NeedFullSort;   // [Internal]
+
+    ImGuiTableSorter()                  { RowsData = NULL; RowsStride = 0; NeedFullSort = true; }
+    IMGUI_API void  SetupColumn(int column_n, ImGuiDataType data_type, int data_offset);                    // Column compares scalars stored in your rows
+    IMGUI_API void  SetupColumn(int column_n, ImGuiTableSortCompareFunc compare_func, void* user_data = NULL); // Column compares with a callback
+    IMGUI_API void  MarkRowChanged(int row_n);                                                               // Sort key(s) of a row changed
+    void            MarkAllRowsChanged()                { NeedFullSort = true; }                             // Rows were removed/reordered, or too many changed
+    IMGUI_API bool  Sort(ImGuiTableSortSpecs* sort_specs, int rows_count, const void* rows_data = NULL, int row_stride = 0); // Return true if Indices changed. Clears sort_specs->SpecsDirty.
+    IMGUI_API int   CompareRows(int row_a, int row_b) const;                                                 // [Internal] Compare two rows using Specs (never 0 for different rows)
+};
+
+// Helper: Store a large series of values to plot with PlotLines()/PlotHistogram(), e.g. samples of a signal or frame times.
+// - Values are stored in a ring buffer of fixed capacity: when full, PushBack() overwrites the oldest values.
+// - A min/max pyramid (1 entry per 4 values, then 1 per 2 entries of the level below) is updated on PushBack(),
+//   so the min/max of any range can be queried in O(log N). Plotting then costs O(pixels) and never misses a spike,
+//   where plotting a raw array reads every value to find the scale and skips values between pixels.
+// - NaN values are ignored by GetMinMax().
+// Usage:
+//   static ImGuiPlotBuffer samples(10000000);
+//   samples.PushBack(value);
+//   ImGui::PlotLines("Signal", &samples);
+struct ImGuiPlotBuffer
+{
+    ImVector<float>     Values;         // Storage, in ring buffer order (Values[Head] is the oldest value when full)
+    ImVector<ImVec2>    MinMax;         // [Internal] Min/max pyramid, all levels one after the other
+    ImVector<int>       LevelOffsets;   // [Internal] Offset of each level in MinMax[], with a last entry == MinMax.Size
+    int                 Count;          // Number of values, <= Values.Size
+    int                 Head;           // Index of oldest value in Values[]
+
+    ImGuiPlotBuffer(int capacity = 0)   { Count = Head = 0; if (capacity > 0) SetCapacity(capacity); }
+    IMGUI_API void      SetCapacity(int capacity);                                      // Also clears
+    void                Clear()         { SetCapacity(Values.Size); }
+    int                 GetCapacity() const { return Values.Size; }
+    void                PushBack(float v) { PushBack(&v, 1); }
+    IMGUI_API void      PushBack(const float* values, int values_count);
+    float               operator[](int idx) const { IM_ASSERT(idx >= 0 && idx < Count); idx += Head; return Values[idx >= Values.Size ? idx - Values.Size : idx]; } // 0 == oldest value
+    IMGUI_API bool      GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const; // Min/max of values in [idx_begin, idx_end). Return false if empty or all NaN.
+    static float        Getter(void* data, int idx) { return (*(const ImGuiPlotBuffer*)data)[idx]; }  // For use with the PlotLines()/PlotHistogram() getter versions
+};
+
+// Helper: Profiler, timing zones recorded with IM_PROFILE_SCOPE() (requires '#define IMGUI_ENABLE_PROFILER' in imconfig.h)
+// - A frame spans from one NewFrame() to the next, so it includes Render() and the work done by your renderer after it.
+//   The last FramesMax completed frames are kept in a ring buffer. Read with ImGui::GetProfiler(), visualize in the Metrics window.
+// - Zones must be recorded from the thread calling NewFrame(). Zones still open when NewFrame() is called are split over both frames.
+// - Names are stored by pointer: use string literals.
+// - Zone storage is reused from frame to frame: recording doesn't allocate once the ring buffer has filled up.
+// - IM_PROFILE_SCOPE() compiles to nothing when IMGUI_ENABLE_PROFILER is not defined.
+// Usage:
+//   void MyRenderFunction()
+//   {
+//       IM_PROFILE_SCOPE("MyRenderFunction");   // Time spent until the end of the enclosing C++ scope
+//       [...]
+//   }
+struct ImGuiProfilerZone
+{
+    const char*         Name;
+    ImU64               StartTicks;
+    ImU64               EndTicks;       // 0 while the zone is open
+    int                 Depth;          // Nesting level (0 for outer zones)
+};
+
+struct ImGuiProfilerFrame
+{
+    int                 FrameCount;     // Value of ImGui::GetFrameCount() during this frame
+    ImU64               StartTicks;
+    ImU64               EndTicks;       // 0 while the frame is being recorded
+    ImVector<ImGuiProfilerZone> Zones;  // In the order zones were opened: parents come before their children
+
+    ImGuiProfilerFrame()                { Clear(); }
+    void                Clear()         { FrameCount = 0; StartTicks = EndTicks = 0; Zones.resize(0); }
+};
+
+struct ImGuiProfiler
+{
+    bool                Paused;         // = false  // Stop adding frames to the ring buffer (e.g. to inspect a frame). Zones are still recorded, then discarded.
+    int                 FramesMax;      // = 120    // Number of completed frames kept. Changing it clears the ring buffer on the next NewFrame().
+    ImU64               TicksPerSecond; // Resolution of the clock used by all ticks values
+
+    // [Internal]
+    ImGuiProfilerFrame  Frame;          // Frame being recorded
+    ImVector<int>       ZoneStack;      // Open zones, as indices into Frame.Zones[]
+    ImVector<ImGuiProfilerFrame> Frames;// Ring buffer of completed frames (Frames[FramesHead] is the oldest when full)
+    int                 FramesCount;    // Number of completed frames, <= Frames.Size
+    int                 FramesHead;
+    ImGuiTextBuffer     ExportBuf;      // Output of ProfilerSaveChromeTraceToMemory()/ProfilerSaveCaptureToMemory()
+
+    ImGuiProfiler()     { Paused = false; FramesMax = 120; TicksPerSecond = 0; FramesCount = FramesHead = 0; }
+    const ImGuiProfilerFrame* GetFrame(int idx) const { IM_ASSERT(idx >= 0 && idx < FramesCount); idx += FramesHead; return &Frames[idx >= Frames.Size ? idx - Frames.Size : idx]; } // 0 == oldest completed frame
+};
+
+#ifdef IMGUI_ENABLE_PROFILER
+struct ImGuiProfileScope
+{
+    ImGuiProfileScope(const char* name) { ImGui::ProfilerBeginZone(name); }
+    ~ImGuiProfileScope()                { ImGui::ProfilerEndZone(); }
+};
+#define IM_PROFILE_SCOPE(_NAME)         ImGuiProfileScope im_profile_scope(_NAME)
+#else
+#define IM_PROFILE_SCOPE(_NAME)         ((void)0)
+#endif
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2454,16 +2759,25 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
-// - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
+// - QuadOffset/QuadCount: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasQuadStream' is enabled, a command may reference
+//   a range of ImDrawList::QuadBuffer[] instead of indexed triangles. A command never has both ElemCount and QuadCount != 0.
+// - SdfText: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasSdfText' is enabled, a command with SdfText != 0 samples glyphs of
+//   a ImFontConfig::SignedDistanceField font: the texture alpha is a distance to the glyph edge (128/255 on the edge, larger inside).
+//   The renderer needs to turn it into coverage, e.g. 'alpha = smoothstep(edge - w, edge + w, tex.a)' with 'w = fwidth(tex.a) * 0.5'.
+//   Such command may also contain other shapes using the white pixel (always fully inside), but never images.
+// - The ClipRect/TextureId/VtxOffset/SdfText fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
     ImVec4          ClipRect;           // 4*4  // Clipping rectangle (x1, y1, x2, y2). Subtract ImDrawData->DisplayPos to get clipping rectangle in "viewport" coordinates
     ImTextureID     TextureId;          // 4-8  // User-provided texture ID. Set by user in ImfontAtlas::SetTexID() for fonts or passed to Image*() functions. Ignore if never using images or multiple fonts atlas.
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
+    unsigned int    SdfText;            // 4    // != 0: texture alpha holds signed distances to threshold (see comments above). ImGuiBackendFlags_RendererHasSdfText only.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // The draw callback code can access this.
+    unsigned int    QuadOffset;         // 4    // Start offset in quad buffer. ImGuiBackendFlags_RendererHasQuadStream only.
+    unsigned int    QuadCount;          // 4    // Number of ImDrawQuad records to be rendered as rectangles (2 triangles each). Stored in the callee ImDrawList's QuadBuffer[] array.
 
     ImDrawCmd() { memset(this, 0, sizeof(*this)); } // Also ensure our padding fields are zeroed
 
@@ -2487,12 +2801,24 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Axis-aligned rectangle record, used instead of vertices when 'io.BackendFlags & ImGuiBackendFlags_RendererHasQuadStream' is enabled.
+// A renderer typically draws those as instances of a 4 vertices triangle strip: corner (x,y) gets position Min + (Max - Min) * (x,y) and uv UvMin + (UvMax - UvMin) * (x,y).
+struct ImDrawQuad
+{
+    ImVec2  Min;
+    ImVec2  Max;
+    ImVec2  UvMin;
+    ImVec2  UvMax;
+    ImU32   Col;
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
     ImVec4          ClipRect;
     ImTextureID     TextureId;
     unsigned int    VtxOffset;
+    unsigned int    SdfText;
 };
 
 // [Internal] For use by ImDrawListSplitter
@@ -2500,6 +2826,7 @@ struct ImDrawChannel
 {
     ImVector<ImDrawCmd>         _CmdBuffer;
     ImVector<ImDrawIdx>         _IdxBuffer;
+    ImVector<ImDrawQuad>        _QuadBuffer;
 };
 
 
@@ -2549,6 +2876,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowQuadStream         = 1 << 4,  // Can emit axis-aligned rectangles and glyphs into QuadBuffer. Set when 'ImGuiBackendFlags_RendererHasQuadStream' is enabled.
+    ImDrawListFlags_AllowSdfText            = 1 << 5,  // Can emit 'SdfText != 0' commands for signed distance field fonts. Set when 'ImGuiBackendFlags_RendererHasSdfText' is enabled.
 };
 
 // Draw command list
@@ -2566,6 +2895,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawQuad>    QuadBuffer;         // Quad buffer. Each command consume ImDrawCmd::QuadCount of those. Only used with ImDrawListFlags_AllowQuadStream.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -2574,6 +2904,7 @@ struct ImDrawList
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
     ImDrawVert*             _VtxWritePtr;       // [Internal] point within VtxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawIdx*              _IdxWritePtr;       // [Internal] point within IdxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
+    ImDrawQuad*             _QuadWritePtr;      // [Internal] point within QuadBuffer.Data after each add command
     ImVector<ImVec4>        _ClipRectStack;     // [Internal]
     ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
     ImVector<ImVec2>        _Path;              // [Internal] current path building
@@ -2612,6 +2943,7 @@ struct ImDrawList
     IMGUI_API void  AddCircleFilled(const ImVec2& center, float radius, ImU32 col, int num_segments = 0);
     IMGUI_API void  AddNgon(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness = 1.0f);
     IMGUI_API void  AddNgonFilled(const ImVec2& center, float radius, ImU32 col, int num_segments);
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centers, int centers_count, float radius, ImU32 col, int num_segments = 0); // Many filled circles of same radius/color (markers, dots). Tessellation is computed once and vertices are emitted in bulk.
     IMGUI_API void  AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL);
     IMGUI_API void  AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
     IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, ImDrawFlags flags, float thickness);
@@ -2667,6 +2999,13 @@ struct ImDrawList
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
+    // Advanced: Quad stream allocations (only when Flags & ImDrawListFlags_AllowQuadStream)
+    // - One ImDrawQuad record per axis-aligned rectangle, consumed directly by the renderer backend.
+    // - Quads and triangles are never mixed within a same ImDrawCmd: reserving one after the other will start a new command.
+    IMGUI_API void  PrimQuadReserve(int quad_count);
+    IMGUI_API void  PrimQuadUnreserve(int quad_count);
+    inline    void  PrimWriteQuad(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col) { _QuadWritePtr->Min = a; _QuadWritePtr->Max = c; _QuadWritePtr->UvMin = uv_a; _QuadWritePtr->UvMax = uv_c; _QuadWritePtr->Col = col; _QuadWritePtr++; }
+
     // Obsolete names
     //inline  void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0) { AddBezierCubic(p1, p2, p3, p4, col, thickness, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
     //inline  void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0) { PathBezierCubicCurveTo(p2, p3, p4, num_segments); } // OBSOLETED in 1.80 (Jan 2021)
@@ -2679,9 +3018,12 @@ struct ImDrawList
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
+    IMGUI_API void  _OnChangedSdfText();
+    inline    void  _SetSdfText(bool sdf_text)  { if (_CmdHeader.SdfText != (unsigned int)sdf_text) { _CmdHeader.SdfText = sdf_text; _OnChangedSdfText(); } }
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
+    IMGUI_API void  _PathCircleN(const ImVec2& center, float radius, int num_segments);
 };
 
 // All draw data to render a Dear ImGui frame
@@ -2693,6 +3035,7 @@ struct ImDrawData
     int             CmdListsCount;          // Number of ImDrawList* to render
     int             TotalIdxCount;          // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int             TotalVtxCount;          // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int             TotalQuadCount;         // For convenience, sum of all ImDrawList's QuadBuffer.Size
     ImDrawList**    CmdLists;               // Array of ImDrawList* to render. The ImDrawList are owned by ImGuiContext and only pointed to from here.
     ImVec2          DisplayPos;             // Top-left position of the viewport to render (== top-left of the orthogonal projection matrix to use) (== GetMainViewport()->Pos for the main viewport, == (0.0) in most single-viewport applications)
     ImVec2          DisplaySize;            // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
@@ -2728,10 +3071,13 @@ struct ImFontConfig
     unsigned int    FontBuilderFlags;       // 0        // Settings for custom font builder. THIS IS BUILDER IMPLEMENTATION DEPENDENT. Leave as zero if unsure.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            SignedDistanceField;    // false    // Rasterize glyphs as signed distance fields, which stay sharp when text is scaled (FontGlobalScale, SetWindowFontScale()). Prefer a large SizePixels (e.g. 32.0f), as thin strokes and corners get rounded off at small sizes. Requires ImGuiBackendFlags_RendererHasSdfText and the stb_truetype builder. OversampleH/V and RasterizerMultiply are ignored. Merged fonts need the same value.
+    int             SdfPadding;             // 4        // Distance field spread (in pixels) around each glyph with SignedDistanceField. Larger values allow more upscaling before edges degrade.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
     ImFont*         DstFont;
+    const ImFontPrebakedData* PrebakedData; // Pre-rasterized glyphs used instead of FontData (set by AddFontDefault() when settings match the embedded data)
 
     IMGUI_API ImFontConfig();
 };
@@ -2786,6 +3132,44 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
 };
 
+// Rectangle packing heuristic for ImFontAtlas::TexPackMode
+// The texture area is compared after applying the power-of-two height rounding (unless ImFontAtlasFlags_NoPowerOfTwoHeight is set).
+enum ImFontAtlasPackMode_
+{
+    ImFontAtlasPackMode_Default         = 0,        // Skyline bottom-left, custom rectangles first then each source font in turn. Fastest.
+    ImFontAtlasPackMode_SkylineBestFit  = 1,        // Skyline best-fit over all rectangles sorted by height.
+    ImFontAtlasPackMode_MaxRects        = 2,        // MaxRects bottom-left over all rectangles, trying several sort orders (height, area, longest side, perimeter, width) and keeping the smallest. Slower with many thousands of glyphs.
+    ImFontAtlasPackMode_Best            = 3,        // Try all of the above, and half/double texture width unless TexDesiredWidth is set, keeping the smallest texture. Slowest.
+    ImFontAtlasPackMode_COUNT
+};
+
+// State of an ImFontAtlasVariant, polled by the renderer backend in its NewFrame function (see ImGuiBackendFlags_RendererHasAtlasVariants)
+enum ImFontAtlasVariantStatus_
+{
+    ImFontAtlasVariantStatus_Building   = 0,        // Being built on a worker thread. Don't touch.
+    ImFontAtlasVariantStatus_Ready      = 1,        // Built. If Atlas->TexID == 0, backend should upload Atlas->GetTexDataAsXXX() and call Atlas->SetTexID(). NewFrame() swaps it in once TexID != 0.
+    ImFontAtlasVariantStatus_Discarded  = 2,        // Evicted. If Atlas->TexID != 0, backend should release the texture and call Atlas->SetTexID(0). The variant is then destroyed by the next NewFrame().
+};
+
+// Fonts of an ImFontAtlas baked at another scale, see ImFontAtlas::RequestBakedScale(), or being built by ImFontAtlas::BuildAsync()
+// The fonts and texture are held by a private atlas, whose glyphs and texture are swapped with the parent atlas ones when switching scale.
+struct ImFontAtlasVariant
+{
+    float                       Scale;              // Scale the glyphs and texture were baked at
+    ImFontAtlasVariantStatus    Status;             // See ImFontAtlasVariantStatus_
+    ImFontAtlas*                Atlas;              // Private atlas holding the glyphs and texture. Not built yet while Status == ImFontAtlasVariantStatus_Building.
+    int                         LastUsed;           // [Internal] For LRU eviction, see ImFontAtlas::VariantsMax
+    bool                        WantRGBA32;         // [Internal] Also convert texture to RGBA32 on the worker thread
+    bool                        WantDiscard;        // [Internal] Evicted while building: becomes ImFontAtlasVariantStatus_Discarded once built
+    bool                        IsBuildAsync;       // [Internal] Created by BuildAsync(): replaces the atlas output once ready, then holds the previous output until discarded
+    ImFontAtlasBuildCallback    BuildCallback;      // [Internal] See BuildAsync()
+    void*                       BuildCallbackUserData;
+    volatile int                WorkerDone;         // [Internal] Set by the worker thread once built
+    void*                       WorkerThread;       // [Internal] ImThreadHandle
+
+    ImFontAtlasVariant()        { memset(this, 0, sizeof(*this)); }
+};
+
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
 //  - One or more fonts.
 //  - Custom graphics data needed to render the shapes needed by Dear ImGui.
@@ -2824,6 +3208,7 @@ struct ImFontAtlas
     // Building in RGBA32 format is provided for convenience and compatibility, but note that unless you manually manipulate or copy color data into
     // the texture (e.g. when using the AddCustomRect*** api), then the RGB pixels emitted will always be white (~75% of memory/bandwidth waste.
     IMGUI_API bool              Build();                    // Build pixels data. This is called automatically for you by the GetTexData*** functions.
+    IMGUI_API void              BuildAsync(ImFontAtlasBuildCallback callback = NULL, void* user_data = NULL); // Build on a worker thread, the UI keeps running meanwhile. See "Asynchronous Build" below.
     IMGUI_API void              GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 1 byte per-pixel
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
@@ -2866,6 +3251,38 @@ struct ImFontAtlas
     IMGUI_API void              CalcCustomRectUV(const ImFontAtlasCustomRect* rect, ImVec2* out_uv_min, ImVec2* out_uv_max) const;
     IMGUI_API bool              GetMouseCursorTexData(ImGuiMouseCursor cursor, ImVec2* out_offset, ImVec2* out_size, ImVec2 out_uv_border[2], ImVec2 out_uv_fill[2]);
 
+    //-------------------------------------------
+    // Scale Variants (e.g. for multiple DPI)
+    //-------------------------------------------
+
+    // Keep the fonts baked at several scales, e.g. to get crisp text when moving to a monitor with a different DPI without a full rebuild.
+    // - RequestBakedScale() builds a variant on a worker thread, with SizePixels, GlyphOffset, GlyphExtraSpacing, GlyphMinAdvanceX/GlyphMaxAdvanceX of all ImFontConfig multiplied by 'scale'.
+    //   Until it is ready the current scale stays in use. The backend uploads its texture, then NewFrame() swaps it in. Requires ImGuiBackendFlags_RendererHasAtlasVariants.
+    // - ImFont pointers stay valid: their glyphs, FontSize, Ascent/Descent are swapped, as well as the texture and TexID. Compare BakedScale to know when to scale your style.
+    // - The scale previously in use is kept as a variant. Up to VariantsMax variants are kept, least recently used ones are discarded first.
+    // - Pixels of custom rectangles are copied from the current texture into new variants. Custom rectangles and their glyph metrics are not scaled.
+    // - Calling RequestBakedScale() before the first Build() makes it build at that scale directly.
+    // - Modifying font inputs (AddFont***, Clear***) discards all variants.
+    IMGUI_API void              RequestBakedScale(float scale);
+    IMGUI_API void              ClearVariants();            // Discard all variants. Wait for builds in progress.
+    bool                        IsBakedScalePending() const { return BakedScaleRequested != BakedScale; }
+
+    //-------------------------------------------
+    // Asynchronous Build
+    //-------------------------------------------
+
+    // Build without blocking the UI thread, e.g. after adding a large CJK font. Requires ImGuiBackendFlags_RendererHasAtlasVariants.
+    // - BuildAsync() rasterizes into a private atlas on a worker thread. Meanwhile, fonts which were already built keep their glyphs and texture,
+    //   fonts which have no glyphs yet use placeholder glyphs: those of a built font scaled to their size, or of the default font built right away if there are none.
+    // - Once built, the backend uploads the new texture, then NewFrame() replaces glyphs and texture (ImFont pointers stay valid) and calls 'callback' with success=true.
+    //   The previous texture is released by the backend through a discarded variant.
+    // - 'callback' is called with success=false if the build fails or is cancelled: by calling BuildAsync() again, or by modifying font inputs (AddFont***, Clear***),
+    //   which waits for the worker thread. Calling Build() completes it synchronously, 'callback' then gets the result of Build().
+    // - RequestBakedScale() calls made meanwhile are honored once the build is in use.
+    // - Loading the TTF file is not part of the build: for very large files consider loading the data yourself and passing it to AddFontFromMemoryTTF().
+    // - Pixels of custom rectangles are copied from the current texture data, if it wasn't cleared (note that AddFont*** clears it).
+    IMGUI_API bool              IsBuildAsyncPending() const;
+
     //-------------------------------------------
     // Members
     //-------------------------------------------
@@ -2873,9 +3290,13 @@ struct ImFontAtlas
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
+    ImFontAtlasPackMode         TexPackMode;        // Rectangle packing heuristic used by Build() (see ImFontAtlasPackMode_). Defaults to ImFontAtlasPackMode_Default. Other modes usually give a smaller texture at the cost of build time.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    float                       BakedScale;         // Scale of the current glyphs and texture (see RequestBakedScale()). Defaults to 1.0f.
+    float                       BakedScaleRequested;// Last scale passed to RequestBakedScale(), swapped in by NewFrame() once ready.
+    int                         VariantsMax;        // Maximum number of variants kept for fast switching, besides the current scale. Defaults to 3.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2885,6 +3306,7 @@ struct ImFontAtlas
     unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
     int                         TexWidth;           // Texture width calculated during Build().
     int                         TexHeight;          // Texture height calculated during Build().
+    int                         TexPackedSurface;   // Total area of packed rectangles (glyphs and custom rects, padding included) calculated during Build(). Fill ratio is TexPackedSurface / (TexWidth * TexHeight).
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
@@ -2900,6 +3322,10 @@ struct ImFontAtlas
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
 
+    // [Internal] Scale variants
+    ImVector<ImFontAtlasVariant*> Variants;         // Other scales, built or being built. Renderer backend uploads and releases their textures (see ImFontAtlasVariantStatus_).
+    int                         VariantsUseCounter; // Incremented on each use of a variant, for LRU eviction
+
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
     //typedef ImFontGlyphRangesBuilder GlyphRangesBuilder; // OBSOLETED in 1.67+
@@ -2929,6 +3355,7 @@ struct ImFont
     float                       EllipsisWidth;      // 4     // out               // Width
     float                       EllipsisCharStep;   // 4     // out               // Step between characters when EllipsisCount > 0
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        SignedDistanceField;// 1     // out //            // Glyphs are signed distance fields (ImFontConfig::SignedDistanceField), rendered through ImDrawCmd::SdfText commands.
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
@@ -489,6 +489,9 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasQuadStream", &io.BackendFlags, ImGuiBackendFlags_RendererHasQuadStream);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasSdfText",   &io.BackendFlags, ImGuiBackendFlags_RendererHasSdfText);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasAtlasVariants", &io.BackendFlags, ImGuiBackendFlags_RendererHasAtlasVariants);
             ImGui::EndDisabled();
             ImGui::TreePop();
             ImGui::Spacing();
@@ -1381,6 +1384,8 @@ static void ShowDemoWindowWidgets()
             ImGui::CheckboxFlags("ImGuiInputTextFlags_ReadOnly", &flags, ImGuiInputTextFlags_ReadOnly);
             ImGui::CheckboxFlags("ImGuiInputTextFlags_AllowTabInput", &flags, ImGuiInputTextFlags_AllowTabInput);
             ImGui::CheckboxFlags("ImGuiInputTextFlags_CtrlEnterForNewLine", &flags, ImGuiInputTextFlags_CtrlEnterForNewLine);
+            ImGui::CheckboxFlags("ImGuiInputTextFlags_LargeText", &flags, ImGuiInputTextFlags_LargeText);
+            ImGui::SameLine(); HelpMarker("Keep text in a gap buffer indexed by lines: editing, scrolling and rendering cost depend on visible lines rather than on total text size. Useful for multi-megabytes buffers.");
             ImGui::InputTextMultiline("##source", text, IM_ARRAYSIZE(text), ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), flags);
             ImGui::TreePop();
         }
@@ -1734,6 +1739,22 @@ static void ShowDemoWindowWidgets()
         float (*func)(void*, int) = (func_type == 0) ? Funcs::Sin : Funcs::Saw;
         ImGui::PlotLines("Lines", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0, 80));
+
+        // Large series: ImGuiPlotBuffer maintains a min/max pyramid as values are appended,
+        // so plotting costs O(pixels) and short spikes stay visible however many values are stored.
+        IMGUI_DEMO_MARKER("Widgets/Plotting/ImGuiPlotBuffer");
+        ImGui::SeparatorText("Large series (ImGuiPlotBuffer)");
+        static ImGuiPlotBuffer signal(1000000);
+        static int signal_phase = 0;
+        if (animate || signal.Count == 0)
+        {
+            float samples[5000];
+            for (int n = 0; n < IM_ARRAYSIZE(samples); n++, signal_phase++)
+                samples[n] = sinf(signal_phase * 0.0001f) * 0.5f + ((signal_phase % 49999) == 0 ? 1.0f : 0.0f); // 1 sample spike every ~50k samples
+            signal.PushBack(samples, IM_ARRAYSIZE(samples));
+        }
+        ImGui::PlotLines("Signal", &signal, NULL, -1.0f, 1.5f, ImVec2(0, 80));
+        ImGui::SameLine(); HelpMarker("Storing up to 1M values, 5000 new values per frame. Every ~50k values a single value spikes.");
         ImGui::Separator();
 
         // Animate a simple progress bar
@@ -4387,6 +4408,50 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Virtualized rows");
+    if (ImGui::TreeNode("Virtualized rows"))
+    {
+        HelpMarker("TableVirtualRows() drives the clipper for you and calls your function for visible rows only: the cost per frame doesn't depend on the number of rows.\n\nEvery 10th row is highlighted with TableSetBgColor(), every 25th row is taller: we pass an ImGuiListClipperHeights instance so rows of different heights are supported.");
+        static int rows_count = 1000000;
+        static ImGuiListClipperHeights row_heights;
+        PushStyleCompact();
+        ImGui::SetNextItemWidth(TEXT_BASE_WIDTH * 14);
+        ImGui::DragInt("Rows", &rows_count, 1000.0f, 0, 10000000);
+        PopStyleCompact();
+
+        struct Funcs
+        {
+            static void RenderRow(int row_n, void*)
+            {
+                if (row_n % 10 == 0)
+                    ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg1, IM_COL32(255, 200, 0, 40));
+                ImGui::TableSetColumnIndex(0);
+                ImGui::Text("%d", row_n);
+                ImGui::TableSetColumnIndex(1);
+                if (row_n % 25 == 0)
+                    ImGui::TextWrapped("Row %d has a longer description which is wrapped over multiple lines, so it is taller than the other rows.", row_n);
+                else
+                    ImGui::Text("Row %d", row_n);
+                ImGui::TableSetColumnIndex(2);
+                ImGui::Text("%08X", (unsigned int)row_n * 2654435761u);
+            }
+        };
+        ImVec2 outer_size = ImVec2(0.0f, TEXT_BASE_HEIGHT * 12);
+        if (ImGui::BeginTable("table_virtual_rows", 3, ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable, outer_size))
+        {
+            ImGui::TableSetupScrollFreeze(0, 1); // Make top row always visible
+            ImGui::TableSetupColumn("Index", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Description", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Hash", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableHeadersRow();
+            ImGui::TableVirtualRows(rows_count, Funcs::RenderRow, NULL, ImGuiTableRowFlags_None, 0.0f, &row_heights);
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Horizontal scrolling");
@@ -5197,6 +5262,74 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Sorting with ImGuiTableSorter");
+    if (ImGui::TreeNode("Sorting with ImGuiTableSorter"))
+    {
+        HelpMarker(
+            "ImGuiTableSorter keeps a sorted array of row indices instead of moving your data around. "
+            "Columns are compared using a data type + offset into your rows, or a callback.\n\n"
+            "When only a few rows change, call MarkRowChanged(): the next Sort() only re-inserts those rows "
+            "instead of sorting everything again.");
+        struct MyLiveItem { int ID; float Value; int NameIdx; };
+        static ImVector<MyLiveItem> items;
+        static ImGuiTableSorter sorter;
+        static bool live_update = true;
+        if (items.Size == 0)
+        {
+            items.resize(100000);
+            for (int n = 0; n < items.Size; n++)
+            {
+                items[n].ID = n;
+                items[n].Value = (float)((n * 7919) % 1000) * 0.1f;
+                items[n].NameIdx = n % IM_ARRAYSIZE(template_items_names);
+            }
+            sorter.SetupColumn(0, ImGuiDataType_S32, offsetof(MyLiveItem, ID));
+            sorter.SetupColumn(1, ImGuiDataType_Float, offsetof(MyLiveItem, Value));
+            struct Funcs { static int CompareName(int row_a, int row_b, void*) { return strcmp(template_items_names[items[row_a].NameIdx], template_items_names[items[row_b].NameIdx]); } };
+            sorter.SetupColumn(2, Funcs::CompareName);
+        }
+        ImGui::Checkbox("Update 10 rows per frame", &live_update);
+        if (live_update)
+            for (int n = 0; n < 10; n++)
+            {
+                const int row_n = ImGui::GetFrameCount() * 131 * (n + 1) % items.Size;
+                items[row_n].Value = (float)((items[row_n].ID * 7919 + ImGui::GetFrameCount() * 31) % 1000) * 0.1f;
+                sorter.MarkRowChanged(row_n);
+            }
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("table_sorter", 3, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15), 0.0f))
+        {
+            ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending | ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            // Sorts on specs changes, or re-inserts the rows marked as changed
+            sorter.Sort(ImGui::TableGetSortSpecs(), items.Size, items.Data, sizeof(MyLiveItem));
+
+            ImGuiListClipper clipper;
+            clipper.Begin(sorter.Indices.Size);
+            while (clipper.Step())
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const MyLiveItem* item = &items[sorter.Indices[row_n]];
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%06d", item->ID);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", item->Value);
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(template_items_names[item->NameIdx]);
+                }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     // In this example we'll expose most table flags and settings.
     // For specific flags and settings refer to the corresponding section for more detailed explanation.
     // This section is mostly useful to experiment with combining certain flags or settings with each others.
@@ -6050,6 +6183,9 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasQuadStream)  ImGui::Text(" RendererHasQuadStream");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasSdfText)     ImGui::Text(" RendererHasSdfText");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasAtlasVariants) ImGui::Text(" RendererHasAtlasVariants");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -6924,6 +7060,7 @@ struct ExampleAppLog
         Buf.clear();
         LineOffsets.clear();
         LineOffsets.push_back(0);
+        Filter.ClearCache();
     }
 
     void    AddLog(const char* fmt, ...) IM_FMTARGS(2)
@@ -6981,11 +7118,13 @@ struct ExampleAppLog
                 // This is because we don't have random access to the result of our filter.
                 // A real application processing logs with ten of thousands of entries may want to store the result of
                 // search/filter.. especially if the filtering function is not trivial (e.g. reg-exp).
+                // Completed lines never change so we let the filter cache their result by line number.
                 for (int line_no = 0; line_no < LineOffsets.Size; line_no++)
                 {
                     const char* line_start = buf + LineOffsets[line_no];
                     const char* line_end = (line_no + 1 < LineOffsets.Size) ? (buf + LineOffsets[line_no + 1] - 1) : buf_end;
-                    if (Filter.PassFilter(line_start, line_end))
+                    const bool line_complete = (line_no + 1 < LineOffsets.Size);
+                    if (line_complete ? Filter.PassFilterCached(line_no, line_start, line_end) : Filter.PassFilter(line_start, line_end))
                         ImGui::TextUnformatted(line_start, line_end);
                 }
             }
@@ -7232,7 +7371,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to TextWrapped(), variable height clipper\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -7268,6 +7408,24 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Multiple calls to TextWrapped(): lines have different heights, which are measured by the clipper as they become visible.
+            // Heights are re-measured every time a line is visible, so resizing the window (which changes wrapping) is handled.
+            static ImGuiListClipperHeights heights;
+            heights.Resize(lines, ImGui::GetTextLineHeightWithSpacing());
+            ImGuiListClipper clipper;
+            clipper.BeginVariableHeight(&heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if (i % 7 == 0)
+                        ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog. The five boxing wizards jump quickly. Pack my box with five dozen liquor jugs.", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+                }
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -381,6 +381,26 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Sin/cos are only evaluated the first time a given segment count is requested.
+const ImVec2* ImDrawListSharedData::GetCircleUnitVtx(int num_segments)
+{
+    IM_ASSERT(num_segments >= 3 && num_segments <= IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+    if (CircleUnitVtxOffsets.Size <= num_segments)
+        CircleUnitVtxOffsets.resize(IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX + 1, -1);
+    if (CircleUnitVtxOffsets[num_segments] < 0)
+    {
+        CircleUnitVtxOffsets[num_segments] = CircleUnitVtx.Size;
+        CircleUnitVtx.resize(CircleUnitVtx.Size + num_segments);
+        ImVec2* out = &CircleUnitVtx[CircleUnitVtxOffsets[num_segments]];
+        for (int i = 0; i < num_segments; i++)
+        {
+            const float a = ((float)i * 2 * IM_PI) / (float)num_segments;
+            out[i] = ImVec2(ImCos(a), ImSin(a));
+        }
+    }
+    return &CircleUnitVtx[CircleUnitVtxOffsets[num_segments]];
+}
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 void ImDrawList::_ResetForNewFrame()
 {
@@ -388,17 +408,20 @@ void ImDrawList::_ResetForNewFrame()
     IM_STATIC_ASSERT(IM_OFFSETOF(ImDrawCmd, ClipRect) == 0);
     IM_STATIC_ASSERT(IM_OFFSETOF(ImDrawCmd, TextureId) == sizeof(ImVec4));
     IM_STATIC_ASSERT(IM_OFFSETOF(ImDrawCmd, VtxOffset) == sizeof(ImVec4) + sizeof(ImTextureID));
+    IM_STATIC_ASSERT(IM_OFFSETOF(ImDrawCmd, SdfText) == sizeof(ImVec4) + sizeof(ImTextureID) + sizeof(unsigned int));
     if (_Splitter._Count > 1)
         _Splitter.Merge(this);
 
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    QuadBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
+    _QuadWritePtr = NULL;
     _ClipRectStack.resize(0);
     _TextureIdStack.resize(0);
     _Path.resize(0);
@@ -412,10 +435,12 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    QuadBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
+    _QuadWritePtr = NULL;
     _ClipRectStack.clear();
     _TextureIdStack.clear();
     _Path.clear();
@@ -428,17 +453,21 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->QuadBuffer = QuadBuffer;
     dst->Flags = Flags;
     return dst;
 }
 
 void ImDrawList::AddDrawCmd()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawLists);
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = _CmdHeader.ClipRect;    // Same as calling ImDrawCmd_HeaderCopy()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
+    draw_cmd.SdfText = _CmdHeader.SdfText;
     draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.QuadOffset = QuadBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -451,7 +480,7 @@ void ImDrawList::_PopUnusedDrawCmd()
     while (CmdBuffer.Size > 0)
     {
         ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-        if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL)
+        if (curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0 || curr_cmd->UserCallback != NULL)
             return;// break;
         CmdBuffer.pop_back();
     }
@@ -462,7 +491,7 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0)
     {
         AddDrawCmd();
         curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
@@ -473,11 +502,13 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
-// Compare ClipRect, TextureId and VtxOffset with a single memcmp()
-#define ImDrawCmd_HeaderSize                            (IM_OFFSETOF(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
-#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
-#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
+// Compare ClipRect, TextureId, VtxOffset and SdfText with a single memcmp()
+#define ImDrawCmd_HeaderSize                            (IM_OFFSETOF(ImDrawCmd, SdfText) + sizeof(unsigned int))
+#define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset, SdfText
+#define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset, SdfText
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
+#define ImDrawCmd_AreSequentialQuadOffset(CMD_0, CMD_1) (CMD_0->QuadOffset + CMD_0->QuadCount == CMD_1->QuadOffset)
+#define ImDrawCmd_AreSameKind(CMD_0, CMD_1)             ((CMD_0->QuadCount == 0 && CMD_1->QuadCount == 0) || (CMD_0->ElemCount == 0 && CMD_1->ElemCount == 0)) // Triangles and quads never share a command
 
 // Try to merge two last draw commands
 void ImDrawList::_TryMergeDrawCmds()
@@ -485,9 +516,10 @@ void ImDrawList::_TryMergeDrawCmds()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreSequentialQuadOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreSameKind(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
     {
         prev_cmd->ElemCount += curr_cmd->ElemCount;
+        prev_cmd->QuadCount += curr_cmd->QuadCount;
         CmdBuffer.pop_back();
     }
 }
@@ -499,7 +531,7 @@ void ImDrawList::_OnChangedClipRect()
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0) && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
     {
         AddDrawCmd();
         return;
@@ -508,7 +540,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreSequentialQuadOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -519,10 +551,13 @@ void ImDrawList::_OnChangedClipRect()
 
 void ImDrawList::_OnChangedTextureID()
 {
+    // Distance field glyphs only live in the font atlas: a texture change always ends a SdfText sequence.
+    _CmdHeader.SdfText = 0;
+
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && curr_cmd->TextureId != _CmdHeader.TextureId)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0) && (curr_cmd->TextureId != _CmdHeader.TextureId || curr_cmd->SdfText != 0))
     {
         AddDrawCmd();
         return;
@@ -531,13 +566,39 @@ void ImDrawList::_OnChangedTextureID()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreSequentialQuadOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
     }
 
     curr_cmd->TextureId = _CmdHeader.TextureId;
+    curr_cmd->SdfText = 0;
+}
+
+// SdfText is set by ImFont::RenderText() for distance field fonts. It is left enabled after the text so following shapes using the
+// white pixel (which reads as fully inside) can share the command, and cleared by functions sampling other parts of the texture.
+void ImDrawList::_OnChangedSdfText()
+{
+    // If current command is used with different settings we need to add a new command
+    IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0) && curr_cmd->SdfText != _CmdHeader.SdfText)
+    {
+        AddDrawCmd();
+        return;
+    }
+    IM_ASSERT(curr_cmd->UserCallback == NULL);
+
+    // Try to merge with previous command if it matches, else use current command
+    ImDrawCmd* prev_cmd = curr_cmd - 1;
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_AreSequentialQuadOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    {
+        CmdBuffer.pop_back();
+        return;
+    }
+
+    curr_cmd->SdfText = _CmdHeader.SdfText;
 }
 
 void ImDrawList::_OnChangedVtxOffset()
@@ -547,7 +608,7 @@ void ImDrawList::_OnChangedVtxOffset()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     //IM_ASSERT(curr_cmd->VtxOffset != _CmdHeader.VtxOffset); // See #3349
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->QuadCount != 0)
     {
         AddDrawCmd();
         return;
@@ -617,6 +678,7 @@ void ImDrawList::PopTextureID()
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawLists);
     // Large mesh support (when enabled)
     IM_ASSERT_PARANOID(idx_count >= 0 && vtx_count >= 0);
     if (sizeof(ImDrawIdx) == 2 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
@@ -629,6 +691,12 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     }
 
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->QuadCount != 0)
+    {
+        // Triangles can't be appended to a quad stream command
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
@@ -651,6 +719,40 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
 
+// Reserve space for a number of ImDrawQuad records, written with PrimWriteQuad(). Requires ImDrawListFlags_AllowQuadStream.
+// Like indices, quads are stored per channel, so the range of the last command always ends at QuadBuffer.Size.
+void ImDrawList::PrimQuadReserve(int quad_count)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawLists);
+    IM_ASSERT_PARANOID(quad_count >= 0);
+    IM_ASSERT_PARANOID(Flags & ImDrawListFlags_AllowQuadStream);
+
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->ElemCount != 0)
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
+    if (draw_cmd->QuadCount == 0)
+        draw_cmd->QuadOffset = QuadBuffer.Size;
+    IM_ASSERT_PARANOID(draw_cmd->QuadOffset + draw_cmd->QuadCount == (unsigned int)QuadBuffer.Size);
+    draw_cmd->QuadCount += quad_count;
+
+    int quad_buffer_old_size = QuadBuffer.Size;
+    QuadBuffer.resize(quad_buffer_old_size + quad_count);
+    _QuadWritePtr = QuadBuffer.Data + quad_buffer_old_size;
+}
+
+// Release a number of reserved quads from the end of the last reservation made with PrimQuadReserve().
+void ImDrawList::PrimQuadUnreserve(int quad_count)
+{
+    IM_ASSERT_PARANOID(quad_count >= 0);
+
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    draw_cmd->QuadCount -= quad_count;
+    QuadBuffer.shrink(QuadBuffer.Size - quad_count);
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
@@ -733,6 +835,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
         IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+        if (use_texture)
+            _SetSdfText(false); // Baked lines are coverage, not distances
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
@@ -1148,6 +1252,34 @@ void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, fl
     // Note that we are adding a point at both a_min and a_max.
     // If you are trying to draw a full closed circle you don't want the overlapping points!
     _Path.reserve(_Path.Size + (num_segments + 1));
+
+    // When the arc starts on a sample of a circle of 'circle_segments' points and steps by one sample (e.g. rounded rectangle corners
+    // or arcs starting at 0 with an explicit segment count), read cached unit circle samples instead of calling sin/cos per point.
+    const float a_step = (a_max - a_min) / (float)num_segments;
+    const float circle_segments_f = (a_step != 0.0f) ? (2.0f * IM_PI) / ImAbs(a_step) : 0.0f;
+    const int circle_segments = (int)(circle_segments_f + 0.5f);
+    if (circle_segments >= 3 && circle_segments <= IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX && ImAbs(circle_segments_f - (float)circle_segments) < 1e-3f)
+    {
+        const float a_min_sample_f = a_min * (float)circle_segments / (2.0f * IM_PI);
+        const int a_min_sample = (int)ImFloorSigned(a_min_sample_f + 0.5f);
+        if (ImAbs(a_min_sample_f - (float)a_min_sample) < 1e-3f)
+        {
+            const ImVec2* unit_vtx = _Data->GetCircleUnitVtx(circle_segments);
+            const int sample_step = (a_step > 0.0f) ? 1 : circle_segments - 1;
+            int sample = a_min_sample % circle_segments;
+            if (sample < 0)
+                sample += circle_segments;
+            ImVec2* out = _Path.Data + _Path.Size;
+            for (int i = 0; i <= num_segments; i++)
+            {
+                out[i] = ImVec2(center.x + unit_vtx[sample].x * radius, center.y + unit_vtx[sample].y * radius);
+                sample = (sample + sample_step) % circle_segments;
+            }
+            _Path.Size += num_segments + 1;
+            return;
+        }
+    }
+
     for (int i = 0; i <= num_segments; i++)
     {
         const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
@@ -1155,6 +1287,23 @@ void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, fl
     }
 }
 
+// Full circle of 'num_segments' points (no duplicate closing point), using cached unit circle samples
+void ImDrawList::_PathCircleN(const ImVec2& center, float radius, int num_segments)
+{
+    if (radius < 0.5f)
+    {
+        _Path.push_back(center);
+        return;
+    }
+
+    const ImVec2* unit_vtx = _Data->GetCircleUnitVtx(num_segments);
+    _Path.reserve(_Path.Size + num_segments);
+    ImVec2* out = _Path.Data + _Path.Size;
+    for (int i = 0; i < num_segments; i++)
+        out[i] = ImVec2(center.x + unit_vtx[i].x * radius, center.y + unit_vtx[i].y * radius);
+    _Path.Size += num_segments;
+}
+
 // 0: East, 3: South, 6: West, 9: North, 12: East
 void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_12, int a_max_of_12)
 {
@@ -1400,6 +1549,13 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
         return;
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
+        // Only start a quad stream command if it doesn't break the current triangle command (which would cost an extra draw call)
+        if ((Flags & ImDrawListFlags_AllowQuadStream) && CmdBuffer.Data[CmdBuffer.Size - 1].ElemCount == 0)
+        {
+            PrimQuadReserve(1);
+            PrimWriteQuad(p_min, p_max, _Data->TexUvWhitePixel, _Data->TexUvWhitePixel, col);
+            return;
+        }
         PrimReserve(6, 4);
         PrimRect(p_min, p_max, col);
     }
@@ -1487,10 +1643,7 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
     {
         // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
         num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
-
-        // Because we are filling a closed shape we remove 1 from the count of segments/points
-        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-        PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
+        _PathCircleN(center, radius - 0.5f, num_segments);
     }
 
     PathStroke(col, ImDrawFlags_Closed, thickness);
@@ -1511,10 +1664,7 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     {
         // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
         num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
-
-        // Because we are filling a closed shape we remove 1 from the count of segments/points
-        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-        PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+        _PathCircleN(center, radius, num_segments);
     }
 
     PathFillConvex(col);
@@ -1526,9 +1676,16 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
+    if (num_segments <= IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX)
+    {
+        _PathCircleN(center, radius - 0.5f, num_segments);
+    }
+    else
+    {
+        // Because we are filling a closed shape we remove 1 from the count of segments/points
+        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+        PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
+    }
     PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
@@ -1538,12 +1695,114 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+    if (num_segments <= IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX)
+    {
+        _PathCircleN(center, radius, num_segments);
+    }
+    else
+    {
+        // Because we are filling a closed shape we remove 1 from the count of segments/points
+        const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+        PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+    }
     PathFillConvex(col);
 }
 
+// Equivalent to calling AddCircleFilled() for each center, but tessellation and AA fringe offsets are computed once,
+// and vertices are written straight from the cached unit circle instead of going through the path + AddConvexPolyFilled().
+// For a regular polygon the averaged edge normals computed by AddConvexPolyFilled() are radial with a length of cos(PI/N),
+// so the AA fringe is obtained by scaling the unit circle by 'radius -/+ fringe_offset'.
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centers, int centers_count, float radius, ImU32 col, int num_segments)
+{
+    if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f || centers_count <= 0)
+        return;
+
+    num_segments = (num_segments <= 0) ? _CalcCircleAutoSegmentCount(radius) : num_segments;
+    num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+    const ImVec2* unit_vtx = _Data->GetCircleUnitVtx(num_segments);
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+
+    const int idx_count = anti_aliased ? (num_segments - 2) * 3 + num_segments * 6 : (num_segments - 2) * 3;
+    const int vtx_count = anti_aliased ? num_segments * 2 : num_segments;
+    const int circles_per_reserve = (sizeof(ImDrawIdx) == 2) ? ImMax(1, 0xFFFF / vtx_count) : centers_count;
+
+    float radius_inner = radius, radius_outer = radius;
+    if (anti_aliased)
+    {
+        const float fringe_offset = _FringeScale * 0.5f / ImCos(IM_PI / (float)num_segments);
+        radius_inner = radius - fringe_offset;
+        radius_outer = radius + fringe_offset;
+    }
+    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+
+    for (int batch_start = 0; batch_start < centers_count; batch_start += circles_per_reserve)
+    {
+        const int batch_count = ImMin(circles_per_reserve, centers_count - batch_start);
+        PrimReserve(idx_count * batch_count, vtx_count * batch_count);
+        for (int circle_n = batch_start; circle_n < batch_start + batch_count; circle_n++)
+        {
+            const ImVec2 center = centers[circle_n];
+            const unsigned int vtx_inner_idx = _VtxCurrentIdx;
+            if (anti_aliased)
+            {
+                // Vertices: [inner, outer] pairs
+                ImDrawVert* vtx = _VtxWritePtr;
+#ifdef IMGUI_ENABLE_SSE
+                const __m128 radii = _mm_setr_ps(radius_inner, radius_inner, radius_outer, radius_outer);
+                const __m128 offset = _mm_setr_ps(center.x, center.y, center.x, center.y);
+                for (int i = 0; i < num_segments; i++, vtx += 2)
+                {
+                    __m128 unit = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)(const void*)&unit_vtx[i]);
+                    __m128 pos = _mm_add_ps(_mm_mul_ps(_mm_movelh_ps(unit, unit), radii), offset);
+                    _mm_storel_pi((__m64*)(void*)&vtx[0].pos, pos);
+                    _mm_storeh_pi((__m64*)(void*)&vtx[1].pos, pos);
+                    vtx[0].uv = uv; vtx[0].col = col;
+                    vtx[1].uv = uv; vtx[1].col = col_trans;
+                }
+#else
+                for (int i = 0; i < num_segments; i++, vtx += 2)
+                {
+                    vtx[0].pos.x = center.x + unit_vtx[i].x * radius_inner; vtx[0].pos.y = center.y + unit_vtx[i].y * radius_inner; vtx[0].uv = uv; vtx[0].col = col;
+                    vtx[1].pos.x = center.x + unit_vtx[i].x * radius_outer; vtx[1].pos.y = center.y + unit_vtx[i].y * radius_outer; vtx[1].uv = uv; vtx[1].col = col_trans;
+                }
+#endif
+                _VtxWritePtr = vtx;
+
+                // Indices: same layout as AddConvexPolyFilled()
+                const unsigned int vtx_outer_idx = vtx_inner_idx + 1;
+                ImDrawIdx* idx = _IdxWritePtr;
+                for (int i = 2; i < num_segments; i++, idx += 3)
+                {
+                    idx[0] = (ImDrawIdx)(vtx_inner_idx); idx[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); idx[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
+                }
+                for (int i0 = num_segments - 1, i1 = 0; i1 < num_segments; i0 = i1++, idx += 6)
+                {
+                    idx[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); idx[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); idx[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+                    idx[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); idx[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); idx[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+                }
+                _IdxWritePtr = idx;
+            }
+            else
+            {
+                ImDrawVert* vtx = _VtxWritePtr;
+                for (int i = 0; i < num_segments; i++, vtx++)
+                {
+                    vtx->pos.x = center.x + unit_vtx[i].x * radius; vtx->pos.y = center.y + unit_vtx[i].y * radius; vtx->uv = uv; vtx->col = col;
+                }
+                _VtxWritePtr = vtx;
+                ImDrawIdx* idx = _IdxWritePtr;
+                for (int i = 2; i < num_segments; i++, idx += 3)
+                {
+                    idx[0] = (ImDrawIdx)(vtx_inner_idx); idx[1] = (ImDrawIdx)(vtx_inner_idx + i - 1); idx[2] = (ImDrawIdx)(vtx_inner_idx + i);
+                }
+                _IdxWritePtr = idx;
+            }
+            _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        }
+    }
+}
+
 // Cubic Bezier takes 4 controls points
 void ImDrawList::AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments)
 {
@@ -1608,9 +1867,18 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
         PushTextureID(user_texture_id);
+    _SetSdfText(false);
 
-    PrimReserve(6, 4);
-    PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    if ((Flags & ImDrawListFlags_AllowQuadStream) && CmdBuffer.Data[CmdBuffer.Size - 1].ElemCount == 0)
+    {
+        PrimQuadReserve(1);
+        PrimWriteQuad(p_min, p_max, uv_min, uv_max, col);
+    }
+    else
+    {
+        PrimReserve(6, 4);
+        PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+    }
 
     if (push_texture_id)
         PopTextureID();
@@ -1624,6 +1892,7 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
         PushTextureID(user_texture_id);
+    _SetSdfText(false);
 
     PrimReserve(6, 4);
     PrimQuadUV(p1, p2, p3, p4, uv1, uv2, uv3, uv4, col);
@@ -1647,6 +1916,7 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
         PushTextureID(user_texture_id);
+    _SetSdfText(false);
 
     int vert_start_idx = VtxBuffer.Size;
     PathRect(p_min, p_max, rounding, flags);
@@ -1673,6 +1943,7 @@ void ImDrawListSplitter::ClearFreeMemory()
             memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
         _Channels[i]._CmdBuffer.clear();
         _Channels[i]._IdxBuffer.clear();
+        _Channels[i]._QuadBuffer.clear();
     }
     _Current = 0;
     _Count = 1;
@@ -1681,6 +1952,7 @@ void ImDrawListSplitter::ClearFreeMemory()
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawLists);
     IM_UNUSED(draw_list);
     IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
     int old_channels_count = _Channels.Size;
@@ -1691,7 +1963,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     }
     _Count = channels_count;
 
-    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
+    // Channels[] (36/48 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer/_QuadBuffer
     // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
     // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
     memset(&_Channels[0], 0, sizeof(ImDrawChannel));
@@ -1705,12 +1977,14 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
         {
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
+            _Channels[i]._QuadBuffer.resize(0);
         }
     }
 }
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_DrawLists);
     // Note that we never use or rely on _Channels.Size because it is merely a buffer that we never shrink back to 0 to keep all sub-buffers ready for use.
     if (_Count <= 1)
         return;
@@ -1718,53 +1992,66 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes (commands count is an upper bound, as some may be merged below).
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+    int new_quad_buffer_count = 0;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().QuadCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
+        new_quad_buffer_count += ch._QuadBuffer.Size;
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    const int old_cmd_buffer_count = draw_list->CmdBuffer.Size;
+    int idx_offset = (old_cmd_buffer_count > 0) ? draw_list->CmdBuffer.back().IdxOffset + draw_list->CmdBuffer.back().ElemCount : 0;
+    int quad_offset = draw_list->QuadBuffer.Size;
+    draw_list->CmdBuffer.resize(old_cmd_buffer_count + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    draw_list->QuadBuffer.resize(draw_list->QuadBuffer.Size + new_quad_buffer_count);
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices).
+    // This is done in a single pass over channels, skipping empty ones, fixing IdxOffset/QuadOffset values as we write commands.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + old_cmd_buffer_count;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawQuad* quad_write = draw_list->QuadBuffer.Data + draw_list->QuadBuffer.Size - new_quad_buffer_count;
+    ImDrawCmd* last_cmd = (old_cmd_buffer_count > 0) ? cmd_write - 1 : NULL;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        if (ch._CmdBuffer.Size == 0)
+            continue;
+        const ImDrawCmd* src_cmd = ch._CmdBuffer.Data;
+        const ImDrawCmd* src_cmd_end = src_cmd + ch._CmdBuffer.Size;
+
+        // Merge previous channel last draw command with current channel first draw command if matching.
+        // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
+        // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+        if (last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, src_cmd) == 0 && ImDrawCmd_AreSameKind(last_cmd, src_cmd) && last_cmd->UserCallback == NULL && src_cmd->UserCallback == NULL)
+        {
+            last_cmd->ElemCount += src_cmd->ElemCount;
+            last_cmd->QuadCount += src_cmd->QuadCount;
+            idx_offset += src_cmd->ElemCount;
+            quad_offset += src_cmd->QuadCount;
+            src_cmd++;
+        }
+        for (; src_cmd < src_cmd_end; src_cmd++)
+        {
+            *cmd_write = *src_cmd;
+            cmd_write->IdxOffset = idx_offset;
+            cmd_write->QuadOffset = quad_offset;
+            idx_offset += src_cmd->ElemCount;
+            quad_offset += src_cmd->QuadCount;
+            last_cmd = cmd_write++;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        if (int sz = ch._QuadBuffer.Size) { memcpy(quad_write, ch._QuadBuffer.Data, sz * sizeof(ImDrawQuad)); quad_write += sz; }
     }
+    draw_list->CmdBuffer.resize((int)(cmd_write - draw_list->CmdBuffer.Data)); // Trim slots of merged commands
     draw_list->_IdxWritePtr = idx_write;
+    draw_list->_QuadWritePtr = quad_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
     if (draw_list->CmdBuffer.Size == 0 || draw_list->CmdBuffer.back().UserCallback != NULL)
@@ -1772,8 +2059,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0)
-        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
+    if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0)
+        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset, SdfText
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 
@@ -1786,20 +2073,23 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     if (_Current == idx)
         return;
 
-    // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
+    // Overwrite ImVector (12/16 bytes), six times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&_Channels.Data[_Current]._QuadBuffer, &draw_list->QuadBuffer, sizeof(draw_list->QuadBuffer));
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&draw_list->QuadBuffer, &_Channels.Data[idx]._QuadBuffer, sizeof(draw_list->QuadBuffer));
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    draw_list->_QuadWritePtr = draw_list->QuadBuffer.Data + draw_list->QuadBuffer.Size;
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = (draw_list->CmdBuffer.Size == 0) ? NULL : &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
-    else if (curr_cmd->ElemCount == 0)
-        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
+    else if (curr_cmd->ElemCount == 0 && curr_cmd->QuadCount == 0)
+        ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset, SdfText
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 }
@@ -1809,6 +2099,7 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
 //-----------------------------------------------------------------------------
 
 // For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
+// Quads are not converted: a renderer using this should not set ImGuiBackendFlags_RendererHasQuadStream.
 void ImDrawData::DeIndexAllBuffers()
 {
     ImVector<ImDrawVert> new_vtx_buffer;
@@ -1816,6 +2107,7 @@ void ImDrawData::DeIndexAllBuffers()
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
+        IM_ASSERT(cmd_list->QuadBuffer.Size == 0 && "DeIndexAllBuffers() doesn't support the quad stream. Clear ImGuiBackendFlags_RendererHasQuadStream.");
         if (cmd_list->IdxBuffer.empty())
             continue;
         new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
@@ -1909,6 +2201,7 @@ ImFontConfig::ImFontConfig()
     GlyphMaxAdvanceX = FLT_MAX;
     RasterizerMultiply = 1.0f;
     EllipsisChar = (ImWchar)-1;
+    SdfPadding = 4;
 }
 
 //-----------------------------------------------------------------------------
@@ -1965,10 +2258,14 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(109,0),ImVec2(13,15), ImVec2( 6, 7) }, // ImGuiMouseCursor_NotAllowed
 };
 
+static void ImFontAtlasDestroyVariant(ImFontAtlasVariant* variant);
+
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
+    BakedScale = BakedScaleRequested = 1.0f;
+    VariantsMax = 3;
     PackIdMouseCursors = PackIdLines = -1;
 }
 
@@ -1976,11 +2273,17 @@ ImFontAtlas::~ImFontAtlas()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     Clear();
+
+    // Textures of variants not released by the backend at this point are leaked, same as TexID
+    for (int n = 0; n < Variants.Size; n++)
+        ImFontAtlasDestroyVariant(Variants[n]);
+    Variants.clear();
 }
 
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ClearVariants(); // Variants being built use our TTF data
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -2017,6 +2320,7 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ClearVariants();
     Fonts.clear_delete();
     TexReady = false;
 }
@@ -2066,15 +2370,20 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-    IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
+    IM_ASSERT((font_cfg->FontData != NULL && font_cfg->FontDataSize > 0) || font_cfg->PrebakedData != NULL);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
+    IM_ASSERT(!font_cfg->SignedDistanceField || font_cfg->SdfPadding > 0);
 
     // Create new font
     if (!font_cfg->MergeMode)
         Fonts.push_back(IM_NEW(ImFont));
     else
+    {
         IM_ASSERT(!Fonts.empty() && "Cannot use MergeMode for the first font"); // When using MergeMode make sure that a font has already been added before. You can use ImGui::GetIO().Fonts->AddFontDefault() to add the default imgui font.
+        IM_ASSERT((ConfigData.empty() || ConfigData.back().SignedDistanceField == font_cfg->SignedDistanceField) && "Cannot merge signed distance field and regular fonts");
+    }
 
     ConfigData.push_back(*font_cfg);
     ImFontConfig& new_font_cfg = ConfigData.back();
@@ -2093,13 +2402,16 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     // Invalidate texture
     TexReady = false;
     ClearTexData();
+    ClearVariants();
     return new_font_cfg.DstFont;
 }
 
 // Default font TTF is compressed with stb_compress then base85 encoded (see misc/fonts/binary_to_compressed_c.cpp for encoder)
 static unsigned int stb_decompress_length(const unsigned char* input);
 static unsigned int stb_decompress(unsigned char* output, const unsigned char* input, unsigned int length);
+static unsigned int stb_decompress_locked(unsigned char* output, const unsigned char* input, unsigned int length);
 static const char*  GetDefaultCompressedFontDataTTFBase85();
+static const ImFontPrebakedData* GetDefaultPrebakedFontData();
 static unsigned int Decode85Byte(char c)                                    { return c >= '\\' ? c-36 : c-35; }
 static void         Decode85(const unsigned char* src, unsigned char* dst)
 {
@@ -2128,12 +2440,43 @@ ImFont* ImFontAtlas::AddFontDefault(const ImFontConfig* font_cfg_template)
     font_cfg.EllipsisChar = (ImWchar)0x0085;
     font_cfg.GlyphOffset.y = 1.0f * IM_FLOOR(font_cfg.SizePixels / 13.0f);  // Add +1 offset per 13 units
 
-    const char* ttf_compressed_base85 = GetDefaultCompressedFontDataTTFBase85();
     const ImWchar* glyph_ranges = font_cfg.GlyphRanges != NULL ? font_cfg.GlyphRanges : GetGlyphRangesDefault();
+    const ImFontPrebakedData* prebaked_data = GetDefaultPrebakedFontData();
+    if (font_cfg.SizePixels == prebaked_data->SizePixels && font_cfg.OversampleH == 1 && font_cfg.OversampleV == 1 && !font_cfg.SignedDistanceField && glyph_ranges == GetGlyphRangesDefault())
+    {
+        // Use pre-rasterized glyphs, skipping TTF decompression, parsing and rasterization
+        font_cfg.FontData = NULL;
+        font_cfg.FontDataSize = 0;
+        font_cfg.FontDataOwnedByAtlas = true;
+        font_cfg.GlyphRanges = glyph_ranges;
+        font_cfg.PrebakedData = prebaked_data;
+        return AddFont(&font_cfg);
+    }
+
+    const char* ttf_compressed_base85 = GetDefaultCompressedFontDataTTFBase85();
+    font_cfg.PrebakedData = NULL;
     ImFont* font = AddFontFromMemoryCompressedBase85TTF(ttf_compressed_base85, font_cfg.SizePixels, &font_cfg, glyph_ranges);
     return font;
 }
 
+// Replace pre-rasterized glyphs of the default font with its TTF data, for builders which can't use them
+static void ImFontAtlasBuildLoadDefaultFontData(ImFontConfig* font_cfg)
+{
+    IM_ASSERT(font_cfg->PrebakedData == GetDefaultPrebakedFontData());
+    const char* compressed_ttf_data_base85 = GetDefaultCompressedFontDataTTFBase85();
+    int compressed_ttf_size = (((int)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
+    unsigned char* compressed_ttf = (unsigned char*)IM_ALLOC((size_t)compressed_ttf_size);
+    Decode85((const unsigned char*)compressed_ttf_data_base85, compressed_ttf);
+    const unsigned int buf_decompressed_size = stb_decompress_length(compressed_ttf);
+    unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
+    stb_decompress_locked(buf_decompressed_data, compressed_ttf, (unsigned int)compressed_ttf_size);
+    IM_FREE(compressed_ttf);
+    font_cfg->FontData = buf_decompressed_data;
+    font_cfg->FontDataSize = (int)buf_decompressed_size;
+    font_cfg->FontDataOwnedByAtlas = true;
+    font_cfg->PrebakedData = NULL;
+}
+
 ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
@@ -2173,7 +2516,7 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_d
 {
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
-    stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
+    stb_decompress_locked(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
 
     ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
     IM_ASSERT(font_cfg.FontData == NULL);
@@ -2250,14 +2593,519 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
     return true;
 }
 
+// Copy font inputs of 'src' into the empty 'dst', with sizes multiplied by 'scale'. TTF data is borrowed from 'src'.
+static void ImFontAtlasBuildInitVariant(ImFontAtlas* dst, const ImFontAtlas* src, float scale)
+{
+    IM_ASSERT(dst->Fonts.Size == 0 && dst->ConfigData.Size == 0 && dst->CustomRects.Size == 0);
+    dst->Flags = src->Flags;
+    dst->TexDesiredWidth = src->TexDesiredWidth;
+    dst->TexPackMode = src->TexPackMode;
+    dst->TexGlyphPadding = src->TexGlyphPadding;
+    dst->UserData = src->UserData;
+    dst->FontBuilderIO = src->FontBuilderIO;
+    dst->FontBuilderFlags = src->FontBuilderFlags;
+    for (int n = 0; n < src->Fonts.Size; n++)
+        dst->Fonts.push_back(IM_NEW(ImFont));
+
+    dst->ConfigData.reserve(src->ConfigData.Size);
+    for (int n = 0; n < src->ConfigData.Size; n++)
+    {
+        ImFontConfig cfg = src->ConfigData[n];
+        cfg.DstFont = dst->Fonts[src->Fonts.index_from_ptr(src->Fonts.find(cfg.DstFont))];
+        cfg.FontDataOwnedByAtlas = false; // Owner waits for our build before freeing it, see ClearVariants()
+        cfg.SizePixels *= scale;
+        cfg.GlyphOffset *= scale;
+        cfg.GlyphExtraSpacing *= scale;
+        cfg.GlyphMinAdvanceX *= scale;
+        if (cfg.GlyphMaxAdvanceX != FLT_MAX)
+            cfg.GlyphMaxAdvanceX *= scale;
+        if (cfg.DstFont->EllipsisChar == (ImWchar)-1)
+            cfg.DstFont->EllipsisChar = cfg.EllipsisChar;
+        dst->ConfigData.push_back(cfg);
+    }
+
+    // Same rectangles (including the default ones), so their index and size match
+    dst->CustomRects = src->CustomRects;
+    for (int n = 0; n < dst->CustomRects.Size; n++)
+    {
+        ImFontAtlasCustomRect& r = dst->CustomRects[n];
+        r.X = r.Y = 0xFFFF;
+        if (r.Font != NULL)
+            r.Font = dst->Fonts[src->Fonts.index_from_ptr(src->Fonts.find(r.Font))];
+    }
+    dst->PackIdMouseCursors = src->PackIdMouseCursors;
+    dst->PackIdLines = src->PackIdLines;
+}
+
+// Build an atlas initialized with ImFontAtlasBuildInitVariant(). May run on a worker thread: only touches 'atlas'.
+static bool ImFontAtlasBuildVariantData(ImFontAtlas* atlas)
+{
+    // Pre-rasterized glyphs only exist at their original size
+    for (int n = 0; n < atlas->ConfigData.Size; n++)
+        if (atlas->ConfigData[n].PrebakedData != NULL && atlas->ConfigData[n].SizePixels != atlas->ConfigData[n].PrebakedData->SizePixels)
+            ImFontAtlasBuildLoadDefaultFontData(&atlas->ConfigData[n]);
+    return atlas->Build();
+}
+
+static void ImFontAtlasBuildVariantThreadFunc(void* user_data)
+{
+    ImFontAtlasVariant* variant = (ImFontAtlasVariant*)user_data;
+    ImFontAtlasBuildVariantData(variant->Atlas);
+    if (variant->WantRGBA32)
+    {
+        unsigned char* pixels;
+        int width, height;
+        variant->Atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    }
+    ImAtomicExchange(&variant->WorkerDone, 1);
+}
+
+// Exchange glyphs and texture of two atlases built from the same inputs. Fonts pointers, their inputs and scale are left in place.
+static void ImFontAtlasBuildSwapOutputData(ImFontAtlas* a, ImFontAtlas* b)
+{
+    IM_ASSERT(a->Fonts.Size == b->Fonts.Size);
+    ImSwap(a->TexID, b->TexID);
+    ImSwap(a->TexPixelsUseColors, b->TexPixelsUseColors);
+    ImSwap(a->TexPixelsAlpha8, b->TexPixelsAlpha8);
+    ImSwap(a->TexPixelsRGBA32, b->TexPixelsRGBA32);
+    ImSwap(a->TexWidth, b->TexWidth);
+    ImSwap(a->TexHeight, b->TexHeight);
+    ImSwap(a->TexPackedSurface, b->TexPackedSurface);
+    ImSwap(a->TexUvScale, b->TexUvScale);
+    ImSwap(a->TexUvWhitePixel, b->TexUvWhitePixel);
+    for (int n = 0; n < IM_ARRAYSIZE(a->TexUvLines); n++)
+        ImSwap(a->TexUvLines[n], b->TexUvLines[n]);
+    for (int n = 0; n < ImMax(a->CustomRects.Size, b->CustomRects.Size); n++)
+    {
+        // Rectangles added to one atlas after the other was initialized are not packed in the other one
+        if (n >= a->CustomRects.Size)
+            b->CustomRects[n].X = b->CustomRects[n].Y = 0xFFFF;
+        else if (n >= b->CustomRects.Size)
+            a->CustomRects[n].X = a->CustomRects[n].Y = 0xFFFF;
+        else
+        {
+            ImSwap(a->CustomRects[n].X, b->CustomRects[n].X);
+            ImSwap(a->CustomRects[n].Y, b->CustomRects[n].Y);
+        }
+    }
+    for (int n = 0; n < a->Fonts.Size; n++)
+    {
+        ImFont* fa = a->Fonts[n];
+        ImFont* fb = b->Fonts[n];
+        fa->IndexAdvanceX.swap(fb->IndexAdvanceX);
+        fa->IndexLookup.swap(fb->IndexLookup);
+        fa->Glyphs.swap(fb->Glyphs);
+        ImSwap(fa->FallbackAdvanceX, fb->FallbackAdvanceX);
+        ImSwap(fa->FontSize, fb->FontSize);
+        ImSwap(fa->FallbackGlyph, fb->FallbackGlyph);
+        ImSwap(fa->FallbackChar, fb->FallbackChar);
+        ImSwap(fa->EllipsisChar, fb->EllipsisChar);
+        ImSwap(fa->EllipsisCharCount, fb->EllipsisCharCount);
+        ImSwap(fa->EllipsisWidth, fb->EllipsisWidth);
+        ImSwap(fa->EllipsisCharStep, fb->EllipsisCharStep);
+        ImSwap(fa->DirtyLookupTables, fb->DirtyLookupTables);
+        ImSwap(fa->SignedDistanceField, fb->SignedDistanceField);
+        ImSwap(fa->Ascent, fb->Ascent);
+        ImSwap(fa->Descent, fb->Descent);
+        ImSwap(fa->MetricsTotalSurface, fb->MetricsTotalSurface);
+        for (int i = 0; i < IM_ARRAYSIZE(fa->Used4kPagesMap); i++)
+            ImSwap(fa->Used4kPagesMap[i], fb->Used4kPagesMap[i]);
+    }
+}
+
+// Copy pixels of user rectangles (not the default ones, which are rendered by the builder)
+static void ImFontAtlasBuildCopyCustomRectsPixels(ImFontAtlas* dst, const ImFontAtlas* src)
+{
+    for (int n = 0; n < dst->CustomRects.Size && n < src->CustomRects.Size; n++)
+    {
+        const ImFontAtlasCustomRect& r_src = src->CustomRects[n];
+        const ImFontAtlasCustomRect& r_dst = dst->CustomRects[n];
+        if (n == src->PackIdMouseCursors || n == src->PackIdLines || !r_src.IsPacked() || !r_dst.IsPacked())
+            continue;
+        for (int y = 0; y < r_src.Height; y++)
+        {
+            const int src_offset = (r_src.Y + y) * src->TexWidth + r_src.X;
+            const int dst_offset = (r_dst.Y + y) * dst->TexWidth + r_dst.X;
+            if (src->TexPixelsAlpha8 && dst->TexPixelsAlpha8)
+                memcpy(dst->TexPixelsAlpha8 + dst_offset, src->TexPixelsAlpha8 + src_offset, r_src.Width);
+            if (src->TexPixelsRGBA32 && dst->TexPixelsRGBA32)
+                memcpy(dst->TexPixelsRGBA32 + dst_offset, src->TexPixelsRGBA32 + src_offset, r_src.Width * 4);
+            else if (dst->TexPixelsRGBA32 && dst->TexPixelsAlpha8)
+                for (int x = 0; x < r_src.Width; x++)
+                    dst->TexPixelsRGBA32[dst_offset + x] = IM_COL32(255, 255, 255, (unsigned int)dst->TexPixelsAlpha8[dst_offset + x]);
+        }
+    }
+    dst->TexPixelsUseColors = src->TexPixelsUseColors;
+}
+
+static ImFontAtlasVariant* ImFontAtlasFindVariant(ImFontAtlas* atlas, float scale)
+{
+    for (int n = 0; n < atlas->Variants.Size; n++)
+        if (atlas->Variants[n]->Scale == scale && atlas->Variants[n]->Status != ImFontAtlasVariantStatus_Discarded && !atlas->Variants[n]->IsBuildAsync)
+            return atlas->Variants[n];
+    return NULL;
+}
+
+static ImFontAtlasVariant* ImFontAtlasFindBuildAsync(const ImFontAtlas* atlas)
+{
+    for (int n = 0; n < atlas->Variants.Size; n++)
+        if (atlas->Variants[n]->IsBuildAsync && atlas->Variants[n]->Status != ImFontAtlasVariantStatus_Discarded && !atlas->Variants[n]->WantDiscard)
+            return atlas->Variants[n];
+    return NULL;
+}
+
+// Call and clear the callback of a BuildAsync() variant
+static void ImFontAtlasCallBuildCallback(ImFontAtlas* atlas, ImFontAtlasVariant* variant, bool success)
+{
+    ImFontAtlasBuildCallback callback = variant->BuildCallback;
+    variant->BuildCallback = NULL;
+    if (callback != NULL)
+        callback(atlas, success, variant->BuildCallbackUserData);
+}
+
+// Cancel a BuildAsync() in progress, without waiting for its worker thread. Its callback is left to the caller.
+static ImFontAtlasVariant* ImFontAtlasCancelBuildAsync(ImFontAtlas* atlas)
+{
+    ImFontAtlasVariant* variant = ImFontAtlasFindBuildAsync(atlas);
+    if (variant == NULL)
+        return NULL;
+    if (variant->Status == ImFontAtlasVariantStatus_Building)
+        variant->WantDiscard = true;
+    else
+        variant->Status = ImFontAtlasVariantStatus_Discarded;
+    return variant;
+}
+
+static void ImFontAtlasDestroyVariant(ImFontAtlasVariant* variant)
+{
+    if (variant->WorkerThread != NULL)
+        ImThreadJoin(variant->WorkerThread);
+    IM_DELETE(variant->Atlas);
+    IM_DELETE(variant);
+}
+
+// Discard least recently used variants above VariantsMax, except the requested one
+static void ImFontAtlasTrimVariants(ImFontAtlas* atlas)
+{
+    for (;;)
+    {
+        int count = 0;
+        ImFontAtlasVariant* lru_variant = NULL;
+        for (int n = 0; n < atlas->Variants.Size; n++)
+        {
+            ImFontAtlasVariant* variant = atlas->Variants[n];
+            if (variant->Status == ImFontAtlasVariantStatus_Discarded || variant->WantDiscard || variant->IsBuildAsync)
+                continue;
+            count++;
+            if (variant->Scale != atlas->BakedScaleRequested && (lru_variant == NULL || variant->LastUsed < lru_variant->LastUsed))
+                lru_variant = variant;
+        }
+        if (count <= atlas->VariantsMax || lru_variant == NULL)
+            break;
+        if (lru_variant->Status == ImFontAtlasVariantStatus_Building)
+            lru_variant->WantDiscard = true; // Backend may not touch it before it is built
+        else
+            lru_variant->Status = ImFontAtlasVariantStatus_Discarded;
+    }
+}
+
+void    ImFontAtlas::RequestBakedScale(float scale)
+{
+    IM_ASSERT(scale > 0.0f);
+    BakedScaleRequested = scale;
+    if (scale == BakedScale || !TexReady || IsBuildAsyncPending())
+        return; // Next Build() uses BakedScaleRequested, or NewFrame() once BuildAsync() output is in use
+    IM_ASSERT(ConfigData.Size > 0 && "Cannot build variants after ClearInputData()!");
+
+    ImFontAtlasVariant* variant = ImFontAtlasFindVariant(this, scale);
+    if (variant == NULL)
+    {
+        IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
+        variant = IM_NEW(ImFontAtlasVariant)();
+        variant->Scale = scale;
+        variant->Status = ImFontAtlasVariantStatus_Building;
+        variant->Atlas = IM_NEW(ImFontAtlas)();
+        variant->WantRGBA32 = (TexPixelsRGBA32 != NULL);
+        ImFontAtlasBuildInitVariant(variant->Atlas, this, scale);
+        Variants.push_back(variant);
+        variant->WorkerThread = ImThreadCreate(ImFontAtlasBuildVariantThreadFunc, variant);
+        if (variant->WorkerThread == NULL)
+            ImFontAtlasBuildVariantThreadFunc(variant); // No thread available: build now, NewFrame() will collect it
+    }
+    variant->WantDiscard = false;
+    variant->LastUsed = ++VariantsUseCounter;
+    ImFontAtlasTrimVariants(this);
+}
+
+void    ImFontAtlas::ClearVariants()
+{
+    if (ImFontAtlasVariant* build_async = ImFontAtlasFindBuildAsync(this))
+        ImFontAtlasCallBuildCallback(this, build_async, false);
+    for (int n = 0; n < Variants.Size; n++)
+    {
+        ImFontAtlasVariant* variant = Variants[n];
+        if (variant->WorkerThread != NULL)
+        {
+            ImThreadJoin(variant->WorkerThread);
+            variant->WorkerThread = NULL;
+        }
+        variant->Status = ImFontAtlasVariantStatus_Discarded;
+        if (variant->Atlas->TexID == 0) // Otherwise wait for the backend to release the texture
+        {
+            ImFontAtlasDestroyVariant(variant);
+            Variants.erase(Variants.Data + n);
+            n--;
+        }
+    }
+}
+
+void    ImFontAtlasUpdateVariants(ImFontAtlas* atlas)
+{
+    ImFontAtlasVariant* build_async_done = NULL;
+    for (int n = 0; n < atlas->Variants.Size; n++)
+    {
+        ImFontAtlasVariant* variant = atlas->Variants[n];
+
+        // Collect builds completed in the background (joining also makes the worker thread writes visible)
+        if (variant->Status != ImFontAtlasVariantStatus_Ready && ImAtomicLoad(&variant->WorkerDone))
+        {
+            if (variant->WorkerThread != NULL)
+            {
+                ImThreadJoin(variant->WorkerThread);
+                variant->WorkerThread = NULL;
+            }
+            if (variant->Status == ImFontAtlasVariantStatus_Building && variant->WantDiscard)
+            {
+                variant->Status = ImFontAtlasVariantStatus_Discarded;
+            }
+            else if (variant->Status == ImFontAtlasVariantStatus_Building && !variant->Atlas->TexReady)
+            {
+                variant->Status = ImFontAtlasVariantStatus_Discarded; // Build failed
+                if (variant->IsBuildAsync)
+                    build_async_done = variant;
+            }
+            else if (variant->Status == ImFontAtlasVariantStatus_Building)
+            {
+                ImFontAtlasBuildCopyCustomRectsPixels(variant->Atlas, atlas);
+                variant->Status = ImFontAtlasVariantStatus_Ready;
+            }
+        }
+
+        // Destroy discarded variants once the backend released their texture
+        if (variant->Status == ImFontAtlasVariantStatus_Discarded && variant->WorkerThread == NULL && variant->Atlas->TexID == 0 && variant != build_async_done)
+        {
+            ImFontAtlasDestroyVariant(variant);
+            atlas->Variants.erase(atlas->Variants.Data + n);
+            n--;
+        }
+    }
+
+    // Replace output with the one of BuildAsync(), once its texture is uploaded. The variant then holds the previous output, until the backend releases its texture.
+    ImFontAtlasVariant* build_async = ImFontAtlasFindBuildAsync(atlas);
+    if (build_async != NULL && build_async->Status == ImFontAtlasVariantStatus_Ready && build_async->Atlas->TexID != 0)
+    {
+        ImFontAtlasBuildSwapOutputData(atlas, build_async->Atlas);
+        atlas->BakedScale = build_async->Scale;
+        atlas->TexReady = true;
+        build_async->Status = ImFontAtlasVariantStatus_Discarded;
+        build_async_done = build_async;
+        atlas->RequestBakedScale(atlas->BakedScaleRequested);
+    }
+    if (build_async_done != NULL)
+    {
+        ImFontAtlasCallBuildCallback(atlas, build_async_done, build_async_done == build_async);
+        return;
+    }
+
+    // Swap requested scale in, once its texture is uploaded. The previous scale is kept as a variant.
+    if (atlas->BakedScaleRequested == atlas->BakedScale || !atlas->TexReady || build_async != NULL)
+        return;
+    ImFontAtlasVariant* variant = ImFontAtlasFindVariant(atlas, atlas->BakedScaleRequested);
+    if (variant == NULL || variant->Status != ImFontAtlasVariantStatus_Ready || variant->Atlas->TexID == 0)
+        return;
+    ImFontAtlasBuildSwapOutputData(atlas, variant->Atlas);
+    ImSwap(atlas->BakedScale, variant->Scale);
+    variant->LastUsed = ++atlas->VariantsUseCounter;
+    ImFontAtlasTrimVariants(atlas);
+}
+
+// Setup fonts the same way as ImFontAtlasBuildSetupFont() would, for glyphs built in a private atlas
+static void ImFontAtlasBuildSetupFontsConfigData(ImFontAtlas* atlas)
+{
+    for (int n = 0; n < atlas->ConfigData.Size; n++)
+    {
+        ImFontConfig* cfg = &atlas->ConfigData[n];
+        if (!cfg->MergeMode)
+        {
+            cfg->DstFont->ContainerAtlas = atlas;
+            cfg->DstFont->ConfigData = cfg;
+            cfg->DstFont->ConfigDataCount = 0;
+        }
+        cfg->DstFont->ConfigDataCount++;
+    }
+}
+
+// Build at BakedScale != 1.0f through a private atlas, then take its output
+static bool ImFontAtlasBuildWithBakedScale(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuildInit(atlas); // Register default rectangles in both atlases
+    ImFontAtlas* tmp_atlas = IM_NEW(ImFontAtlas)();
+    ImFontAtlasBuildInitVariant(tmp_atlas, atlas, atlas->BakedScale);
+    bool ret = ImFontAtlasBuildVariantData(tmp_atlas);
+    if (ret)
+    {
+        ImFontAtlasBuildSetupFontsConfigData(atlas);
+        ImTextureID tex_id = atlas->TexID;
+        atlas->ClearTexData();
+        ImFontAtlasBuildSwapOutputData(atlas, tmp_atlas);
+        atlas->TexID = tex_id;
+        atlas->TexReady = true;
+    }
+    IM_DELETE(tmp_atlas);
+    return ret;
+}
+
+// Replace glyphs of 'dst' with those of 'src' (from the same texture) scaled to 'font_size'
+static void ImFontAtlasBuildPlaceholderFont(ImFont* dst, const ImFont* src, float font_size)
+{
+    const float scale = font_size / src->FontSize;
+    dst->Glyphs = src->Glyphs;
+    for (int n = 0; n < dst->Glyphs.Size; n++)
+    {
+        ImFontGlyph& glyph = dst->Glyphs[n];
+        glyph.X0 *= scale;
+        glyph.Y0 *= scale;
+        glyph.X1 *= scale;
+        glyph.Y1 *= scale;
+        glyph.AdvanceX *= scale;
+    }
+    dst->FontSize = font_size;
+    dst->Ascent = src->Ascent * scale;
+    dst->Descent = src->Descent * scale;
+    dst->FallbackChar = src->FallbackChar;
+    dst->EllipsisChar = src->EllipsisChar;
+    dst->SignedDistanceField = src->SignedDistanceField;
+    dst->BuildLookupTable();
+}
+
+// Give placeholder glyphs to fonts which have none, so the atlas can be used while BuildAsync() is in progress
+static void ImFontAtlasBuildPlaceholders(ImFontAtlas* atlas, float scale)
+{
+    // Use glyphs of a font which is already built, if its texture is still around
+    ImFont* src_font = NULL;
+    if (atlas->TexID != 0 || atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL)
+        for (int n = 0; n < atlas->Fonts.Size && src_font == NULL; n++)
+            if (atlas->Fonts[n]->Glyphs.Size > 0)
+                src_font = atlas->Fonts[n];
+    if (src_font != NULL)
+    {
+        for (int n = 0; n < atlas->Fonts.Size; n++)
+        {
+            ImFont* font = atlas->Fonts[n];
+            if (font->Glyphs.Size == 0)
+                ImFontAtlasBuildPlaceholderFont(font, src_font, font->ConfigData ? font->ConfigData->SizePixels * scale : src_font->FontSize);
+        }
+        atlas->TexReady = true;
+        return;
+    }
+
+    // Otherwise build the default font alone, which is fast (pre-rasterized at its default size), as a new texture
+    ImFontAtlas* tmp_atlas = IM_NEW(ImFontAtlas)();
+    ImFontAtlasBuildInitVariant(tmp_atlas, atlas, scale);
+    tmp_atlas->ConfigData.clear(); // Borrowed data
+    for (int n = 0; n < tmp_atlas->CustomRects.Size; n++)
+        tmp_atlas->CustomRects[n].Font = NULL; // Custom glyphs are not part of placeholders
+    ImFontConfig font_cfg;
+    font_cfg.SizePixels = 13.0f * scale;
+    font_cfg.OversampleH = font_cfg.OversampleV = 1;
+    font_cfg.PixelSnapH = true;
+    ImFont* default_font = tmp_atlas->AddFontDefault(&font_cfg);
+    ImFontAtlasBuildVariantData(tmp_atlas);
+    for (int n = 0; n < atlas->Fonts.Size; n++)
+    {
+        ImFont* font = atlas->Fonts[n];
+        ImFontAtlasBuildPlaceholderFont(tmp_atlas->Fonts[n], default_font, font->ConfigData ? font->ConfigData->SizePixels * scale : default_font->FontSize);
+    }
+    tmp_atlas->Fonts.pop_back();
+    IM_DELETE(default_font);
+
+    // Backend creates the new texture as TexID is 0, and releases the previous one through a discarded variant
+    atlas->ClearTexData();
+    ImFontAtlasBuildSwapOutputData(atlas, tmp_atlas);
+    atlas->TexReady = true;
+    if (tmp_atlas->TexID != 0)
+    {
+        ImFontAtlasVariant* variant = IM_NEW(ImFontAtlasVariant)();
+        variant->Scale = atlas->BakedScale;
+        variant->Status = ImFontAtlasVariantStatus_Discarded;
+        variant->Atlas = tmp_atlas;
+        atlas->Variants.push_back(variant);
+    }
+    else
+    {
+        IM_DELETE(tmp_atlas);
+    }
+}
+
+void    ImFontAtlas::BuildAsync(ImFontAtlasBuildCallback callback, void* user_data)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (ImFontAtlasVariant* prev_variant = ImFontAtlasCancelBuildAsync(this))
+        ImFontAtlasCallBuildCallback(this, prev_variant, false);
+
+    // Default font if none are specified
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+    ImFontAtlasBuildInit(this); // Register default rectangles in both atlases
+    ImFontAtlasBuildSetupFontsConfigData(this);
+
+    ImFontAtlasVariant* variant = IM_NEW(ImFontAtlasVariant)();
+    variant->Scale = BakedScaleRequested;
+    variant->Status = ImFontAtlasVariantStatus_Building;
+    variant->Atlas = IM_NEW(ImFontAtlas)();
+    variant->WantRGBA32 = true; // Keep the conversion off this thread, most backends use RGBA32. We don't know yet, as AddFont*** cleared texture data.
+    variant->IsBuildAsync = true;
+    variant->BuildCallback = callback;
+    variant->BuildCallbackUserData = user_data;
+    ImFontAtlasBuildInitVariant(variant->Atlas, this, variant->Scale);
+
+    // Keep the UI running meanwhile
+    ImFontAtlasBuildPlaceholders(this, variant->Scale);
+
+    Variants.push_back(variant);
+    variant->WorkerThread = ImThreadCreate(ImFontAtlasBuildVariantThreadFunc, variant);
+    if (variant->WorkerThread == NULL)
+        ImFontAtlasBuildVariantThreadFunc(variant); // No thread available: build now, NewFrame() will collect it
+}
+
+bool    ImFontAtlas::IsBuildAsyncPending() const
+{
+    return ImFontAtlasFindBuildAsync(this) != NULL;
+}
+
 bool    ImFontAtlas::Build()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
 
+    // Complete a BuildAsync() in progress synchronously
+    if (ImFontAtlasVariant* build_async = ImFontAtlasCancelBuildAsync(this))
+    {
+        bool ret = Build();
+        ImFontAtlasCallBuildCallback(this, build_async, ret);
+        return ret;
+    }
+
     // Default font is none are specified
     if (ConfigData.Size == 0)
         AddFontDefault();
 
+    // Build at the last requested scale (see RequestBakedScale())
+    BakedScale = BakedScaleRequested;
+    if (BakedScale != 1.0f)
+        return ImFontAtlasBuildWithBakedScale(this);
+
     // Select builder
     // - Note that we do not reassign to atlas->FontBuilderIO, since it is likely to point to static data which
     //   may mess with some hot-reloading schemes. If you need to assign to this (for dynamic selection) AND are
@@ -2275,6 +3123,14 @@ bool    ImFontAtlas::Build()
 #endif
     }
 
+    // Only the stb_truetype builder can use pre-rasterized glyphs
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    if (builder_io != ImFontAtlasGetBuilderForStbTruetype())
+#endif
+        for (int i = 0; i < ConfigData.Size; i++)
+            if (ConfigData[i].PrebakedData != NULL)
+                ImFontAtlasBuildLoadDefaultFontData(&ConfigData[i]);
+
     // Build
     return builder_io->FontBuilder_Build(this);
 }
@@ -2335,6 +3191,400 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+static const ImFontPrebakedGlyph* ImFontPrebakedFindGlyph(const ImFontPrebakedData* data, unsigned int codepoint)
+{
+    const ImFontPrebakedGlyph* first = data->Glyphs;
+    const ImFontPrebakedGlyph* last = data->Glyphs + data->GlyphsCount;
+    while (first < last)
+    {
+        const ImFontPrebakedGlyph* mid = first + (last - first) / 2;
+        if (mid->Codepoint < codepoint)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    return (first < data->Glyphs + data->GlyphsCount && first->Codepoint == codepoint) ? first : NULL;
+}
+
+// Free space for the MaxRects packer, and sort key for packing orders
+// (C++03 doesn't allow instancing ImVector<> with function-local types so we declare the types here.)
+struct ImFontAtlasPackFreeRect
+{
+    int                 x, y, w, h;
+};
+
+struct ImFontAtlasPackSortItem
+{
+    int                 Key0, Key1;         // Sorted in descending order
+    int                 Index;              // Index into rectangles array
+};
+
+enum ImFontAtlasPackSortOrder
+{
+    ImFontAtlasPackSortOrder_Height,
+    ImFontAtlasPackSortOrder_Area,
+    ImFontAtlasPackSortOrder_MaxSide,
+    ImFontAtlasPackSortOrder_Perimeter,
+    ImFontAtlasPackSortOrder_Width,
+    ImFontAtlasPackSortOrder_COUNT
+};
+
+static int IMGUI_CDECL ImFontAtlasPackSortItemComparer(const void* lhs, const void* rhs)
+{
+    const ImFontAtlasPackSortItem* a = (const ImFontAtlasPackSortItem*)lhs;
+    const ImFontAtlasPackSortItem* b = (const ImFontAtlasPackSortItem*)rhs;
+    if (a->Key0 != b->Key0)
+        return (a->Key0 > b->Key0) ? -1 : +1;
+    if (a->Key1 != b->Key1)
+        return (a->Key1 > b->Key1) ? -1 : +1;
+    return a->Index - b->Index;
+}
+
+static void ImFontAtlasPackSortRects(const ImVector<stbrp_rect>& rects, ImFontAtlasPackSortOrder sort_order, ImVector<ImFontAtlasPackSortItem>* out_order)
+{
+    out_order->resize(rects.Size);
+    for (int n = 0; n < rects.Size; n++)
+    {
+        const int w = rects[n].w, h = rects[n].h;
+        ImFontAtlasPackSortItem* item = &(*out_order)[n];
+        switch (sort_order)
+        {
+        case ImFontAtlasPackSortOrder_Height:       item->Key0 = h; item->Key1 = w; break;
+        case ImFontAtlasPackSortOrder_Area:         item->Key0 = w * h; item->Key1 = ImMax(w, h); break;
+        case ImFontAtlasPackSortOrder_MaxSide:      item->Key0 = ImMax(w, h); item->Key1 = ImMin(w, h); break;
+        case ImFontAtlasPackSortOrder_Perimeter:    item->Key0 = w + h; item->Key1 = ImMax(w, h); break;
+        case ImFontAtlasPackSortOrder_Width:        item->Key0 = w; item->Key1 = h; break;
+        default: IM_ASSERT(0); break;
+        }
+        item->Index = n;
+    }
+    ImQsort(out_order->Data, (size_t)out_order->Size, sizeof(ImFontAtlasPackSortItem), ImFontAtlasPackSortItemComparer);
+}
+
+// Add a free rectangle produced by a split, unless it is contained in another one produced by the same split
+static void ImFontAtlasPackMaxRectsAddFreeRect(ImVector<ImFontAtlasPackFreeRect>* new_free_rects, int x, int y, int w, int h)
+{
+    for (int n = 0; n < new_free_rects->Size; n++)
+    {
+        const ImFontAtlasPackFreeRect& f = (*new_free_rects)[n];
+        if (x >= f.x && y >= f.y && x + w <= f.x + f.w && y + h <= f.y + f.h)
+            return;
+    }
+    for (int n = 0; n < new_free_rects->Size; )
+    {
+        const ImFontAtlasPackFreeRect& f = (*new_free_rects)[n];
+        if (f.x >= x && f.y >= y && f.x + f.w <= x + w && f.y + f.h <= y + h)
+        {
+            (*new_free_rects)[n] = new_free_rects->back();
+            new_free_rects->pop_back();
+        }
+        else
+        {
+            n++;
+        }
+    }
+    ImFontAtlasPackFreeRect r = { x, y, w, h };
+    new_free_rects->push_back(r);
+}
+
+// MaxRects packer: keep a list of maximal free rectangles, place each rectangle at the lowest then leftmost position fitting in one of them.
+// Return false as soon as a rectangle doesn't fit.
+static bool ImFontAtlasPackMaxRects(ImVector<stbrp_rect>& rects, const ImVector<ImFontAtlasPackSortItem>& order, int width, int height_max, ImVector<ImFontAtlasPackFreeRect>* free_rects, ImVector<ImFontAtlasPackFreeRect>* new_free_rects)
+{
+    free_rects->resize(0);
+    ImFontAtlasPackFreeRect bin = { 0, 0, width, height_max };
+    free_rects->push_back(bin);
+    for (int order_n = 0; order_n < order.Size; order_n++)
+    {
+        stbrp_rect* r = &rects[order[order_n].Index];
+        r->was_packed = 1;
+        if (r->w == 0 || r->h == 0)
+        {
+            r->x = r->y = 0; // Same as stb_rect_pack
+            continue;
+        }
+
+        // Find position
+        int best_n = -1;
+        for (int n = 0; n < free_rects->Size; n++)
+        {
+            const ImFontAtlasPackFreeRect& f = (*free_rects)[n];
+            if (f.w >= r->w && f.h >= r->h)
+                if (best_n == -1 || f.y < (*free_rects)[best_n].y || (f.y == (*free_rects)[best_n].y && f.x < (*free_rects)[best_n].x))
+                    best_n = n;
+        }
+        if (best_n == -1)
+        {
+            r->was_packed = 0;
+            return false;
+        }
+        const int x0 = (*free_rects)[best_n].x;
+        const int y0 = (*free_rects)[best_n].y;
+        const int x1 = x0 + r->w;
+        const int y1 = y0 + r->h;
+        r->x = (stbrp_coord)x0;
+        r->y = (stbrp_coord)y0;
+
+        // Split free rectangles overlapping the placed one into up to 4 maximal rectangles
+        new_free_rects->resize(0);
+        for (int n = 0; n < free_rects->Size; )
+        {
+            const ImFontAtlasPackFreeRect f = (*free_rects)[n];
+            if (x0 >= f.x + f.w || x1 <= f.x || y0 >= f.y + f.h || y1 <= f.y)
+            {
+                n++;
+                continue;
+            }
+            if (x0 > f.x)
+                ImFontAtlasPackMaxRectsAddFreeRect(new_free_rects, f.x, f.y, x0 - f.x, f.h);
+            if (x1 < f.x + f.w)
+                ImFontAtlasPackMaxRectsAddFreeRect(new_free_rects, x1, f.y, f.x + f.w - x1, f.h);
+            if (y0 > f.y)
+                ImFontAtlasPackMaxRectsAddFreeRect(new_free_rects, f.x, f.y, f.w, y0 - f.y);
+            if (y1 < f.y + f.h)
+                ImFontAtlasPackMaxRectsAddFreeRect(new_free_rects, f.x, y1, f.w, f.y + f.h - y1);
+            (*free_rects)[n] = free_rects->back();
+            free_rects->pop_back();
+        }
+
+        // Keep new rectangles not contained in a remaining one (remaining ones can't be contained in new ones, which are parts of removed ones)
+        const int remaining_count = free_rects->Size;
+        for (int new_n = 0; new_n < new_free_rects->Size; new_n++)
+        {
+            const ImFontAtlasPackFreeRect& nf = (*new_free_rects)[new_n];
+            bool contained = false;
+            for (int n = 0; n < remaining_count && !contained; n++)
+            {
+                const ImFontAtlasPackFreeRect& f = (*free_rects)[n];
+                contained = (nf.x >= f.x && nf.y >= f.y && nf.x + nf.w <= f.x + f.w && nf.y + nf.h <= f.y + f.h);
+            }
+            if (!contained)
+                free_rects->push_back(nf);
+        }
+    }
+    return true;
+}
+
+// Pack custom rectangles and glyphs all at once with the heuristic(s) selected by atlas->TexPackMode, keeping the smallest texture.
+// Set atlas->TexWidth and atlas->TexHeight (not rounded yet), custom rectangles positions and glyph_rects[] positions.
+static void ImFontAtlasBuildPackAllRects(ImFontAtlas* atlas, ImVector<stbrp_rect>& glyph_rects, int height_max)
+{
+    const ImFontAtlasPackMode mode = atlas->TexPackMode;
+    IM_ASSERT(mode > ImFontAtlasPackMode_Default && mode < ImFontAtlasPackMode_COUNT);
+
+    // Custom rectangles are stored first
+    ImVector<ImFontAtlasCustomRect>& user_rects = atlas->CustomRects;
+    ImVector<stbrp_rect> rects;
+    rects.resize(user_rects.Size + glyph_rects.Size);
+    for (int i = 0; i < user_rects.Size; i++)
+    {
+        memset(&rects[i], 0, sizeof(stbrp_rect));
+        rects[i].w = user_rects[i].Width;
+        rects[i].h = user_rects[i].Height;
+    }
+    if (glyph_rects.Size > 0)
+        memcpy(&rects[user_rects.Size], glyph_rects.Data, (size_t)glyph_rects.size_in_bytes());
+
+    // Candidate widths
+    int widths[3];
+    int widths_count = 0;
+    widths[widths_count++] = atlas->TexWidth;
+    if (mode == ImFontAtlasPackMode_Best && atlas->TexDesiredWidth <= 0)
+    {
+        if (atlas->TexWidth / 2 >= 256)
+            widths[widths_count++] = atlas->TexWidth / 2;
+        if (atlas->TexWidth * 2 <= 4096)
+            widths[widths_count++] = atlas->TexWidth * 2;
+    }
+
+    // Sort orders for MaxRects (stb_rect_pack sorts by height on its own)
+    ImVector<ImFontAtlasPackSortItem> orders[ImFontAtlasPackSortOrder_COUNT];
+    if (mode == ImFontAtlasPackMode_MaxRects || mode == ImFontAtlasPackMode_Best)
+        for (int sort_n = 0; sort_n < ImFontAtlasPackSortOrder_COUNT; sort_n++)
+            ImFontAtlasPackSortRects(rects, (ImFontAtlasPackSortOrder)sort_n, &orders[sort_n]);
+
+    ImVector<stbrp_rect> best_rects;
+    ImVector<stbrp_node> nodes;
+    ImVector<ImFontAtlasPackFreeRect> free_rects, new_free_rects;
+    int best_area = 0, best_width = widths[0], best_height = 0;
+    for (int width_n = 0; width_n < widths_count; width_n++)
+    {
+        const int width = widths[width_n];
+        for (int attempt_n = 0; attempt_n < 2 + ImFontAtlasPackSortOrder_COUNT; attempt_n++)
+        {
+            // Once we have a result, give up as soon as an attempt exceeds its texture area
+            int height_limit = height_max;
+            if (best_rects.Size > 0 && best_area != INT_MAX)
+            {
+                const int tex_height_limit = best_area / width;
+                if (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight)
+                    height_limit = ImMin(height_limit, tex_height_limit - 1);
+                else if (tex_height_limit > 0)
+                    height_limit = ImMin(height_limit, ImUpperPowerOfTwo(tex_height_limit + 1) >> 1);
+                else
+                    height_limit = 0;
+                if (height_limit <= 0)
+                    continue;
+            }
+
+            // Attempts: 0 = Skyline best-fit, 1 = Skyline bottom-left (all rectangles at once), 2+ = MaxRects with each sort order
+            bool packed;
+            if (attempt_n == 0 && (mode == ImFontAtlasPackMode_SkylineBestFit || mode == ImFontAtlasPackMode_Best))
+            {
+                stbrp_context pack_context;
+                nodes.resize(width);
+                stbrp_init_target(&pack_context, width, height_limit, nodes.Data, nodes.Size);
+                stbrp_setup_heuristic(&pack_context, STBRP_HEURISTIC_Skyline_BF_sortHeight);
+                packed = stbrp_pack_rects(&pack_context, rects.Data, rects.Size) != 0;
+            }
+            else if (attempt_n == 1 && mode == ImFontAtlasPackMode_Best)
+            {
+                stbrp_context pack_context;
+                nodes.resize(width);
+                stbrp_init_target(&pack_context, width, height_limit, nodes.Data, nodes.Size);
+                packed = stbrp_pack_rects(&pack_context, rects.Data, rects.Size) != 0;
+            }
+            else if (attempt_n >= 2 && (mode == ImFontAtlasPackMode_MaxRects || mode == ImFontAtlasPackMode_Best))
+            {
+                packed = ImFontAtlasPackMaxRects(rects, orders[attempt_n - 2], width, height_limit, &free_rects, &new_free_rects);
+            }
+            else
+            {
+                continue;
+            }
+            if (!packed && best_rects.Size > 0)
+                continue;
+
+            // Compare texture area after rounding the height the way the builder will
+            int height = 0;
+            for (int i = 0; i < rects.Size; i++)
+                if (rects[i].was_packed)
+                    height = ImMax(height, rects[i].y + rects[i].h);
+            const int tex_height = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (height + 1) : ImUpperPowerOfTwo(height);
+            const int area = width * tex_height;
+            if (best_rects.Size == 0 || area < best_area || (area == best_area && height < best_height))
+            {
+                best_rects = rects; // Keep a failed attempt only until one succeeds
+                best_area = packed ? area : INT_MAX;
+                best_width = width;
+                best_height = height;
+            }
+        }
+    }
+
+    // Output
+    for (int i = 0; i < user_rects.Size; i++)
+        if (best_rects[i].was_packed)
+        {
+            user_rects[i].X = (unsigned short)best_rects[i].x;
+            user_rects[i].Y = (unsigned short)best_rects[i].y;
+            IM_ASSERT(best_rects[i].w == user_rects[i].Width && best_rects[i].h == user_rects[i].Height);
+        }
+    if (glyph_rects.Size > 0)
+        memcpy(glyph_rects.Data, &best_rects[user_rects.Size], (size_t)glyph_rects.size_in_bytes());
+    atlas->TexWidth = best_width;
+    atlas->TexHeight = best_height;
+}
+
+// Copy pre-rasterized bitmaps into packed rectangles, filling the same output as stbtt_PackFontRangesRenderIntoRects()
+static void ImFontAtlasBuildRenderPrebakedGlyphs(ImFontAtlas* atlas, const ImFontPrebakedData* data, ImFontBuildSrcData* src_tmp)
+{
+    IM_ASSERT(data->BitsPerPixel == 1 || data->BitsPerPixel == 8);
+    const int pad = atlas->TexGlyphPadding;
+    int data_glyph_n = 0;
+    int data_pixel_n = 0; // Offset of Glyphs[data_glyph_n] bitmap, in pixels
+    for (int glyph_i = 0; glyph_i < src_tmp->GlyphsCount; glyph_i++)
+    {
+        // Both lists are sorted, glyphs we skip may have been provided by an earlier source font
+        const int codepoint = src_tmp->GlyphsList[glyph_i];
+        for (; data->Glyphs[data_glyph_n].Codepoint != codepoint; data_glyph_n++)
+            data_pixel_n += data->Glyphs[data_glyph_n].Width * data->Glyphs[data_glyph_n].Height;
+        const ImFontPrebakedGlyph* glyph = &data->Glyphs[data_glyph_n];
+
+        // Like stb_truetype, leave metrics cleared for empty rectangles (happens to blank glyphs with TexGlyphPadding == 0)
+        stbrp_rect* r = &src_tmp->Rects[glyph_i];
+        if (r->was_packed && r->w != 0 && r->h != 0)
+        {
+            // Pad on left and top
+            r->x += (stbrp_coord)pad;
+            r->y += (stbrp_coord)pad;
+            r->w -= (stbrp_coord)pad;
+            r->h -= (stbrp_coord)pad;
+            unsigned char* dst = atlas->TexPixelsAlpha8 + r->x + r->y * atlas->TexWidth;
+            for (int y = 0, src_n = data_pixel_n; y < glyph->Height; y++, dst += atlas->TexWidth)
+            {
+                if (data->BitsPerPixel == 8)
+                {
+                    memcpy(dst, data->Pixels + src_n, glyph->Width);
+                    src_n += glyph->Width;
+                    continue;
+                }
+                for (int x = 0; x < glyph->Width; x++, src_n++)
+                    dst[x] = (data->Pixels[src_n >> 3] & (0x80 >> (src_n & 7))) ? 0xFF : 0x00;
+            }
+
+            stbtt_packedchar* pc = &src_tmp->PackedChars[glyph_i];
+            pc->x0 = (unsigned short)r->x;
+            pc->y0 = (unsigned short)r->y;
+            pc->x1 = (unsigned short)(r->x + glyph->Width);
+            pc->y1 = (unsigned short)(r->y + glyph->Height);
+            pc->xadvance = glyph->AdvanceX;
+            pc->xoff = (float)glyph->X0;
+            pc->yoff = (float)glyph->Y0;
+            pc->xoff2 = (float)(glyph->X0 + glyph->Width);
+            pc->yoff2 = (float)(glyph->Y0 + glyph->Height);
+        }
+        data_pixel_n += glyph->Width * glyph->Height;
+        data_glyph_n++;
+    }
+}
+
+// Render signed distance field glyphs into packed rectangles, filling the same output as stbtt_PackFontRangesRenderIntoRects()
+// Distances are stored as 128 on the glyph edge, changing by 128/SdfPadding per pixel (reaching 0 at SdfPadding pixels outside).
+static void ImFontAtlasBuildRenderSdfGlyphs(ImFontAtlas* atlas, const ImFontConfig* cfg, ImFontBuildSrcData* src_tmp)
+{
+    const int pad = atlas->TexGlyphPadding;
+    const float scale = (cfg->SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp->FontInfo, cfg->SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp->FontInfo, -cfg->SizePixels);
+    for (int glyph_i = 0; glyph_i < src_tmp->GlyphsCount; glyph_i++)
+    {
+        // Like stb_truetype, leave metrics cleared for empty rectangles (happens to blank glyphs with TexGlyphPadding == 0)
+        stbrp_rect* r = &src_tmp->Rects[glyph_i];
+        if (!r->was_packed || r->w == 0 || r->h == 0)
+            continue;
+
+        // Pad on left and top
+        r->x += (stbrp_coord)pad;
+        r->y += (stbrp_coord)pad;
+        r->w -= (stbrp_coord)pad;
+        r->h -= (stbrp_coord)pad;
+
+        // Bitmap is NULL for blank glyphs (e.g. space)
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp->FontInfo, src_tmp->GlyphsList[glyph_i]);
+        int w = 0, h = 0, x_off = 0, y_off = 0;
+        unsigned char* bitmap = stbtt_GetGlyphSDF(&src_tmp->FontInfo, scale, glyph_index_in_font, cfg->SdfPadding, 128, 128.0f / cfg->SdfPadding, &w, &h, &x_off, &y_off);
+        if (bitmap != NULL)
+        {
+            IM_ASSERT(w == r->w && h == r->h);
+            for (int y = 0; y < h; y++)
+                memcpy(atlas->TexPixelsAlpha8 + r->x + (r->y + y) * atlas->TexWidth, bitmap + y * w, (size_t)w);
+            stbtt_FreeSDF(bitmap, src_tmp->FontInfo.userdata);
+        }
+
+        int advance, left_side_bearing;
+        stbtt_GetGlyphHMetrics(&src_tmp->FontInfo, glyph_index_in_font, &advance, &left_side_bearing);
+        stbtt_packedchar* pc = &src_tmp->PackedChars[glyph_i];
+        pc->x0 = (unsigned short)r->x;
+        pc->y0 = (unsigned short)r->y;
+        pc->x1 = (unsigned short)(r->x + w);
+        pc->y1 = (unsigned short)(r->y + h);
+        pc->xadvance = scale * advance;
+        pc->xoff = (float)x_off;
+        pc->yoff = (float)y_off;
+        pc->xoff2 = (float)(x_off + w);
+        pc->yoff2 = (float)(y_off + h);
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2343,7 +3593,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // Clear atlas
     atlas->TexID = (ImTextureID)NULL;
-    atlas->TexWidth = atlas->TexHeight = 0;
+    atlas->TexWidth = atlas->TexHeight = atlas->TexPackedSurface = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     atlas->ClearTexData();
@@ -2374,10 +3624,13 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             return false;
         }
         // Initialize helper structure for font loading and verify that the TTF/OTF data is correct
-        const int font_offset = stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo);
-        IM_ASSERT(font_offset >= 0 && "FontData is incorrect, or FontNo cannot be found.");
-        if (!stbtt_InitFont(&src_tmp.FontInfo, (unsigned char*)cfg.FontData, font_offset))
-            return false;
+        if (cfg.PrebakedData == NULL)
+        {
+            const int font_offset = stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo);
+            IM_ASSERT(font_offset >= 0 && "FontData is incorrect, or FontNo cannot be found.");
+            if (!stbtt_InitFont(&src_tmp.FontInfo, (unsigned char*)cfg.FontData, font_offset))
+                return false;
+        }
 
         // Measure highest codepoints
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
@@ -2399,6 +3652,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
+        const ImFontPrebakedData* prebaked_data = atlas->ConfigData[src_i].PrebakedData;
         src_tmp.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
         if (dst_tmp.GlyphsSet.Storage.empty())
             dst_tmp.GlyphsSet.Create(dst_tmp.GlyphsHighest + 1);
@@ -2408,7 +3662,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             {
                 if (dst_tmp.GlyphsSet.TestBit(codepoint))    // Don't overwrite existing glyphs. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
                     continue;
-                if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
+                if (prebaked_data ? !ImFontPrebakedFindGlyph(prebaked_data, codepoint) : !stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
                     continue;
 
                 // Add to avail set/counters
@@ -2468,13 +3722,34 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
-        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
         const int padding = atlas->TexGlyphPadding;
+        if (cfg.PrebakedData != NULL)
+        {
+            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+            {
+                const ImFontPrebakedGlyph* glyph = ImFontPrebakedFindGlyph(cfg.PrebakedData, src_tmp.GlyphsList[glyph_i]);
+                src_tmp.Rects[glyph_i].w = (stbrp_coord)(glyph->Width + padding);
+                src_tmp.Rects[glyph_i].h = (stbrp_coord)(glyph->Height + padding);
+                total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            }
+            continue;
+        }
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
+            if (cfg.SignedDistanceField)
+            {
+                // Same box as stbtt_GetGlyphSDF(), which extends non-empty glyphs by SdfPadding on each side
+                stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+                const int sdf_padding = (x0 == x1 || y0 == y1) ? 0 : cfg.SdfPadding;
+                src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + sdf_padding * 2 + padding);
+                src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + sdf_padding * 2 + padding);
+                total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+                continue;
+            }
             stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
             src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
             src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
@@ -2494,10 +3769,15 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
+    // Other packing modes pack everything at once here, and may select another width.
     const int TEX_HEIGHT_MAX = 1024 * 32;
+    const bool pack_incremental = (atlas->TexPackMode == ImFontAtlasPackMode_Default);
+    if (!pack_incremental)
+        ImFontAtlasBuildPackAllRects(atlas, buf_rects, TEX_HEIGHT_MAX);
     stbtt_pack_context spc = {};
     stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
-    ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
+    if (pack_incremental)
+        ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
 
     // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2506,7 +3786,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
+        if (pack_incremental)
+            stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
         // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
@@ -2517,6 +3798,13 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // 7. Allocate texture
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    atlas->TexPackedSurface = 0;
+    for (int i = 0; i < buf_rects.Size; i++)
+        if (buf_rects[i].was_packed)
+            atlas->TexPackedSurface += buf_rects[i].w * buf_rects[i].h;
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+        if (atlas->CustomRects[i].IsPacked())
+            atlas->TexPackedSurface += atlas->CustomRects[i].Width * atlas->CustomRects[i].Height;
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
     memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
@@ -2531,10 +3819,15 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
+        if (cfg.PrebakedData != NULL)
+            ImFontAtlasBuildRenderPrebakedGlyphs(atlas, cfg.PrebakedData, &src_tmp);
+        else if (cfg.SignedDistanceField)
+            ImFontAtlasBuildRenderSdfGlyphs(atlas, &cfg, &src_tmp);
+        else
+            stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
 
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        // Apply multiply operator (not on distances)
+        if (cfg.RasterizerMultiply != 1.0f && !cfg.SignedDistanceField)
         {
             unsigned char multiply_table[256];
             ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
@@ -2560,13 +3853,22 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         ImFontConfig& cfg = atlas->ConfigData[src_i];
         ImFont* dst_font = cfg.DstFont;
 
-        const float font_scale = stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels);
-        int unscaled_ascent, unscaled_descent, unscaled_line_gap;
-        stbtt_GetFontVMetrics(&src_tmp.FontInfo, &unscaled_ascent, &unscaled_descent, &unscaled_line_gap);
-
-        const float ascent = ImFloor(unscaled_ascent * font_scale + ((unscaled_ascent > 0.0f) ? +1 : -1));
-        const float descent = ImFloor(unscaled_descent * font_scale + ((unscaled_descent > 0.0f) ? +1 : -1));
+        float ascent, descent;
+        if (cfg.PrebakedData != NULL)
+        {
+            ascent = cfg.PrebakedData->Ascent;
+            descent = cfg.PrebakedData->Descent;
+        }
+        else
+        {
+            const float font_scale = stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels);
+            int unscaled_ascent, unscaled_descent, unscaled_line_gap;
+            stbtt_GetFontVMetrics(&src_tmp.FontInfo, &unscaled_ascent, &unscaled_descent, &unscaled_line_gap);
+            ascent = ImFloor(unscaled_ascent * font_scale + ((unscaled_ascent > 0.0f) ? +1 : -1));
+            descent = ImFloor(unscaled_descent * font_scale + ((unscaled_descent > 0.0f) ? +1 : -1));
+        }
         ImFontAtlasBuildSetupFont(atlas, dst_font, &cfg, ascent, descent);
+        dst_font->SignedDistanceField = cfg.SignedDistanceField;
         const float font_off_x = cfg.GlyphOffset.x;
         const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
 
@@ -2589,10 +3891,125 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     return true;
 }
 
+static void ImFontAtlasPrebakedWriteFloat(ImGuiTextBuffer* out_buf, float v)
+{
+    char buf[32];
+    ImFormatString(buf, IM_ARRAYSIZE(buf), "%.9g", v);
+    out_buf->appendf((strchr(buf, '.') || strchr(buf, 'e')) ? "%sf" : "%s.0f", buf);
+}
+
+// Write C source declaring a ImFontPrebakedData named 'symbol_name' for the single font source of 'src_atlas' (which needs its TTF data).
+// Glyphs are rasterized again with OversampleH = OversampleV = 1. GlyphOffset, GlyphExtraSpacing, GlyphMin/MaxAdvanceX, PixelSnapH and
+// RasterizerMultiply are not baked: they are applied when loading. Return false if a glyph can't be represented (non-integral or too large offsets).
+bool ImFontAtlasBuildWritePrebakedFont(const ImFontAtlas* src_atlas, const char* symbol_name, ImGuiTextBuffer* out_buf)
+{
+    IM_ASSERT(src_atlas->ConfigData.Size == 1 && src_atlas->ConfigData[0].FontData != NULL);
+    ImFontConfig cfg = src_atlas->ConfigData[0];
+    cfg.FontDataOwnedByAtlas = false; // Copy
+    cfg.OversampleH = cfg.OversampleV = 1;
+    cfg.PixelSnapH = false;
+    cfg.GlyphExtraSpacing = cfg.GlyphOffset = ImVec2(0.0f, 0.0f);
+    cfg.GlyphMinAdvanceX = 0.0f;
+    cfg.GlyphMaxAdvanceX = FLT_MAX;
+    cfg.RasterizerMultiply = 1.0f;
+    cfg.SignedDistanceField = false;
+    cfg.MergeMode = false;
+    cfg.DstFont = NULL;
+    cfg.PrebakedData = NULL;
+    ImFontAtlas atlas;
+    if (cfg.GlyphRanges == NULL)
+        cfg.GlyphRanges = atlas.GetGlyphRangesDefault();
+    atlas.Flags = ImFontAtlasFlags_NoMouseCursors | ImFontAtlasFlags_NoBakedLines;
+    atlas.FontBuilderIO = ImFontAtlasGetBuilderForStbTruetype();
+    ImFont* font = atlas.AddFont(&cfg);
+    if (!atlas.Build())
+        return false;
+
+    // Gather glyphs (skipping ones added by ImFont::BuildLookupTable()) and their pixels
+    ImVector<ImFontPrebakedGlyph> glyphs;
+    ImVector<unsigned char> pixels;
+    bool pixels_are_binary = true;
+    const float ascent = (float)IM_ROUND(font->Ascent);
+    for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+    {
+        const ImFontGlyph& src_glyph = font->Glyphs[glyph_n];
+        bool in_ranges = false;
+        for (const ImWchar* range = cfg.GlyphRanges; range[0] && range[1] && !in_ranges; range += 2)
+            in_ranges = (src_glyph.Codepoint >= range[0] && src_glyph.Codepoint <= range[1]);
+        if (!in_ranges)
+            continue;
+        IM_ASSERT(glyphs.Size == 0 || glyphs.back().Codepoint < src_glyph.Codepoint);
+
+        const float w = src_glyph.X1 - src_glyph.X0;
+        const float h = src_glyph.Y1 - src_glyph.Y0;
+        const float y0 = src_glyph.Y0 - ascent;
+        if (src_glyph.Codepoint > 0xFFFF || w != (float)(int)w || h != (float)(int)h || w > 255 || h > 255)
+            return false;
+        if (src_glyph.X0 != (float)(int)src_glyph.X0 || y0 != (float)(int)y0 || src_glyph.X0 < -128 || src_glyph.X0 > 127 || y0 < -128 || y0 > 127)
+            return false;
+        ImFontPrebakedGlyph glyph;
+        glyph.Codepoint = (ImU16)src_glyph.Codepoint;
+        glyph.Width = (ImU8)w;
+        glyph.Height = (ImU8)h;
+        glyph.X0 = (ImS8)src_glyph.X0;
+        glyph.Y0 = (ImS8)y0;
+        glyph.AdvanceX = src_glyph.AdvanceX;
+        glyphs.push_back(glyph);
+
+        const int tex_x = (int)IM_ROUND(src_glyph.U0 * atlas.TexWidth);
+        const int tex_y = (int)IM_ROUND(src_glyph.V0 * atlas.TexHeight);
+        for (int y = 0; y < glyph.Height; y++)
+            for (int x = 0; x < glyph.Width; x++)
+            {
+                const unsigned char a = atlas.TexPixelsAlpha8[(tex_x + x) + (tex_y + y) * atlas.TexWidth];
+                pixels_are_binary &= (a == 0x00 || a == 0xFF);
+                pixels.push_back(a);
+            }
+    }
+
+    // Pack 1 bit per pixel when possible
+    const int bits_per_pixel = pixels_are_binary ? 1 : 8;
+    ImVector<unsigned char> data;
+    if (bits_per_pixel == 1)
+    {
+        data.resize((pixels.Size + 7) / 8, 0);
+        for (int n = 0; n < pixels.Size; n++)
+            if (pixels[n])
+                data[n >> 3] |= (unsigned char)(0x80 >> (n & 7));
+    }
+    else
+    {
+        data = pixels;
+    }
+    if (data.Size == 0)
+        data.push_back(0); // Avoid declaring an empty array
+
+    out_buf->appendf("// Generated by ImFontAtlasBuildWritePrebakedFont() from '%s': %d glyphs, %d bit(s) per pixel\n", cfg.Name, glyphs.Size, bits_per_pixel);
+    out_buf->appendf("static const ImFontPrebakedGlyph %s_glyphs[%d] =\n{", symbol_name, glyphs.Size);
+    for (int n = 0; n < glyphs.Size; n++)
+    {
+        const ImFontPrebakedGlyph& glyph = glyphs[n];
+        out_buf->append((n % 4) == 0 ? "\n    " : " ");
+        out_buf->appendf("{ 0x%04X, %d, %d, %d, %d, ", glyph.Codepoint, glyph.Width, glyph.Height, glyph.X0, glyph.Y0);
+        ImFontAtlasPrebakedWriteFloat(out_buf, glyph.AdvanceX);
+        out_buf->append(" },");
+    }
+    out_buf->appendf("\n};\nstatic const unsigned char %s_pixels[%d] =\n{", symbol_name, data.Size);
+    for (int n = 0; n < data.Size; n++)
+        out_buf->appendf("%s0x%02X,", (n % 24) == 0 ? "\n    " : "", data[n]);
+    out_buf->appendf("\n};\nstatic const ImFontPrebakedData %s = { ", symbol_name);
+    ImFontAtlasPrebakedWriteFloat(out_buf, cfg.SizePixels);
+    out_buf->append(", ");
+    ImFontAtlasPrebakedWriteFloat(out_buf, font->Ascent);
+    out_buf->append(", ");
+    ImFontAtlasPrebakedWriteFloat(out_buf, font->Descent);
+    out_buf->appendf(", %d, %d, %s_glyphs, %s_pixels };\n", bits_per_pixel, glyphs.Size, symbol_name, symbol_name);
+    return true;
+}
+
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithStbTruetype }; // Constant-initialized, as this may be called from worker threads
     return &io;
 }
 
@@ -3125,6 +4542,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    SignedDistanceField = false;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -3146,6 +4564,7 @@ void    ImFont::ClearOutputData()
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    SignedDistanceField = false;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
 }
@@ -3160,6 +4579,7 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
 
 void ImFont::BuildLookupTable()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Fonts);
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -3551,6 +4971,7 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     float x = IM_FLOOR(pos.x);
     float y = IM_FLOOR(pos.y);
+    draw_list->_SetSdfText(SignedDistanceField && (draw_list->Flags & ImDrawListFlags_AllowSdfText));
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
@@ -3610,13 +5031,23 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     if (s == text_end)
         return;
 
-    // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
+    // Distance field glyphs are thresholded by the renderer (see ImDrawCmd::SdfText)
+    draw_list->_SetSdfText(SignedDistanceField && (draw_list->Flags & ImDrawListFlags_AllowSdfText));
+
+    // Reserve vertices (or one quad per glyph when the renderer supports it) for remaining worse case (over-reserving is useful and easily amortized)
+    // (a short run of glyphs is not worth breaking the current triangle command into another draw call)
+    const int quad_count_max = (int)(text_end - s);
+    const bool use_quad_stream = (draw_list->Flags & ImDrawListFlags_AllowQuadStream) && (quad_count_max >= 8 || draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1].ElemCount == 0);
+    const int vtx_count_max = use_quad_stream ? 0 : quad_count_max * 4;
+    const int idx_count_max = use_quad_stream ? 0 : quad_count_max * 6;
     const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
+    if (use_quad_stream)
+        draw_list->PrimQuadReserve(quad_count_max);
+    else
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
     ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    ImDrawQuad*  quad_write = draw_list->_QuadWritePtr;
     unsigned int vtx_index = draw_list->_VtxCurrentIdx;
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
@@ -3715,6 +5146,14 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
                 // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                if (use_quad_stream)
+                {
+                    quad_write->Min.x = x1; quad_write->Min.y = y1; quad_write->Max.x = x2; quad_write->Max.y = y2;
+                    quad_write->UvMin.x = u1; quad_write->UvMin.y = v1; quad_write->UvMax.x = u2; quad_write->UvMax.y = v2;
+                    quad_write->Col = glyph_col;
+                    quad_write++;
+                }
+                else
                 {
                     vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
@@ -3731,7 +5170,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         x += char_width;
     }
 
-    // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    // Give back unused vertices or quads (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
+    if (use_quad_stream)
+    {
+        draw_list->PrimQuadUnreserve((int)(draw_list->QuadBuffer.Data + draw_list->QuadBuffer.Size - quad_write));
+        draw_list->_QuadWritePtr = quad_write;
+        return;
+    }
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
     draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
@@ -4066,6 +5511,16 @@ static unsigned int stb_decompress(unsigned char *output, const unsigned char *i
     }
 }
 
+// stb_decompress() uses global state: serialize calls, as font atlas variants may decompress the default font on worker threads.
+static volatile int stb__decompress_lock = 0;
+static unsigned int stb_decompress_locked(unsigned char* output, const unsigned char* input, unsigned int length)
+{
+    ImSpinLockAcquire(&stb__decompress_lock);
+    unsigned int ret = stb_decompress(output, input, length);
+    ImSpinLockRelease(&stb__decompress_lock);
+    return ret;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Default font data (ProggyClean.ttf)
 //-----------------------------------------------------------------------------
@@ -4171,4 +5626,125 @@ static const char* GetDefaultCompressedFontDataTTFBase85()
     return proggy_clean_ttf_compressed_data_base85;
 }
 
+// Pre-rasterized glyphs used by AddFontDefault() with default settings (see ImFontPrebakedData).
+// Regenerate after changing the TTF data above or ImFontPrebakedGlyph:
+//   ImFontAtlas atlas;
+//   ImFontConfig cfg;
+//   cfg.OversampleH = 2; // Anything not matching the prebaked settings makes AddFontDefault() load the TTF data
+//   atlas.AddFontDefault(&cfg);
+//   ImGuiTextBuffer buf;
+//   ImFontAtlasBuildWritePrebakedFont(&atlas, "proggy_clean_13_prebaked", &buf);
+// Generated by ImFontAtlasBuildWritePrebakedFont() from 'ProggyClean.ttf, 13px': 223 glyphs, 1 bit(s) per pixel
+static const ImFontPrebakedGlyph proggy_clean_13_prebaked_glyphs[223] =
+{
+    { 0x0020, 0, 0, 0, 0, 7.0f }, { 0x0021, 1, 8, 3, -8, 7.0f }, { 0x0022, 3, 3, 2, -9, 7.0f }, { 0x0023, 7, 8, 0, -8, 7.0f },
+    { 0x0024, 5, 9, 1, -8, 7.0f }, { 0x0025, 7, 8, 0, -8, 7.0f }, { 0x0026, 6, 8, 1, -8, 7.0f }, { 0x0027, 1, 3, 3, -9, 7.0f },
+    { 0x0028, 3, 11, 2, -9, 7.0f }, { 0x0029, 3, 11, 2, -9, 7.0f }, { 0x002A, 5, 5, 1, -6, 7.0f }, { 0x002B, 5, 5, 1, -6, 7.0f },
+    { 0x002C, 2, 4, 1, -2, 7.0f }, { 0x002D, 5, 1, 1, -4, 7.0f }, { 0x002E, 1, 2, 2, -2, 7.0f }, { 0x002F, 5, 10, 1, -9, 7.0f },
+    { 0x0030, 5, 8, 1, -8, 7.0f }, { 0x0031, 5, 8, 1, -8, 7.0f }, { 0x0032, 5, 8, 1, -8, 7.0f }, { 0x0033, 5, 8, 1, -8, 7.0f },
+    { 0x0034, 6, 8, 1, -8, 7.0f }, { 0x0035, 5, 8, 1, -8, 7.0f }, { 0x0036, 5, 8, 1, -8, 7.0f }, { 0x0037, 5, 8, 1, -8, 7.0f },
+    { 0x0038, 5, 8, 1, -8, 7.0f }, { 0x0039, 5, 8, 1, -8, 7.0f }, { 0x003A, 1, 6, 3, -6, 7.0f }, { 0x003B, 2, 8, 1, -6, 7.0f },
+    { 0x003C, 6, 5, 0, -6, 7.0f }, { 0x003D, 6, 3, 1, -5, 7.0f }, { 0x003E, 6, 5, 1, -6, 7.0f }, { 0x003F, 5, 8, 1, -8, 7.0f },
+    { 0x0040, 7, 8, 0, -8, 7.0f }, { 0x0041, 6, 8, 1, -8, 7.0f }, { 0x0042, 6, 8, 1, -8, 7.0f }, { 0x0043, 6, 8, 1, -8, 7.0f },
+    { 0x0044, 6, 8, 1, -8, 7.0f }, { 0x0045, 5, 8, 1, -8, 7.0f }, { 0x0046, 5, 8, 1, -8, 7.0f }, { 0x0047, 6, 8, 1, -8, 7.0f },
+    { 0x0048, 6, 8, 1, -8, 7.0f }, { 0x0049, 3, 8, 2, -8, 7.0f }, { 0x004A, 4, 8, 1, -8, 7.0f }, { 0x004B, 6, 8, 1, -8, 7.0f },
+    { 0x004C, 5, 8, 1, -8, 7.0f }, { 0x004D, 7, 8, 0, -8, 7.0f }, { 0x004E, 6, 8, 1, -8, 7.0f }, { 0x004F, 6, 8, 1, -8, 7.0f },
+    { 0x0050, 5, 8, 1, -8, 7.0f }, { 0x0051, 6, 9, 1, -8, 7.0f }, { 0x0052, 6, 8, 1, -8, 7.0f }, { 0x0053, 6, 8, 1, -8, 7.0f },
+    { 0x0054, 7, 8, 0, -8, 7.0f }, { 0x0055, 6, 8, 1, -8, 7.0f }, { 0x0056, 7, 8, 0, -8, 7.0f }, { 0x0057, 7, 8, 0, -8, 7.0f },
+    { 0x0058, 6, 8, 1, -8, 7.0f }, { 0x0059, 7, 8, 0, -8, 7.0f }, { 0x005A, 6, 8, 1, -8, 7.0f }, { 0x005B, 3, 11, 2, -9, 7.0f },
+    { 0x005C, 5, 10, 1, -9, 7.0f }, { 0x005D, 3, 11, 2, -9, 7.0f }, { 0x005E, 5, 6, 1, -9, 7.0f }, { 0x005F, 7, 1, 0, 0, 7.0f },
+    { 0x0060, 2, 2, 2, -9, 7.0f }, { 0x0061, 5, 6, 1, -6, 7.0f }, { 0x0062, 5, 9, 1, -9, 7.0f }, { 0x0063, 5, 6, 1, -6, 7.0f },
+    { 0x0064, 5, 9, 1, -9, 7.0f }, { 0x0065, 5, 6, 1, -6, 7.0f }, { 0x0066, 5, 9, 1, -9, 7.0f }, { 0x0067, 5, 9, 1, -6, 7.0f },
+    { 0x0068, 5, 9, 1, -9, 7.0f }, { 0x0069, 2, 9, 2, -9, 7.0f }, { 0x006A, 4, 11, 1, -9, 7.0f }, { 0x006B, 5, 9, 1, -9, 7.0f },
+    { 0x006C, 2, 9, 2, -9, 7.0f }, { 0x006D, 7, 6, 0, -6, 7.0f }, { 0x006E, 5, 6, 1, -6, 7.0f }, { 0x006F, 5, 6, 1, -6, 7.0f },
+    { 0x0070, 5, 9, 1, -6, 7.0f }, { 0x0071, 5, 9, 1, -6, 7.0f }, { 0x0072, 5, 6, 1, -6, 7.0f }, { 0x0073, 5, 6, 1, -6, 7.0f },
+    { 0x0074, 4, 8, 2, -8, 7.0f }, { 0x0075, 5, 6, 1, -6, 7.0f }, { 0x0076, 5, 6, 1, -6, 7.0f }, { 0x0077, 7, 6, 0, -6, 7.0f },
+    { 0x0078, 5, 6, 1, -6, 7.0f }, { 0x0079, 5, 9, 1, -6, 7.0f }, { 0x007A, 5, 6, 1, -6, 7.0f }, { 0x007B, 5, 11, 1, -9, 7.0f },
+    { 0x007C, 1, 11, 3, -9, 7.0f }, { 0x007D, 5, 11, 1, -9, 7.0f }, { 0x007E, 7, 2, 0, -5, 7.0f }, { 0x007F, 0, 0, 0, 0, 7.0f },
+    { 0x0081, 0, 0, 0, 0, 7.0f }, { 0x0082, 2, 4, 2, -2, 7.0f }, { 0x0083, 5, 11, 1, -9, 7.0f }, { 0x0084, 3, 3, 2, -2, 7.0f },
+    { 0x0085, 5, 1, 1, -1, 7.0f }, { 0x0086, 5, 9, 1, -9, 7.0f }, { 0x0087, 5, 9, 1, -9, 7.0f }, { 0x0088, 5, 3, 1, -9, 7.0f },
+    { 0x0089, 6, 8, 1, -8, 7.0f }, { 0x008A, 6, 10, 1, -10, 7.0f }, { 0x008B, 3, 5, 1, -6, 7.0f }, { 0x008C, 7, 8, 0, -8, 7.0f },
+    { 0x008D, 0, 0, 0, 0, 7.0f }, { 0x008E, 6, 10, 1, -10, 7.0f }, { 0x008F, 0, 0, 0, 0, 7.0f }, { 0x0090, 0, 0, 0, 0, 7.0f },
+    { 0x0091, 2, 3, 3, -9, 7.0f }, { 0x0092, 2, 3, 2, -9, 7.0f }, { 0x0093, 4, 3, 2, -9, 7.0f }, { 0x0094, 4, 3, 1, -9, 7.0f },
+    { 0x0095, 5, 5, 1, -6, 7.0f }, { 0x0096, 5, 1, 1, -4, 7.0f }, { 0x0097, 7, 1, 0, -4, 7.0f }, { 0x0098, 4, 2, 1, -8, 7.0f },
+    { 0x0099, 7, 4, 0, -8, 7.0f }, { 0x009A, 5, 9, 1, -9, 7.0f }, { 0x009B, 3, 5, 1, -6, 7.0f }, { 0x009C, 7, 6, 0, -6, 7.0f },
+    { 0x009D, 0, 0, 0, 0, 7.0f }, { 0x009E, 5, 9, 1, -9, 7.0f }, { 0x009F, 7, 9, 0, -9, 7.0f }, { 0x00A0, 0, 0, 0, 0, 7.0f },
+    { 0x00A1, 1, 8, 3, -8, 7.0f }, { 0x00A2, 5, 8, 1, -7, 7.0f }, { 0x00A3, 5, 8, 1, -8, 7.0f }, { 0x00A4, 7, 7, 0, -7, 7.0f },
+    { 0x00A5, 7, 8, 0, -8, 7.0f }, { 0x00A6, 1, 11, 3, -9, 7.0f }, { 0x00A7, 5, 9, 1, -9, 7.0f }, { 0x00A8, 3, 1, 2, -9, 7.0f },
+    { 0x00A9, 7, 8, 0, -8, 7.0f }, { 0x00AA, 4, 5, 1, -8, 7.0f }, { 0x00AB, 5, 5, 1, -6, 7.0f }, { 0x00AC, 4, 4, 1, -4, 7.0f },
+    { 0x00AD, 0, 0, 0, 0, 7.0f }, { 0x00AE, 7, 8, 0, -8, 7.0f }, { 0x00AF, 7, 1, 0, -10, 7.0f }, { 0x00B0, 4, 4, 1, -9, 7.0f },
+    { 0x00B1, 5, 7, 1, -7, 7.0f }, { 0x00B2, 4, 5, 1, -9, 7.0f }, { 0x00B3, 4, 5, 1, -9, 7.0f }, { 0x00B4, 2, 2, 3, -9, 7.0f },
+    { 0x00B5, 7, 8, 0, -6, 7.0f }, { 0x00B6, 6, 9, 1, -8, 7.0f }, { 0x00B7, 3, 3, 2, -5, 7.0f }, { 0x00B8, 2, 3, 3, 0, 7.0f },
+    { 0x00B9, 3, 5, 1, -9, 7.0f }, { 0x00BA, 4, 5, 1, -9, 7.0f }, { 0x00BB, 5, 5, 1, -6, 7.0f }, { 0x00BC, 6, 10, 1, -10, 7.0f },
+    { 0x00BD, 6, 10, 1, -10, 7.0f }, { 0x00BE, 7, 10, 0, -10, 7.0f }, { 0x00BF, 5, 8, 1, -8, 7.0f }, { 0x00C0, 6, 10, 1, -10, 7.0f },
+    { 0x00C1, 6, 10, 1, -10, 7.0f }, { 0x00C2, 6, 10, 1, -10, 7.0f }, { 0x00C3, 6, 10, 1, -10, 7.0f }, { 0x00C4, 6, 9, 1, -9, 7.0f },
+    { 0x00C5, 6, 10, 1, -10, 7.0f }, { 0x00C6, 7, 8, 0, -8, 7.0f }, { 0x00C7, 6, 11, 1, -8, 7.0f }, { 0x00C8, 5, 10, 1, -10, 7.0f },
+    { 0x00C9, 5, 10, 1, -10, 7.0f }, { 0x00CA, 5, 10, 1, -10, 7.0f }, { 0x00CB, 5, 9, 1, -9, 7.0f }, { 0x00CC, 3, 10, 2, -10, 7.0f },
+    { 0x00CD, 3, 10, 2, -10, 7.0f }, { 0x00CE, 3, 10, 2, -10, 7.0f }, { 0x00CF, 3, 9, 2, -9, 7.0f }, { 0x00D0, 7, 7, 0, -7, 7.0f },
+    { 0x00D1, 6, 10, 1, -10, 7.0f }, { 0x00D2, 6, 10, 1, -10, 7.0f }, { 0x00D3, 6, 10, 1, -10, 7.0f }, { 0x00D4, 6, 10, 1, -10, 7.0f },
+    { 0x00D5, 6, 10, 1, -10, 7.0f }, { 0x00D6, 6, 9, 1, -9, 7.0f }, { 0x00D7, 5, 5, 1, -6, 7.0f }, { 0x00D8, 6, 8, 1, -8, 7.0f },
+    { 0x00D9, 6, 10, 1, -10, 7.0f }, { 0x00DA, 6, 10, 1, -10, 7.0f }, { 0x00DB, 6, 10, 1, -10, 7.0f }, { 0x00DC, 6, 9, 1, -9, 7.0f },
+    { 0x00DD, 7, 10, 0, -10, 7.0f }, { 0x00DE, 5, 8, 1, -8, 7.0f }, { 0x00DF, 7, 10, 0, -9, 7.0f }, { 0x00E0, 5, 9, 1, -9, 7.0f },
+    { 0x00E1, 5, 9, 1, -9, 7.0f }, { 0x00E2, 5, 9, 1, -9, 7.0f }, { 0x00E3, 5, 9, 1, -9, 7.0f }, { 0x00E4, 5, 8, 1, -8, 7.0f },
+    { 0x00E5, 5, 10, 1, -10, 7.0f }, { 0x00E6, 7, 6, 0, -6, 7.0f }, { 0x00E7, 5, 9, 1, -6, 7.0f }, { 0x00E8, 5, 9, 1, -9, 7.0f },
+    { 0x00E9, 5, 9, 1, -9, 7.0f }, { 0x00EA, 5, 9, 1, -9, 7.0f }, { 0x00EB, 5, 8, 1, -8, 7.0f }, { 0x00EC, 2, 9, 2, -9, 7.0f },
+    { 0x00ED, 2, 9, 2, -9, 7.0f }, { 0x00EE, 3, 9, 2, -9, 7.0f }, { 0x00EF, 3, 9, 2, -9, 7.0f }, { 0x00F0, 5, 9, 1, -9, 7.0f },
+    { 0x00F1, 5, 9, 1, -9, 7.0f }, { 0x00F2, 5, 9, 1, -9, 7.0f }, { 0x00F3, 5, 9, 1, -9, 7.0f }, { 0x00F4, 5, 9, 1, -9, 7.0f },
+    { 0x00F5, 5, 9, 1, -9, 7.0f }, { 0x00F6, 5, 8, 1, -8, 7.0f }, { 0x00F7, 5, 5, 1, -6, 7.0f }, { 0x00F8, 5, 8, 1, -7, 7.0f },
+    { 0x00F9, 5, 9, 1, -9, 7.0f }, { 0x00FA, 5, 9, 1, -9, 7.0f }, { 0x00FB, 5, 9, 1, -9, 7.0f }, { 0x00FC, 5, 8, 1, -8, 7.0f },
+    { 0x00FD, 5, 12, 1, -9, 7.0f }, { 0x00FE, 5, 10, 1, -8, 7.0f }, { 0x00FF, 5, 11, 1, -8, 7.0f },
+};
+static const unsigned char proggy_clean_13_prebaked_pixels[1019] =
+{
+    0xFD,0xB6,0x8A,0x14,0xFC,0xA1,0x4F,0xCA,0x14,0x11,0xF4,0xA3,0x8A,0x5F,0x11,0x15,0x4A,0x8A,0x05,0x15,0x2A,0x89,0x89,0x24,
+    0x66,0x58,0xA2,0x77,0x94,0xA4,0x92,0x24,0x62,0x44,0x92,0x52,0x84,0xAB,0xAA,0x42,0x13,0xE4,0x22,0xB7,0xF0,0x84,0x42,0x21,
+    0x10,0x88,0x41,0xD1,0x8D,0x6B,0x18,0xB8,0x8C,0xA1,0x08,0x42,0x7D,0xD1,0x08,0x88,0x88,0x7D,0xD1,0x09,0x82,0x18,0xB8,0x21,
+    0x8A,0x4A,0x2F,0xC2,0x0B,0xF0,0x87,0x82,0x18,0xB8,0xC8,0x87,0xA3,0x18,0xBB,0xE1,0x10,0x88,0x44,0x21,0xD1,0x8B,0xA3,0x18,
+    0xB9,0xD1,0x8C,0x5E,0x11,0x33,0x35,0x05,0x60,0xCC,0xC0,0xC0,0xFF,0x03,0xFC,0x0C,0x0C,0xCC,0x1D,0x10,0x88,0x84,0x01,0x0E,
+    0x22,0x9B,0x56,0xAC,0xE4,0x07,0x8C,0x31,0x24,0x9E,0x86,0x18,0x7C,0x8A,0x2F,0xA1,0x86,0x1F,0x8E,0x46,0x08,0x20,0x81,0x13,
+    0xBC,0x8A,0x18,0x61,0x86,0x2F,0x3F,0x08,0x7A,0x10,0x87,0xFF,0x08,0x7A,0x10,0x84,0x0E,0x46,0x08,0x27,0x85,0x13,0xA1,0x86,
+    0x1F,0xE1,0x86,0x18,0x7A,0x49,0x25,0xDC,0x44,0x44,0x47,0xA1,0x8A,0x4A,0x38,0x92,0x28,0x61,0x08,0x42,0x10,0x87,0xF1,0xE3,
+    0xAB,0x56,0x4C,0x98,0x30,0x71,0xC6,0x9A,0x65,0x96,0x38,0xCC,0x4A,0x18,0x61,0x85,0x23,0x3D,0x18,0xC7,0xD0,0x84,0x0C,0x4A,
+    0x18,0x61,0x85,0x23,0x41,0xF2,0x28,0xA2,0xF2,0x48,0xA1,0x7A,0x18,0x18,0x18,0x18,0x5E,0xFE,0x20,0x40,0x81,0x02,0x04,0x08,
+    0x86,0x18,0x61,0x86,0x18,0x5E,0x83,0x05,0x12,0x22,0x85,0x04,0x08,0x83,0x26,0x4D,0x5A,0xAD,0x91,0x22,0x86,0x14,0x8C,0x31,
+    0x28,0x61,0x83,0x05,0x11,0x41,0x02,0x04,0x08,0xFC,0x10,0x84,0x21,0x08,0x3F,0xF2,0x49,0x24,0x93,0xC2,0x08,0x41,0x08,0x21,
+    0x04,0x3C,0x92,0x49,0x24,0xF2,0x11,0x4A,0x8C,0x7F,0xCB,0x82,0xF8,0xC5,0xF0,0x84,0x3D,0x18,0xC6,0x3E,0x74,0x61,0x08,0xB8,
+    0x21,0x0B,0xE3,0x18,0xC5,0xEE,0x8F,0xE1,0x17,0x1D,0x08,0xF2,0x10,0x84,0x21,0xF1,0x8C,0x62,0xF0,0x85,0xD0,0x84,0x3D,0x18,
+    0xC6,0x31,0x43,0x55,0x44,0x00,0xC4,0x44,0x44,0x7A,0x10,0x84,0x65,0x4E,0x4A,0x3A,0xAA,0xAF,0x69,0x32,0x64,0xC9,0x93,0xE8,
+    0xC6,0x31,0x8B,0xA3,0x18,0xC5,0xDE,0x8C,0x63,0x1F,0x42,0x10,0x7C,0x63,0x18,0xBC,0x21,0x0D,0xB3,0x08,0x42,0x0F,0x83,0x04,
+    0x1F,0x44,0x7C,0x44,0x43,0xC6,0x31,0x8C,0x5F,0x18,0xA9,0x44,0x24,0x19,0x32,0x6A,0xB6,0x45,0x15,0x10,0x8A,0x8C,0x63,0x18,
+    0xC5,0xE1,0x0B,0xBE,0x11,0x11,0x1F,0x19,0x08,0x42,0x60,0x84,0x21,0x07,0xFF,0xF0,0x42,0x10,0x83,0x21,0x08,0x4C,0x39,0x9C,
+    0xAC,0x32,0x11,0xE4,0x21,0x08,0x42,0x62,0xDB,0x52,0x13,0xE4,0x21,0x08,0x42,0x10,0x9F,0x27,0xC8,0x42,0x10,0x8A,0x88,0x92,
+    0x50,0x42,0x0A,0xCB,0x02,0x84,0x3D,0x0C,0x0C,0x0C,0x0C,0x2F,0x15,0x11,0x6F,0x22,0x44,0xE9,0x12,0x24,0x37,0x50,0x8F,0xC1,
+    0x08,0x42,0x10,0x83,0xFA,0x56,0xAA,0x55,0x5A,0x23,0xBE,0xE2,0x7F,0xFA,0xD7,0x74,0xE9,0x52,0xA8,0x80,0x7C,0x18,0x20,0xFA,
+    0x22,0xA3,0x69,0x33,0xE4,0x49,0x6C,0xA2,0x03,0xE1,0x11,0x11,0xF2,0x80,0x20,0xC1,0x44,0x50,0x40,0x81,0x17,0xE4,0x75,0x69,
+    0x4A,0xB8,0x86,0x42,0x3C,0x84,0x43,0xF0,0x5F,0x22,0x44,0x89,0xF4,0x18,0x30,0x51,0x14,0x10,0xF8,0x40,0x8F,0xBE,0xE8,0xC1,
+    0x8A,0x30,0x62,0xEA,0xFA,0x0C,0xDA,0x34,0x66,0xC1,0x7C,0xC2,0xF2,0xE5,0x55,0x14,0x5F,0x11,0x17,0xD0,0x6C,0xD5,0xB3,0x56,
+    0x0B,0xEF,0xED,0x32,0xC4,0x27,0xC8,0x40,0x7F,0x84,0x93,0xF8,0x58,0x79,0x91,0x22,0x44,0x89,0x92,0xD4,0x10,0x1F,0xEB,0xA6,
+    0x8A,0x28,0xA2,0x8A,0xFF,0xEC,0xB2,0x5D,0xA6,0x65,0xA8,0xA2,0xAA,0x81,0x45,0x24,0x94,0x10,0x92,0xD7,0xC4,0x14,0x52,0x49,
+    0x41,0xC8,0xA5,0x24,0xE0,0xB1,0x14,0x68,0x63,0x41,0x22,0xCB,0xD1,0x10,0x04,0x22,0x21,0x17,0x10,0x20,0x06,0x24,0x93,0xD0,
+    0xC3,0x08,0x84,0x00,0x62,0x49,0x3D,0x0C,0x30,0x98,0x90,0x06,0x24,0x93,0xD0,0xC3,0x09,0x4A,0x00,0x62,0x49,0x3D,0x0C,0x30,
+    0xA4,0x01,0x89,0x24,0xF4,0x30,0xC2,0x62,0x49,0x18,0x92,0x4F,0x43,0x0C,0x23,0xCA,0x14,0x4C,0xF2,0x24,0x48,0xE7,0x23,0x04,
+    0x10,0x40,0x89,0xC2,0x08,0x42,0x08,0x0F,0xC2,0x1E,0x84,0x3E,0x22,0x03,0xF0,0x87,0xA1,0x0F,0x91,0x40,0xFC,0x21,0xE8,0x43,
+    0xEA,0x07,0xE1,0x0F,0x42,0x1F,0x44,0x74,0x92,0x5C,0xA1,0xD2,0x49,0x75,0x47,0x49,0x25,0xE8,0xE9,0x24,0xBB,0xC4,0x48,0x7C,
+    0xA1,0x44,0xF0,0xA5,0x00,0xC6,0x9A,0x65,0x96,0x38,0xC8,0x10,0x03,0x12,0x86,0x18,0x52,0x30,0x42,0x00,0x31,0x28,0x61,0x85,
+    0x23,0x0C,0x48,0x03,0x12,0x86,0x18,0x52,0x30,0xA5,0x00,0x31,0x28,0x61,0x85,0x23,0x12,0x00,0xC4,0xA1,0x86,0x14,0x8C,0x8A,
+    0x88,0xA8,0x9A,0x94,0xB2,0xD3,0x4A,0x56,0x10,0x20,0x10,0xC3,0x0C,0x30,0xC2,0xF0,0x84,0x01,0x0C,0x30,0xC3,0x0C,0x2F,0x18,
+    0x90,0x10,0xC3,0x0C,0x30,0xC2,0xF2,0x40,0x43,0x0C,0x30,0xC3,0x0B,0xC1,0x04,0x00,0x83,0x05,0x11,0x41,0x02,0x04,0x42,0x1E,
+    0x8C,0x7D,0x08,0x1C,0x44,0x89,0xE2,0x24,0x28,0x50,0xBE,0x80,0x41,0x01,0xC1,0x7C,0x62,0xF1,0x10,0x0E,0x0B,0xE3,0x17,0x91,
+    0x40,0x70,0x5F,0x18,0xBC,0xAA,0x03,0x82,0xF8,0xC5,0xEA,0x03,0x82,0xF8,0xC5,0xE4,0x51,0x00,0xE0,0xBE,0x31,0x7B,0x61,0x2F,
+    0xE4,0x49,0x7C,0xE8,0xC2,0x11,0x71,0x08,0x84,0x10,0x0E,0x8F,0xE1,0x17,0x11,0x00,0x74,0x7F,0x08,0xB8,0x8A,0x03,0xA3,0xF8,
+    0x45,0xCA,0x03,0xA3,0xF8,0x45,0xD2,0x6A,0xAB,0x1A,0xAA,0xA8,0xC9,0x24,0xA8,0x19,0x24,0x93,0x44,0x50,0xBE,0x31,0x8B,0x95,
+    0x40,0x7A,0x31,0x8C,0x62,0x82,0x01,0xD1,0x8C,0x62,0xE1,0x10,0x0E,0x8C,0x63,0x17,0x11,0x40,0x74,0x63,0x18,0xB8,0xAA,0x03,
+    0xA3,0x18,0xC5,0xCA,0x03,0xA3,0x18,0xC5,0xC4,0x07,0xC0,0x40,0xBA,0x75,0xAE,0x5D,0x04,0x10,0x11,0x8C,0x63,0x17,0x91,0x00,
+    0x8C,0x63,0x18,0xBC,0x8A,0x04,0x63,0x18,0xC5,0xEA,0x04,0x63,0x18,0xC5,0xE2,0x20,0x23,0x18,0xC6,0x2F,0x08,0x5D,0x08,0x7A,
+    0x31,0x8C,0x7D,0x08,0x28,0x11,0x8C,0x63,0x17,0x84,0x2E,
+};
+static const ImFontPrebakedData proggy_clean_13_prebaked = { 13.0f, 10.0f, -4.0f, 1, 223, proggy_clean_13_prebaked_glyphs, proggy_clean_13_prebaked_pixels };
+
+static const ImFontPrebakedData* GetDefaultPrebakedFontData()
+{
+    return &proggy_clean_13_prebaked;
+}
+
 #endif // #ifndef IMGUI_DISABLE
@@ -4,6 +4,9 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'ID3D11ShaderResourceView*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Quad stream support (ImDrawQuad records rendered as instanced quads, without vertices/indices).
+//  [X] Renderer: Signed distance field fonts (ImDrawCmd::SdfText commands rendered with a distance threshold pixel shader).
+//  [X] Renderer: Font atlas scale variants and asynchronous builds (textures of io.Fonts->Variants[] uploaded ahead of use and released once discarded).
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -12,6 +15,12 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: DirectX11: Keep track of created font textures, to release the ones orphaned by ImFontAtlas::Build() and all of them in ImGui_ImplDX11_InvalidateDeviceObjects().
+//  2026-10-19: DirectX11: Added IM_PROFILE_SCOPE() zone in ImGui_ImplDX11_RenderDrawData() (see IMGUI_ENABLE_PROFILER).
+//  2026-10-19: DirectX11: Recreate font texture when io.Fonts->TexID is 0, for ImFontAtlas::BuildAsync().
+//  2026-10-19: DirectX11: Added support for font atlas scale variants, enable ImGuiBackendFlags_RendererHasAtlasVariants flag. Font textures are now released through their TexID.
+//  2026-10-19: DirectX11: Added support for signed distance field fonts, enable ImGuiBackendFlags_RendererHasSdfText flag.
+//  2026-10-19: DirectX11: Added support for quad stream, enable ImGuiBackendFlags_RendererHasQuadStream flag.
 //  2022-10-11: Using 'nullptr' instead of 'NULL' as per our switch to C++11.
 //  2021-06-29: Reorganized backend to pull data from a single structure to facilitate usage with multiple-contexts (all g_XXXX access changed to bd->XXXX).
 //  2021-05-19: DirectX11: Replaced direct access to ImDrawCmd::TextureId with a call to ImDrawCmd::GetTexID(). (will become a requirement)
@@ -50,19 +59,24 @@ struct ImGui_ImplDX11_Data
     IDXGIFactory*               pFactory;
     ID3D11Buffer*               pVB;
     ID3D11Buffer*               pIB;
+    ID3D11Buffer*               pQB;
     ID3D11VertexShader*         pVertexShader;
     ID3D11InputLayout*          pInputLayout;
+    ID3D11VertexShader*         pQuadVertexShader;
+    ID3D11InputLayout*          pQuadInputLayout;
     ID3D11Buffer*               pVertexConstantBuffer;
     ID3D11PixelShader*          pPixelShader;
+    ID3D11PixelShader*          pSdfPixelShader;
     ID3D11SamplerState*         pFontSampler;
-    ID3D11ShaderResourceView*   pFontTextureView;
     ID3D11RasterizerState*      pRasterizerState;
     ID3D11BlendState*           pBlendState;
     ID3D11DepthStencilState*    pDepthStencilState;
     int                         VertexBufferSize;
     int                         IndexBufferSize;
+    int                         QuadBufferSize;
+    ImVector<ID3D11ShaderResourceView*> FontTextureViews; // All font textures we created. Swapped between io.Fonts and its variants, and ImFontAtlas::Build() clears TexID without releasing them.
 
-    ImGui_ImplDX11_Data()       { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = 10000; }
+    ImGui_ImplDX11_Data()       { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = 10000; QuadBufferSize = 2000; }
 };
 
 struct VERTEX_CONSTANT_BUFFER_DX11
@@ -115,9 +129,23 @@ static void ImGui_ImplDX11_SetupRenderState(ImDrawData* draw_data, ID3D11DeviceC
     ctx->RSSetState(bd->pRasterizerState);
 }
 
+// Switch input assembler and vertex shader between indexed triangles (ImDrawCmd::ElemCount) and instanced quads (ImDrawCmd::QuadCount)
+static void ImGui_ImplDX11_SetupPrimitiveState(ID3D11DeviceContext* ctx, bool quad_stream)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    unsigned int stride = quad_stream ? sizeof(ImDrawQuad) : sizeof(ImDrawVert);
+    unsigned int offset = 0;
+    ctx->IASetInputLayout(quad_stream ? bd->pQuadInputLayout : bd->pInputLayout);
+    ctx->IASetVertexBuffers(0, 1, quad_stream ? &bd->pQB : &bd->pVB, &stride, &offset);
+    ctx->IASetPrimitiveTopology(quad_stream ? D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP : D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+    ctx->VSSetShader(quad_stream ? bd->pQuadVertexShader : bd->pVertexShader, nullptr, 0);
+}
+
 // Render function
 void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
 {
+    IM_PROFILE_SCOPE("ImGui_ImplDX11_RenderDrawData");
+
     // Avoid rendering when minimized
     if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
         return;
@@ -153,6 +181,19 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
         if (bd->pd3dDevice->CreateBuffer(&desc, nullptr, &bd->pIB) < 0)
             return;
     }
+    if (draw_data->TotalQuadCount > 0 && (!bd->pQB || bd->QuadBufferSize < draw_data->TotalQuadCount))
+    {
+        if (bd->pQB) { bd->pQB->Release(); bd->pQB = nullptr; }
+        bd->QuadBufferSize = draw_data->TotalQuadCount + 2000;
+        D3D11_BUFFER_DESC desc;
+        memset(&desc, 0, sizeof(D3D11_BUFFER_DESC));
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.ByteWidth = bd->QuadBufferSize * sizeof(ImDrawQuad);
+        desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        if (bd->pd3dDevice->CreateBuffer(&desc, nullptr, &bd->pQB) < 0)
+            return;
+    }
 
     // Upload vertex/index data into a single contiguous GPU buffer
     D3D11_MAPPED_SUBRESOURCE vtx_resource, idx_resource;
@@ -173,6 +214,22 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     ctx->Unmap(bd->pVB, 0);
     ctx->Unmap(bd->pIB, 0);
 
+    // Upload quad stream data (per-instance vertex buffer)
+    if (draw_data->TotalQuadCount > 0)
+    {
+        D3D11_MAPPED_SUBRESOURCE quad_resource;
+        if (ctx->Map(bd->pQB, 0, D3D11_MAP_WRITE_DISCARD, 0, &quad_resource) != S_OK)
+            return;
+        ImDrawQuad* quad_dst = (ImDrawQuad*)quad_resource.pData;
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* cmd_list = draw_data->CmdLists[n];
+            memcpy(quad_dst, cmd_list->QuadBuffer.Data, cmd_list->QuadBuffer.Size * sizeof(ImDrawQuad));
+            quad_dst += cmd_list->QuadBuffer.Size;
+        }
+        ctx->Unmap(bd->pQB, 0);
+    }
+
     // Setup orthographic projection matrix into our constant buffer
     // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
     {
@@ -247,6 +304,9 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
     int global_idx_offset = 0;
     int global_vtx_offset = 0;
+    int global_quad_offset = 0;
+    bool quad_stream_state = false;
+    bool sdf_text_state = false;
     ImVec2 clip_off = draw_data->DisplayPos;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
@@ -259,7 +319,11 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplDX11_SetupRenderState(draw_data, ctx);
+                    quad_stream_state = false;
+                    sdf_text_state = false;
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -278,11 +342,27 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                 // Bind texture, Draw
                 ID3D11ShaderResourceView* texture_srv = (ID3D11ShaderResourceView*)pcmd->GetTexID();
                 ctx->PSSetShaderResources(0, 1, &texture_srv);
-                ctx->DrawIndexed(pcmd->ElemCount, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset);
+                const bool quad_stream = (pcmd->QuadCount != 0);
+                if (quad_stream != quad_stream_state)
+                {
+                    ImGui_ImplDX11_SetupPrimitiveState(ctx, quad_stream);
+                    quad_stream_state = quad_stream;
+                }
+                const bool sdf_text = (pcmd->SdfText != 0);
+                if (sdf_text != sdf_text_state)
+                {
+                    ctx->PSSetShader(sdf_text ? bd->pSdfPixelShader : bd->pPixelShader, nullptr, 0);
+                    sdf_text_state = sdf_text;
+                }
+                if (quad_stream)
+                    ctx->DrawInstanced(4, pcmd->QuadCount, 0, pcmd->QuadOffset + global_quad_offset);
+                else
+                    ctx->DrawIndexed(pcmd->ElemCount, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset);
             }
         }
         global_idx_offset += cmd_list->IdxBuffer.Size;
         global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_quad_offset += cmd_list->QuadBuffer.Size;
     }
 
     // Restore modified DX state
@@ -305,14 +385,14 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     ctx->IASetInputLayout(old.InputLayout); if (old.InputLayout) old.InputLayout->Release();
 }
 
-static void ImGui_ImplDX11_CreateFontsTexture()
+static ID3D11ShaderResourceView* ImGui_ImplDX11_CreateFontTextureView(ImFontAtlas* atlas)
 {
     // Build texture atlas
-    ImGuiIO& io = ImGui::GetIO();
     ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
     unsigned char* pixels;
     int width, height;
-    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    ID3D11ShaderResourceView* pTextureView = nullptr;
 
     // Upload texture to graphics system
     {
@@ -343,12 +423,49 @@ static void ImGui_ImplDX11_CreateFontsTexture()
         srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Texture2D.MipLevels = desc.MipLevels;
         srvDesc.Texture2D.MostDetailedMip = 0;
-        bd->pd3dDevice->CreateShaderResourceView(pTexture, &srvDesc, &bd->pFontTextureView);
+        bd->pd3dDevice->CreateShaderResourceView(pTexture, &srvDesc, &pTextureView);
         pTexture->Release();
     }
+    if (pTextureView)
+        bd->FontTextureViews.push_back(pTextureView);
+    return pTextureView;
+}
+
+static void ImGui_ImplDX11_ReleaseFontTextureView(ImFontAtlas* atlas)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    ID3D11ShaderResourceView* pTextureView = (ID3D11ShaderResourceView*)atlas->TexID;
+    if (pTextureView && bd->FontTextureViews.find_erase_unsorted(pTextureView))
+        pTextureView->Release();
+    atlas->SetTexID(0);
+}
+
+// Release font textures which are not referenced by io.Fonts or its variants anymore, e.g. the previous texture of an atlas rebuilt with ImFontAtlas::Build()
+static void ImGui_ImplDX11_ReleaseUnusedFontTextureViews(ImFontAtlas* atlas)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    for (int n = 0; n < bd->FontTextureViews.Size; n++)
+    {
+        ImTextureID tex_id = (ImTextureID)bd->FontTextureViews[n];
+        bool used = (atlas->TexID == tex_id);
+        for (ImFontAtlasVariant* variant : atlas->Variants)
+            if (variant->Status != ImFontAtlasVariantStatus_Building) // Atlas is written by the worker thread, and never has a texture yet
+                used |= (variant->Atlas->TexID == tex_id);
+        if (!used)
+        {
+            bd->FontTextureViews[n]->Release();
+            bd->FontTextureViews.erase_unsorted(bd->FontTextureViews.Data + n);
+            n--;
+        }
+    }
+}
 
-    // Store our identifier
-    io.Fonts->SetTexID((ImTextureID)bd->pFontTextureView);
+static void ImGui_ImplDX11_CreateFontsTexture()
+{
+    // Upload texture to graphics system and store our identifier
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    io.Fonts->SetTexID((ImTextureID)ImGui_ImplDX11_CreateFontTextureView(io.Fonts));
 
     // Create texture sampler
     // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
@@ -446,6 +563,67 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
         }
     }
 
+    // Create the quad stream vertex shader
+    // Each ImDrawQuad is an instance of a 4 vertices triangle strip, corners are derived from SV_VertexID.
+    {
+        static const char* quadVertexShader =
+            "cbuffer vertexBuffer : register(b0) \
+            {\
+              float4x4 ProjectionMatrix; \
+            };\
+            struct VS_INPUT\
+            {\
+              float2 pos_min : POSITION0;\
+              float2 pos_max : POSITION1;\
+              float2 uv_min  : TEXCOORD0;\
+              float2 uv_max  : TEXCOORD1;\
+              float4 col     : COLOR0;\
+              uint   vtx_id  : SV_VertexID;\
+            };\
+            \
+            struct PS_INPUT\
+            {\
+              float4 pos : SV_POSITION;\
+              float4 col : COLOR0;\
+              float2 uv  : TEXCOORD0;\
+            };\
+            \
+            PS_INPUT main(VS_INPUT input)\
+            {\
+              PS_INPUT output;\
+              float2 corner = float2(input.vtx_id & 1, input.vtx_id >> 1);\
+              output.pos = mul( ProjectionMatrix, float4(lerp(input.pos_min, input.pos_max, corner), 0.f, 1.f));\
+              output.col = input.col;\
+              output.uv  = lerp(input.uv_min, input.uv_max, corner);\
+              return output;\
+            }";
+
+        ID3DBlob* vertexShaderBlob;
+        if (FAILED(D3DCompile(quadVertexShader, strlen(quadVertexShader), nullptr, nullptr, nullptr, "main", "vs_4_0", 0, 0, &vertexShaderBlob, nullptr)))
+            return false;
+        if (bd->pd3dDevice->CreateVertexShader(vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), nullptr, &bd->pQuadVertexShader) != S_OK)
+        {
+            vertexShaderBlob->Release();
+            return false;
+        }
+
+        // Create the input layout (one ImDrawQuad per instance)
+        D3D11_INPUT_ELEMENT_DESC local_layout[] =
+        {
+            { "POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,   0, (UINT)IM_OFFSETOF(ImDrawQuad, Min),   D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            { "POSITION", 1, DXGI_FORMAT_R32G32_FLOAT,   0, (UINT)IM_OFFSETOF(ImDrawQuad, Max),   D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,   0, (UINT)IM_OFFSETOF(ImDrawQuad, UvMin), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            { "TEXCOORD", 1, DXGI_FORMAT_R32G32_FLOAT,   0, (UINT)IM_OFFSETOF(ImDrawQuad, UvMax), D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+            { "COLOR",    0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, (UINT)IM_OFFSETOF(ImDrawQuad, Col),   D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+        };
+        if (bd->pd3dDevice->CreateInputLayout(local_layout, 5, vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), &bd->pQuadInputLayout) != S_OK)
+        {
+            vertexShaderBlob->Release();
+            return false;
+        }
+        vertexShaderBlob->Release();
+    }
+
     // Create the pixel shader
     {
         static const char* pixelShader =
@@ -475,6 +653,39 @@ bool    ImGui_ImplDX11_CreateDeviceObjects()
         pixelShaderBlob->Release();
     }
 
+    // Create the pixel shader for ImDrawCmd::SdfText commands
+    // Texture alpha is a distance to the glyph edge (128/255 on the edge), turned into coverage over about one screen pixel at any scale.
+    {
+        static const char* pixelShader =
+            "struct PS_INPUT\
+            {\
+            float4 pos : SV_POSITION;\
+            float4 col : COLOR0;\
+            float2 uv  : TEXCOORD0;\
+            };\
+            sampler sampler0;\
+            Texture2D texture0;\
+            \
+            float4 main(PS_INPUT input) : SV_Target\
+            {\
+            float dist = texture0.Sample(sampler0, input.uv).a;\
+            float width = max(fwidth(dist) * 0.5, 0.0001);\
+            float4 out_col = input.col;\
+            out_col.a *= smoothstep(128.0 / 255.0 - width, 128.0 / 255.0 + width, dist);\
+            return out_col; \
+            }";
+
+        ID3DBlob* pixelShaderBlob;
+        if (FAILED(D3DCompile(pixelShader, strlen(pixelShader), nullptr, nullptr, nullptr, "main", "ps_4_0", 0, 0, &pixelShaderBlob, nullptr)))
+            return false;
+        if (bd->pd3dDevice->CreatePixelShader(pixelShaderBlob->GetBufferPointer(), pixelShaderBlob->GetBufferSize(), nullptr, &bd->pSdfPixelShader) != S_OK)
+        {
+            pixelShaderBlob->Release();
+            return false;
+        }
+        pixelShaderBlob->Release();
+    }
+
     // Create the blending setup
     {
         D3D11_BLEND_DESC desc;
@@ -528,16 +739,25 @@ void    ImGui_ImplDX11_InvalidateDeviceObjects()
         return;
 
     if (bd->pFontSampler)           { bd->pFontSampler->Release(); bd->pFontSampler = nullptr; }
-    if (bd->pFontTextureView)       { bd->pFontTextureView->Release(); bd->pFontTextureView = nullptr; ImGui::GetIO().Fonts->SetTexID(0); } // We copied data->pFontTextureView to io.Fonts->TexID so let's clear that as well.
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImGui_ImplDX11_ReleaseFontTextureView(atlas);
+    for (ImFontAtlasVariant* variant : atlas->Variants)
+        if (variant->Status != ImFontAtlasVariantStatus_Building)
+            ImGui_ImplDX11_ReleaseFontTextureView(variant->Atlas);
+    ImGui_ImplDX11_ReleaseUnusedFontTextureViews(atlas); // Textures orphaned by ImFontAtlas::Build()
     if (bd->pIB)                    { bd->pIB->Release(); bd->pIB = nullptr; }
     if (bd->pVB)                    { bd->pVB->Release(); bd->pVB = nullptr; }
+    if (bd->pQB)                    { bd->pQB->Release(); bd->pQB = nullptr; }
     if (bd->pBlendState)            { bd->pBlendState->Release(); bd->pBlendState = nullptr; }
     if (bd->pDepthStencilState)     { bd->pDepthStencilState->Release(); bd->pDepthStencilState = nullptr; }
     if (bd->pRasterizerState)       { bd->pRasterizerState->Release(); bd->pRasterizerState = nullptr; }
     if (bd->pPixelShader)           { bd->pPixelShader->Release(); bd->pPixelShader = nullptr; }
+    if (bd->pSdfPixelShader)        { bd->pSdfPixelShader->Release(); bd->pSdfPixelShader = nullptr; }
     if (bd->pVertexConstantBuffer)  { bd->pVertexConstantBuffer->Release(); bd->pVertexConstantBuffer = nullptr; }
     if (bd->pInputLayout)           { bd->pInputLayout->Release(); bd->pInputLayout = nullptr; }
     if (bd->pVertexShader)          { bd->pVertexShader->Release(); bd->pVertexShader = nullptr; }
+    if (bd->pQuadInputLayout)       { bd->pQuadInputLayout->Release(); bd->pQuadInputLayout = nullptr; }
+    if (bd->pQuadVertexShader)      { bd->pQuadVertexShader->Release(); bd->pQuadVertexShader = nullptr; }
 }
 
 bool    ImGui_ImplDX11_Init(ID3D11Device* device, ID3D11DeviceContext* device_context)
@@ -550,6 +770,9 @@ bool    ImGui_ImplDX11_Init(ID3D11Device* device, ID3D11DeviceContext* device_co
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_dx11";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasQuadStream; // We can honor the ImDrawCmd::QuadOffset/QuadCount fields, drawing rectangles and glyphs as instanced quads.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasSdfText;    // We can honor the ImDrawCmd::SdfText field, thresholding signed distance field fonts.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasAtlasVariants; // We can upload and release textures of io.Fonts->Variants[], enabling ImFontAtlas::RequestBakedScale().
 
     // Get factory from device
     IDXGIDevice* pDXGIDevice = nullptr;
@@ -584,7 +807,7 @@ void ImGui_ImplDX11_Shutdown()
     if (bd->pd3dDeviceContext)    { bd->pd3dDeviceContext->Release(); }
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasQuadStream | ImGuiBackendFlags_RendererHasSdfText | ImGuiBackendFlags_RendererHasAtlasVariants);
     IM_DELETE(bd);
 }
 
@@ -593,8 +816,24 @@ void ImGui_ImplDX11_NewFrame()
     ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
     IM_ASSERT(bd != nullptr && "Did you call ImGui_ImplDX11_Init()?");
 
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
     if (!bd->pFontSampler)
         ImGui_ImplDX11_CreateDeviceObjects();
+    else if (!atlas->TexID)
+    {
+        // Atlas got a new texture, e.g. placeholders of ImFontAtlas::BuildAsync(). If it was rebuilt with ImFontAtlas::Build(), the previous texture is not referenced anymore.
+        ImGui_ImplDX11_ReleaseUnusedFontTextureViews(atlas);
+        atlas->SetTexID((ImTextureID)ImGui_ImplDX11_CreateFontTextureView(atlas));
+    }
+
+    // Upload font atlas variants built in the background so the next ImGui::NewFrame() can swap them in, release discarded ones
+    for (ImFontAtlasVariant* variant : atlas->Variants)
+    {
+        if (variant->Status == ImFontAtlasVariantStatus_Ready && !variant->Atlas->TexID)
+            variant->Atlas->SetTexID((ImTextureID)ImGui_ImplDX11_CreateFontTextureView(variant->Atlas));
+        else if (variant->Status == ImFontAtlasVariantStatus_Discarded)
+            ImGui_ImplDX11_ReleaseFontTextureView(variant->Atlas);
+    }
 }
 
 //-----------------------------------------------------------------------------
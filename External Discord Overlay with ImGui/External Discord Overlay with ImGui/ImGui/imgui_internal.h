@@ -62,6 +62,14 @@ Index of this file:
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
 #endif
+#if defined(IMGUI_ENABLE_SSE) && (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
+
+// Interlocked intrinsics for ImAtomicXXX helpers
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -130,12 +138,15 @@ struct ImGuiDataVarInfo;            // Variable information (e.g. to avoid style
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
+struct ImGuiInputRecorder;          // Storage for input recording and replay (StartInputRecording(), LoadInputRecordingFromMemory())
 struct ImGuiInputTextDeactivateData;// Short term storage to backup text of a deactivating InputText() while another is stealing active id
 struct ImGuiLastItemData;           // Status storage for last submitted items
 struct ImGuiLocEntry;               // A localization entry.
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavItemData;            // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiMetricsConfig;          // Storage for ShowMetricsWindow() and DebugNodeXXX() functions
+struct ImGuiMetricsHistory;         // Rolling history of frame timings and work counters for the Metrics window
+struct ImGuiMetricsSeries;          // One series of ImGuiMetricsHistory
 struct ImGuiNextWindowData;         // Storage for SetNextWindow** functions
 struct ImGuiNextItemData;           // Storage for SetNextItem** functions
 struct ImGuiOldColumnData;          // Storage data for a single column for legacy Columns() api
@@ -302,6 +313,14 @@ namespace ImStb
 #endif
 #endif // #ifndef IM_DEBUG_BREAK
 
+// Allocation tracking (enable with '#define IMGUI_ENABLE_ALLOC_TRACKING' in imconfig.h)
+// IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_XXX) attributes every IM_ALLOC() made until the end of the enclosing C++ scope to a subsystem. Compiles to nothing when disabled.
+#ifdef IMGUI_ENABLE_ALLOC_TRACKING
+#define IM_ALLOC_TAG_SCOPE(_TAG)        ImGuiAllocTagScope alloc_tag_scope(_TAG)
+#else
+#define IM_ALLOC_TAG_SCOPE(_TAG)        ((void)0)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Generic helpers
 // Note that the ImXXX helpers functions are lower-level than ImGui functions.
@@ -310,6 +329,7 @@ namespace ImStb
 // - Helpers: Hashing
 // - Helpers: Sorting
 // - Helpers: Bit manipulation
+// - Helpers: Atomics
 // - Helpers: String
 // - Helpers: Formatting
 // - Helpers: UTF-8 <> wchar conversions
@@ -344,6 +364,28 @@ static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v &
 static inline bool      ImIsPowerOfTwo(ImU64 v)         { return v != 0 && (v & (v - 1)) == 0; }
 static inline int       ImUpperPowerOfTwo(int v)        { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 
+// Helpers: Atomics
+// - Only used for data which may be touched from multiple threads, e.g. MemAlloc()/MemFree() called while building ImDrawList on worker threads, ImGuiTextLog queue.
+// - ImAtomicAdd()/ImAtomicLoad() are relaxed (counters only). ImAtomicExchange() is a full barrier, see ImSpinLockAcquire()/ImSpinLockRelease().
+// - ImAtomicLoadPtr() has acquire semantic, ImAtomicStorePtr() has release semantic, ImAtomicExchangePtr() is a full barrier.
+#if defined(_MSC_VER) && !defined(__clang__)
+static inline int       ImAtomicAdd(volatile int* p, int v)         { return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v); }    // Return previous value
+static inline int       ImAtomicLoad(volatile int* p)               { return *p; }                                                          // Plain volatile read: no locked instruction, so it can be polled
+static inline int       ImAtomicExchange(volatile int* p, int v)    { return (int)_InterlockedExchange((volatile long*)p, (long)v); }       // Return previous value
+static inline void*     ImAtomicLoadPtr(void* volatile* p)          { return _InterlockedCompareExchangePointer(p, NULL, NULL); }
+static inline void      ImAtomicStorePtr(void* volatile* p, void* v){ _InterlockedExchangePointer(p, v); }
+static inline void*     ImAtomicExchangePtr(void* volatile* p, void* v) { return _InterlockedExchangePointer(p, v); }                       // Return previous value
+#else
+static inline int       ImAtomicAdd(volatile int* p, int v)         { return __atomic_fetch_add(p, v, __ATOMIC_RELAXED); }                  // Return previous value
+static inline int       ImAtomicLoad(volatile int* p)               { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static inline int       ImAtomicExchange(volatile int* p, int v)    { return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL); }                 // Return previous value
+static inline void*     ImAtomicLoadPtr(void* volatile* p)          { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void      ImAtomicStorePtr(void* volatile* p, void* v){ __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline void*     ImAtomicExchangePtr(void* volatile* p, void* v) { return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL); }             // Return previous value
+#endif
+IMGUI_API void          ImSpinLockAcquire(volatile int* lock);      // Test-and-test-and-set: spin with a CPU pause, then yield the thread while the lock is held
+static inline void      ImSpinLockRelease(volatile int* lock)       { ImAtomicExchange(lock, 0); }
+
 // Helpers: String
 IMGUI_API int           ImStricmp(const char* str1, const char* str2);
 IMGUI_API int           ImStrnicmp(const char* str1, const char* str2, size_t count);
@@ -401,11 +443,27 @@ IMGUI_API bool              ImFileClose(ImFileHandle file);
 IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
 IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API bool              ImFileSeek(ImFileHandle file, ImU64 offset);    // Only used when default file functions are enabled (custom implementations don't need to provide it)
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
+// Helpers: Threads
+// - Only used to build ImFontAtlas variants in the background, see ImFontAtlas::RequestBakedScale().
+// - ImThreadCreate() may return NULL (e.g. IMGUI_DISABLE_THREAD_FUNCTIONS): the caller then runs the function itself.
+typedef void (*ImThreadFunc)(void* user_data);
+#ifdef IMGUI_DISABLE_THREAD_FUNCTIONS
+#define IMGUI_DISABLE_DEFAULT_THREAD_FUNCTIONS
+typedef void* ImThreadHandle;
+static inline ImThreadHandle ImThreadCreate(ImThreadFunc, void*)                    { return NULL; }
+static inline void          ImThreadJoin(ImThreadHandle)                            { }
+#else
+typedef void* ImThreadHandle;
+IMGUI_API ImThreadHandle    ImThreadCreate(ImThreadFunc func, void* user_data);     // Start a thread calling func(user_data)
+IMGUI_API void              ImThreadJoin(ImThreadHandle thread);                    // Wait for the thread to finish and release it
+#endif
+
 // Helpers: Maths
 IM_MSVC_RUNTIME_CHECKS_OFF
 // - Wrapper for standard libs functions. (Note that imgui_demo.cpp does _not_ use them to keep the code easy to copy)
@@ -714,6 +772,55 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: append-only log view, see ImGuiTextLog::Draw()
+// - AddLine()/AddLog() may be called from any thread: lines are pushed to a lock-free multiple-producers single-consumer queue.
+// - Draw()/Clear() must be called from the thread using the ImGui context: they move queued lines into chunks of text.
+// - Memory is bounded: when more than MaxSize bytes are stored, the oldest chunk is dropped and recycled.
+// - Don't move or copy an ImGuiTextLog after the first AddLine() (the queue points to its QueueStub member).
+struct ImGuiTextLogMsg
+{
+    void* volatile      Next;                   // ImGuiTextLogMsg*
+    int                 Len;                    // Text follows the structure
+};
+
+struct ImGuiTextLogChunk
+{
+    ImGuiTextBuffer     Buf;
+    ImGuiTextIndex      LineIndex;
+    int                 LineFirst;              // Number of first line in the log (counting dropped lines)
+};
+
+struct IMGUI_API ImGuiTextLog
+{
+    int                 MaxSize;                // Maximum amount of text stored, in bytes (default: 4 MB)
+    int                 ChunkSize;              // Text is allocated and dropped by chunks (default: 64 KB)
+    int                 IngestMaxMessages;      // Maximum number of queued messages moved by each Draw(), so a burst is spread over several frames (default: 64K)
+    bool                AutoScroll;             // Keep scrolling to the bottom when already at the bottom (default: true)
+    ImGuiTextFilter     Filter;                 // Call Filter.Draw() before Draw() to let user filter lines
+
+    // [Internal]
+    ImGuiTextLogMsg     QueueStub;
+    void* volatile      QueueHead;              // Last pushed message, swapped by producers
+    ImGuiTextLogMsg*    QueueTail;              // Next message to pop, owned by consumer
+    ImVector<ImGuiTextLogChunk*> Chunks;        // Oldest first. Never empty after first Ingest()
+    ImGuiTextLogChunk*  ChunkSpare;             // Last dropped chunk, reused for next one
+    int                 LineCount;              // Total number of lines ever added (counting dropped lines)
+    ImVector<int>       FilteredLines;          // Lines passing Filter, when active
+    ImGuiID             FilterHash;             // Detect changes of Filter.InputBuf
+    int                 DroppedDisplayLines;    // Number of displayed lines dropped since last Draw(), to keep scroll position
+
+    ImGuiTextLog();
+    ~ImGuiTextLog();
+    void                AddLine(const char* text, const char* text_end = NULL);     // Thread-safe. Text containing \n is added as multiple lines.
+    void                AddLog(const char* fmt, ...) IM_FMTARGS(2);                 // Thread-safe
+    void                Clear();
+    void                Draw(const char* str_id, const ImVec2& size = ImVec2(0, 0));
+    void                Ingest(int max_messages = INT_MAX);                         // Move queued lines into chunks (called by Draw())
+    int                 GetLineFirst() const    { return Chunks.Size > 0 ? Chunks[0]->LineFirst : LineCount; }
+    int                 GetLineCount() const    { return LineCount - GetLineFirst(); } // Number of lines stored
+    void                GetLine(int line_n, const char** out_begin, const char** out_end); // 'line_n' in [GetLineFirst(), LineCount)
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -763,9 +870,12 @@ struct IMGUI_API ImDrawListSharedData
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
+    ImVector<ImVec2> CircleUnitVtx;             // Sample points on the unit circle for every segment count requested so far (lazily filled by GetCircleUnitVtx())
+    ImVector<int>   CircleUnitVtxOffsets;       // Offset into CircleUnitVtx[] indexed by segment count, -1 when not computed yet
 
     ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
+    const ImVec2* GetCircleUnitVtx(int num_segments);   // Return 'num_segments' points at angles 2*PI*i/num_segments. Pointer is invalidated by the next call with a new segment count.
 };
 
 struct ImDrawDataBuilder
@@ -1069,6 +1179,36 @@ struct IMGUI_API ImGuiInputTextDeactivatedState
     ImGuiInputTextDeactivatedState()    { memset(this, 0, sizeof(*this)); }
     void    ClearFreeMemory()           { ID = 0; TextA.clear(); }
 };
+
+// Line index for ImGuiInputTextFlags_LargeText: start of each line in wchars and UTF-8 bytes.
+// Lines >= ShiftLine have ShiftW/ShiftA pending to be added, so consecutive edits on a same line only update a few entries.
+struct IMGUI_API ImGuiInputTextLineIndex
+{
+    ImVector<int>       StartsW;        // Start of each line in wchars (StartsW[0] == 0), before applying shift
+    ImVector<int>       StartsA;        // Start of each line in UTF-8 bytes, before applying shift
+    int                 ShiftLine;      // First line affected by ShiftW/ShiftA
+    int                 ShiftW, ShiftA;
+
+    ImGuiInputTextLineIndex()           { ShiftLine = ShiftW = ShiftA = 0; }
+    void    Clear()                     { StartsW.resize(0); StartsA.resize(0); ShiftLine = ShiftW = ShiftA = 0; }
+    int     GetLineCount() const        { return StartsW.Size; }
+    int     GetStartW(int line_n) const { return StartsW[line_n] + (line_n >= ShiftLine ? ShiftW : 0); }
+    int     GetStartA(int line_n) const { return StartsA[line_n] + (line_n >= ShiftLine ? ShiftA : 0); }
+    int     FindLine(int pos_w) const;                              // Return line containing wchar 'pos_w'
+    void    Shift(int line_first, int delta_w, int delta_a);        // Offset starts of lines >= line_first
+    void    InsertLines(int line_n, const int* starts_w, const int* starts_a, int count); // Insert 'count' lines before 'line_n', must be called right after Shift(line_n, ...)
+    void    EraseLines(int line_n, int count);                      // Must be called right after Shift(line_n + count, ...)
+};
+
+// Edit to apply to user buffer for ImGuiInputTextFlags_LargeText
+struct ImGuiInputTextLargeEdit
+{
+    int                 PosA;           // Position in UTF-8 bytes
+    int                 DeleteLenA;
+    int                 InsertLenA;
+    int                 InsertOffset;   // Offset of inserted text in ImGuiInputTextState::LargeEditsText
+};
+
 // Internal state of the currently focused/edited text input box
 // For a given item ID, access with ImGui::GetInputTextState()
 struct IMGUI_API ImGuiInputTextState
@@ -1089,9 +1229,17 @@ struct IMGUI_API ImGuiInputTextState
     bool                    Edited;                 // edited this frame
     ImGuiInputTextFlags     Flags;                  // copy of InputText() flags. may be used to check if e.g. ImGuiInputTextFlags_Password is set.
 
+    // ImGuiInputTextFlags_LargeText only (otherwise GapStart == GapEnd == 0)
+    int                     GapStart, GapEnd;       // TextW is a gap buffer: character n is stored at TextW[n] if n < GapStart, TextW[n + GapEnd - GapStart] otherwise. No zero-terminator.
+    ImGuiInputTextLineIndex Lines;                  // start of each line
+    ImVector<ImGuiInputTextLargeEdit> LargeEdits;   // edits not applied to user buffer yet
+    ImVector<char>          LargeEditsText;         // UTF-8 text inserted by LargeEdits
+    bool                    LargeBufInSync;         // user buffer matches our text up to LargeEdits (false when it had to be re-encoded, e.g. invalid UTF-8)
+
     ImGuiInputTextState()                   { memset(this, 0, sizeof(*this)); }
     void        ClearText()                 { CurLenW = CurLenA = 0; TextW[0] = 0; TextA[0] = 0; CursorClamp(); }
-    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); }
+    void        ClearFreeMemory()           { TextW.clear(); TextA.clear(); InitialTextA.clear(); Lines.StartsW.clear(); Lines.StartsA.clear(); LargeEdits.clear(); LargeEditsText.clear(); }
+    ImWchar     GetCharW(int idx) const     { return idx < GapStart ? TextW.Data[idx] : idx < CurLenW ? TextW.Data[idx + GapEnd - GapStart] : 0; }
     int         GetUndoAvailCount() const   { return Stb.undostate.undo_point; }
     int         GetRedoAvailCount() const   { return STB_TEXTEDIT_UNDOSTATECOUNT - Stb.undostate.redo_point; }
     void        OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
@@ -1310,6 +1458,25 @@ struct ImGuiInputEvent
     ImGuiInputEvent() { memset(this, 0, sizeof(*this)); }
 };
 
+// Storage for StartInputRecording() and LoadInputRecordingFromMemory(). Format is described in imgui.cpp.
+struct ImGuiInputRecorder
+{
+    bool                    Recording;
+    bool                    Replaying;
+    ImU32                   NextEventId;        // Events with an EventId >= this value were submitted since the last NewFrame()
+    int                     RecordFramesCount;
+    ImVec2                  RecordDisplaySize;  // Last io.DisplaySize written, only stored when it changes
+    ImGuiTextBuffer         RecordData;         // Recorded frames, without header
+    int                     ReplayFramesCount;
+    int                     ReplayFrameIdx;
+    int                     ReplayOffset;       // Offset of next frame in ReplayData
+    ImVec2                  ReplayDisplaySize;  // Applied to io.DisplaySize on every replayed frame
+    ImGuiTextBuffer         ReplayData;         // Frames being replayed, without header (validated when loaded)
+    ImGuiTextBuffer         SaveBuf;            // Output of SaveInputRecordingToMemory()
+
+    ImGuiInputRecorder()    { Recording = Replaying = false; NextEventId = 0; RecordFramesCount = ReplayFramesCount = ReplayFrameIdx = ReplayOffset = 0; RecordDisplaySize = ReplayDisplaySize = ImVec2(-1.0f, -1.0f); }
+};
+
 // Input function taking an 'ImGuiID owner_id' argument defaults to (ImGuiKeyOwner_Any == 0) aka don't test ownership, which matches legacy behavior.
 #define ImGuiKeyOwner_Any           ((ImGuiID)0)    // Accept key that have an owner, UNLESS a call to SetKeyOwner() explicitly used ImGuiInputFlags_LockThisFrame or ImGuiInputFlags_LockUntilRelease.
 #define ImGuiKeyOwner_None          ((ImGuiID)-1)   // Require key to have no owner.
@@ -1424,10 +1591,12 @@ struct ImGuiListClipperData
     float                           LossynessOffset;
     int                             StepNo;
     int                             ItemsFrozen;
+    int                             MeasureItem;        // Variable height: item submitted by the last Step() which is measured by the next one, or -1
+    float                           MeasureStartPosY;   // Variable height: cursor position before submitting MeasureItem
     ImVector<ImGuiListClipperRange> Ranges;
 
-    ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); MeasureItem = -1; }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; MeasureItem = -1; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -1589,6 +1758,7 @@ struct ImGuiViewportP : public ImGuiViewport
 {
     int                 DrawListsLastFrame[2];  // Last frame number the background (0) and foreground (1) draw lists were used
     ImDrawList*         DrawLists[2];           // Convenience background (0) and foreground (1) draw lists. We use them to draw software mouser cursor when io.MouseDrawCursor is set and to draw most debug overlays.
+    ImVector<ImDrawList*> DrawListsAppended[2]; // Draw lists rendered right after the background (0) and foreground (1) draw lists, see AppendBackgroundDrawList()/AppendForegroundDrawList(). Cleared along with DrawLists[].
     ImDrawData          DrawDataP;
     ImDrawDataBuilder   DrawDataBuilder;
 
@@ -1626,11 +1796,40 @@ struct ImGuiWindowSettings
     bool        Collapsed;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
     bool        WantDelete;     // Set to invalidate/delete the settings entry
+    bool        WantSave;       // Set when our .ini section needs to be rewritten (we are in g.SettingsWindowsDirty)
+    int         IniSection;     // Index+1 of our section in g.SettingsIniSections, 0 if none
+    int         BinaryOffset;   // Offset of our record in g.SettingsBinaryData, 0 if none
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
     char* GetName()             { return (char*)(this + 1); }
 };
 
+// Range of g.SettingsIniData written for one settings entry (e.g. "[Window][Name]" and its lines)
+// Sections are stored in text order, modifying one of them only reformats that entry and shifts the following ones.
+struct ImGuiSettingsIniSection
+{
+    int         Offset;
+    int         Size;           // 0 for a removed section
+};
+
+// Binary settings data (io.IniBinaryFilename): a ImGuiSettingsBinaryHeader followed by records.
+// Each record is a ImGuiSettingsBinaryRecord followed by 'Size' bytes of handler data, padded to 4 bytes.
+// A record modified without changing its size is patched in place, otherwise it is killed (TypeHash = 0) and a new one is appended.
+#define IMGUI_SETTINGS_BINARY_VERSION   1
+
+struct ImGuiSettingsBinaryHeader
+{
+    char        Magic[4];       // "IMGB"
+    ImU32       Version;        // IMGUI_SETTINGS_BINARY_VERSION
+};
+
+struct ImGuiSettingsBinaryRecord
+{
+    ImGuiID     TypeHash;       // == ImGuiSettingsHandler::TypeHash, 0 for a killed record
+    ImGuiID     ID;             // Entry identifier (e.g. window or table ID)
+    ImU32       Size;           // Size of data following this header, excluding padding
+};
+
 struct ImGuiSettingsHandler
 {
     const char* TypeName;       // Short description stored in .ini file. Disallowed characters: '[' ']'
@@ -1641,7 +1840,12 @@ struct ImGuiSettingsHandler
     void        (*ReadLineFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, void* entry, const char* line); // Read: Called for every line of text within an ini entry
     void        (*ApplyAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                                // Read: Called after reading (in registration order)
     void        (*WriteAllFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* out_buf);      // Write: Output every entries into 'out_buf'
+    void        (*WriteDirtyFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                              // Write: Call SettingsIniWriteSection() for entries modified since last write (all entries when g.SettingsIniRebuild is set). Optional: WriteAllFn output is stored as a single section otherwise.
+    void        (*ReadBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler, int record_offset, ImGuiID id, const void* data, int data_size); // Read: Called for every binary record of this type. Optional: handlers without it get their WriteAllFn output stored as a single text record.
+    void        (*WriteBinaryFn)(ImGuiContext* ctx, ImGuiSettingsHandler* handler);                             // Write: Call SettingsBinaryWriteRecord()/SettingsBinaryKillRecord() for every entry
     void*       UserData;
+    int         IniSection;     // [Internal] Index+1 of the section in g.SettingsIniSections, for handlers without WriteDirtyFn
+    int         BinaryOffset;   // [Internal] Offset of the text record in g.SettingsBinaryData, for handlers without WriteBinaryFn
 
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
@@ -1696,11 +1900,59 @@ struct ImGuiMetricsConfig
     bool        ShowWindowsRects = false;
     bool        ShowWindowsBeginOrder = false;
     bool        ShowTablesRects = false;
+    bool        DisableTablesLayoutCache = false;
     bool        ShowDrawCmdMesh = true;
     bool        ShowDrawCmdBoundingBoxes = true;
     bool        ShowAtlasTintedWithTextColor = false;
     int         ShowWindowsRectsType = -1;
     int         ShowTablesRectsType = -1;
+    int         ProfilerFrameIdx = -1;          // Frame displayed by DebugNodeProfiler(), -1 for the most recent one
+};
+
+// Series recorded by ImGuiMetricsHistory, followed by one series per profiler zone name (requires IMGUI_ENABLE_PROFILER)
+enum ImGuiMetricsSeriesBuiltin_
+{
+    ImGuiMetricsSeriesBuiltin_FrameTime,        // io.DeltaTime, in ms. Wall clock time: includes waiting on vsync and time spent outside of Dear ImGui
+    ImGuiMetricsSeriesBuiltin_BuildTime,        // From NewFrame() to Render(), in ms (requires IMGUI_ENABLE_PROFILER)
+    ImGuiMetricsSeriesBuiltin_Vertices,         // io.MetricsRenderVertices
+    ImGuiMetricsSeriesBuiltin_Indices,          // io.MetricsRenderIndices
+    ImGuiMetricsSeriesBuiltin_DrawCmds,         // Draw commands in the main viewport ImDrawData
+    ImGuiMetricsSeriesBuiltin_Allocs,           // MemAlloc() calls
+    ImGuiMetricsSeriesBuiltin_COUNT
+};
+
+// One value per frame, displayed as percentiles and plot in the Metrics window
+struct ImGuiMetricsSeries
+{
+    const char*         Name;                   // Zone series: name of the profiler zone, stored by pointer
+    bool                IsTime;                 // Values are in ms
+    ImGuiPlotBuffer     Values;                 // Last ImGuiMetricsHistory::Capacity frames, all series have the same number of values
+    float               RegressionThreshold;    // Values above this are counted as spikes and logged (0.0f: disabled)
+    int                 RegressionCount;        // Number of spikes since the history was (re)started
+    int                 RegressionLastFrame;
+    float               RegressionLastValue;
+    float               Percentiles[4];         // p50, p95, p99, max over ImGuiMetricsHistory::WindowSeconds (updated a few times per second)
+
+    ImGuiMetricsSeries()                        { Name = NULL; IsTime = false; RegressionThreshold = 0.0f; RegressionCount = RegressionLastFrame = 0; RegressionLastValue = 0.0f; memset(Percentiles, 0, sizeof(Percentiles)); }
+};
+
+// Rolling history of frame timings and work counters, to catch intermittent hitches in long sessions.
+// Recording starts the first time the Metrics window is displayed, and continues after it is closed.
+struct ImGuiMetricsHistory
+{
+    int                 Enabled;                // Read by MemAlloc() from any thread: only set once, with ImAtomicExchange()
+    int                 Capacity;               // Frames kept in each series
+    float               WindowSeconds;          // Duration covered by percentiles
+    ImVector<ImGuiMetricsSeries> Series;        // ImGuiMetricsSeriesBuiltin_COUNT builtin series, then zone series
+    ImGuiStorage        ZoneSeriesMap;          // Zone name pointer hash -> index in Series[]
+    ImGuiStorage        ZoneSeriesNameMap;      // Zone name hash -> index in Series[]
+    ImVector<float>     ZoneTotals;             // [Internal] Per-frame accumulator
+    ImVector<float>     SortBuffer;             // [Internal] Values sorted to get percentiles
+    double              PercentilesTime;        // Value of g.Time when Percentiles[] were last computed
+    int                 PercentilesFrames;      // Number of frames covered by Percentiles[]
+    int                 FrameAllocCount;        // MemAlloc() calls since last NewFrame(), updated atomically. Only counted while Enabled.
+
+    ImGuiMetricsHistory()                       { Enabled = false; Capacity = 3600; WindowSeconds = 10.0f; PercentilesTime = -1.0; PercentilesFrames = 0; FrameAllocCount = 0; }
 };
 
 struct ImGuiStackLevelInfo
@@ -1714,6 +1966,26 @@ struct ImGuiStackLevelInfo
     ImGuiStackLevelInfo()   { memset(this, 0, sizeof(*this)); }
 };
 
+// Helper for IM_ALLOC_TAG_SCOPE(): set the allocation tag of the calling thread, restore previous one on destruction
+struct IMGUI_API ImGuiAllocTagScope
+{
+    ImGuiAllocTag           BackupTag;
+
+    ImGuiAllocTagScope(ImGuiAllocTag tag);
+    ~ImGuiAllocTagScope();
+};
+
+// Eviction candidate for GcCompactTransientBuffersToBudget()
+struct ImGuiGcCandidate
+{
+    float                   LastTimeActive;             // Sort key: least recently active evicted first
+    int                     Type;
+    void*                   Ptr;                        // ImGuiWindow*, ImGuiTable*, ImGuiTableTempData* or ImGuiInputTextState* depending on Type
+    size_t                  Size;                       // Bytes freed by compacting this candidate
+
+    ImGuiGcCandidate(float last_time_active, int type, void* ptr, size_t size) { LastTimeActive = last_time_active; Type = type; Ptr = ptr; Size = size; }
+};
+
 // State for Stack tool queries
 struct ImGuiStackTool
 {
@@ -1767,6 +2039,10 @@ struct ImGuiContext
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
     bool                    WithinEndChild;                     // Set within EndChild()
     bool                    GcCompactAll;                       // Request full GC
+    int                     GcReclaimedCount;                   // Number of transient buffers compactions performed (timer or budget)
+    ImU64                   GcReclaimedBytes;                   // Total bytes freed by transient buffers compactions
+    size_t                  GcTransientBytes;                   // Transient buffers size measured by last budget pass (only when io.ConfigMemoryCompactBudget > 0)
+    ImVector<ImGuiGcCandidate> GcCandidates;                    // [Internal] Reused storage for GcCompactTransientBuffersToBudget()
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     void*                   TestEngine;                         // Test engine user data
 
@@ -1775,6 +2051,7 @@ struct ImGuiContext
     ImVector<ImGuiInputEvent> InputEventsTrail;                 // Past input events processed in NewFrame(). This is to allow domain-specific application to access e.g mouse/pen trail.
     ImGuiMouseSource        InputEventsNextMouseSource;
     ImU32                   InputEventsNextEventId;
+    ImGuiInputRecorder      InputRecorder;                      // See StartInputRecording(), LoadInputRecordingFromMemory()
 
     // Windows state
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
@@ -1842,6 +2119,9 @@ struct ImGuiContext
     ImGuiNextItemData       NextItemData;                       // Storage for SetNextItem** functions
     ImGuiLastItemData       LastItemData;                       // Storage for last submitted item (setup by ItemAdd)
     ImGuiNextWindowData     NextWindowData;                     // Storage for SetNextWindow** functions
+    ImU32                   StyleColorsU32[ImGuiCol_COUNT];     // Cache for GetColorU32(idx): Style.Colors[] with StyleColorsU32Alpha applied, packed
+    ImU64                   StyleColorsU32Valid;                // One bit per valid entry of StyleColorsU32[]. Cleared by NewFrame(), GetStyle(), PushStyleColor(), PopStyleColor()
+    float                   StyleColorsU32Alpha;                // Style.Alpha applied to StyleColorsU32[] (whole cache is invalidated when it changes)
 
     // Shared stacks
     ImVector<ImGuiColorMod> ColorStack;                         // Stack for PushStyleColor()/PopStyleColor() - inherited by Begin()
@@ -1996,9 +2276,21 @@ struct ImGuiContext
     bool                    SettingsLoaded;
     float                   SettingsDirtyTimer;                 // Save .ini Settings to memory when time reaches zero
     ImGuiTextBuffer         SettingsIniData;                    // In memory .ini settings
+    ImVector<ImGuiSettingsIniSection>   SettingsIniSections;    // Sections of SettingsIniData, in text order
+    int                     SettingsIniDeadSections;            // Number of removed sections, triggers a rebuild when larger than live ones
+    bool                    SettingsIniRebuild;                 // Set to rewrite all sections on next SaveIniSettingsToMemory() (e.g. after loading)
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiStorage                        SettingsWindowsById;    // Map ID -> offset+1 of first entry with this ID in SettingsWindows
+    ImGuiStorage                        SettingsTablesById;     // Map ID -> offset+1 of first entry with this ID in SettingsTables
+    ImVector<int>                       SettingsWindowsDirty;   // Offsets in SettingsWindows of entries with WantSave set
+    ImVector<int>                       SettingsTablesDirty;    // Offsets in SettingsTables of entries with WantSave set
+    ImVector<char>          SettingsBinaryData;                 // In memory binary settings, mirror of the last loaded/saved file
+    ImVector<int>           SettingsBinaryDirty;                // Offsets of records modified since the last write to disk (offsets >= SettingsBinaryDiskSize are appended instead)
+    int                     SettingsBinaryDiskSize;             // Size of SettingsBinaryData when last loaded/written from/to disk, -1 if the file needs a full rewrite
+    int                     SettingsBinaryDeadSize;             // Bytes used by killed records, triggers a compaction when larger than live data
+    bool                    SettingsBinaryRebuild;              // Set while rewriting all records into an empty SettingsBinaryData
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2030,6 +2322,8 @@ struct ImGuiContext
     ImGuiID                 DebugItemPickerBreakId;             // Will call IM_DEBUG_BREAK() when encountering this ID
     ImGuiMetricsConfig      DebugMetricsConfig;
     ImGuiStackTool          DebugStackTool;
+    ImGuiProfiler           DebugProfiler;                      // Zones recorded with IM_PROFILE_SCOPE() (requires IMGUI_ENABLE_PROFILER)
+    ImGuiMetricsHistory     DebugMetricsHistory;
 
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
@@ -2056,6 +2350,9 @@ struct ImGuiContext
         FrameCountEnded = FrameCountRendered = -1;
         WithinFrameScope = WithinFrameScopeWithImplicitWindow = WithinEndChild = false;
         GcCompactAll = false;
+        GcReclaimedCount = 0;
+        GcReclaimedBytes = 0;
+        GcTransientBytes = 0;
         TestEngineHookItems = false;
         TestEngine = NULL;
 
@@ -2175,6 +2472,9 @@ struct ImGuiContext
         ScrollbarClickDeltaToGrabCenter = 0.0f;
         DisabledAlphaBackup = 0.0f;
         DisabledStackSize = 0;
+        memset(StyleColorsU32, 0, sizeof(StyleColorsU32));
+        StyleColorsU32Valid = 0;
+        StyleColorsU32Alpha = 1.0f;
         TooltipOverrideCount = 0;
 
         PlatformImeData.InputPos = ImVec2(0.0f, 0.0f);
@@ -2183,6 +2483,11 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsIniDeadSections = 0;
+        SettingsIniRebuild = true;
+        SettingsBinaryDiskSize = -1;
+        SettingsBinaryDeadSize = 0;
+        SettingsBinaryRebuild = false;
         HookIdNext = 0;
 
         memset(LocalizationTable, 0, sizeof(LocalizationTable));
@@ -2354,6 +2659,7 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImVector<ImDrawList*>   DrawListsAppended;                  // Draw lists built elsewhere (e.g. on worker threads) rendered after DrawList, see AppendWindowDrawList(). Cleared on the first Begin() of the frame.
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup _or_ docked window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            ParentWindowInBeginStack;
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window. Doesn't cross through popups/dock nodes.
@@ -2477,7 +2783,38 @@ struct IMGUI_API ImGuiTabBar
 typedef ImS16 ImGuiTableColumnIdx;
 typedef ImU16 ImGuiTableDrawChannelIdx;
 
-// [Internal] sizeof() ~ 112
+// [Internal] Inputs of the widths solving step of TableUpdateLayout(), compared with the values used by the last solve to skip it
+// when nothing changed. Always cleared with memset() before being filled so structures can be compared with memcmp().
+struct ImGuiTableColumnLayoutKey
+{
+    ImGuiTableColumnFlags   Flags;                          // Flags as submitted by TableSetupColumn(), excluding status flags
+    float                   WidthRequest;
+    float                   WidthAuto;                      // Value of WidthAuto fed to the solve (from TableGetColumnWidthAuto() unless IsPreserveWidthAuto)
+    float                   StretchWeight;
+    float                   InitStretchWeightOrWidth;
+    ImGuiTableColumnIdx     DisplayOrder;
+    bool                    IsEnabled;
+    bool                    IsPreserveWidthAuto;
+    bool                    IsRequestOutput;
+
+    ImGuiTableColumnLayoutKey() { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImGuiTableLayoutKey
+{
+    ImGuiTableFlags         Flags;
+    int                     ColumnsCount;                   // 0 when no solve has been stored yet
+    float                   WidthAvail;
+    float                   MinColumnWidth;
+    float                   CellPaddingX;
+    float                   CellSpacingX1;
+    float                   CellSpacingX2;
+    float                   OuterPaddingX;
+
+    ImGuiTableLayoutKey()   { memset(this, 0, sizeof(*this)); }
+};
+
+// [Internal] sizeof() ~ 144
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
 // We use the terminology "Clipped" to refer to a column that is out of sight because of scrolling/clipping.
 // This is in contrast with some user-facing api such as IsItemVisible() / IsRectVisible() which use "Visible" to mean "not clipped".
@@ -2500,6 +2837,8 @@ struct ImGuiTableColumn
     float                   ContentMaxXUnfrozen;
     float                   ContentMaxXHeadersUsed;         // Contents maximum position for headers rows (regardless of freezing). TableHeader() automatically softclip itself + report ideal desired size, to avoid creating extraneous draw calls
     float                   ContentMaxXHeadersIdeal;
+    float                   WidthGivenLayout;               // WidthGiven as output by the widths solving step of TableUpdateLayout(), before it gets clamped to the table bounds. Restored when reusing the solve.
+    ImGuiTableColumnLayoutKey LayoutKey;                    // Inputs of the last widths solve
     ImS16                   NameOffset;                     // Offset into parent ColumnsNames[]
     ImGuiTableColumnIdx     DisplayOrder;                   // Index within Table's IndexToDisplayOrder[] (column may be reordered by users)
     ImGuiTableColumnIdx     IndexWithinEnabledSet;          // Index within enabled/visible set (<= IndexToDisplayOrder)
@@ -2621,6 +2960,7 @@ struct IMGUI_API ImGuiTable
     ImDrawListSplitter*         DrawSplitter;               // Shortcut to TempData->DrawSplitter while in table. Isolate draw commands per columns to avoid switching clip rect constantly
     ImGuiTableInstanceData      InstanceDataFirst;
     ImVector<ImGuiTableInstanceData>    InstanceDataExtra;  // FIXME-OPT: Using a small-vector pattern would be good.
+    ImGuiTableLayoutKey         LayoutKey;                  // Inputs of the last widths solve in TableUpdateLayout(), along with ImGuiTableColumn::LayoutKey
     ImGuiTableColumnSortSpecs   SortSpecsSingle;
     ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
@@ -2650,6 +2990,7 @@ struct IMGUI_API ImGuiTable
     ImGuiTableDrawChannelIdx    Bg2DrawChannelCurrent;      // For Selectable() and other widgets drawing across columns after the freezing line. Index within DrawSplitter.Channels[]
     ImGuiTableDrawChannelIdx    Bg2DrawChannelUnfrozen;
     bool                        IsLayoutLocked;             // Set by TableUpdateLayout() which is called when beginning the first row.
+    bool                        IsLayoutReused;             // Set by TableUpdateLayout() when the widths solve of a previous frame was reused.
     bool                        IsInsideRow;                // Set when inside TableBeginRow()/TableEndRow().
     bool                        IsInitializing;
     bool                        IsSortSpecsDirty;
@@ -2679,6 +3020,7 @@ struct IMGUI_API ImGuiTableTempData
 {
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
     float                       LastTimeActive;             // Last timestamp this structure was used
+    int                         LastFrameActive;            // Last frame this structure was used
 
     ImVec2                      UserOuterSize;              // outer_size.x passed to BeginTable()
     ImDrawListSplitter          DrawSplitter;
@@ -2692,7 +3034,7 @@ struct IMGUI_API ImGuiTableTempData
     float                       HostBackupItemWidth;        // Backup of OuterWindow->DC.ItemWidth at the end of BeginTable()
     int                         HostBackupItemWidthStackSize;//Backup of OuterWindow->DC.ItemWidthStack.Size at the end of BeginTable()
 
-    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; }
+    ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; LastFrameActive = -1; }
 };
 
 // sizeof() ~ 12
@@ -2728,6 +3070,9 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    bool                        WantSave;               // Set when our .ini section needs to be rewritten (we are in g.SettingsTablesDirty)
+    int                         IniSection;             // Index+1 of our section in g.SettingsIniSections, 0 if none
+    int                         BinaryOffset;           // Offset of our record in g.SettingsBinaryData, 0 if none
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -2807,11 +3152,15 @@ namespace ImGui
     IMGUI_API void                  AddSettingsHandler(const ImGuiSettingsHandler* handler);
     IMGUI_API void                  RemoveSettingsHandler(const char* type_name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
+    IMGUI_API void                  SettingsIniWriteSection(int* p_section, const char* text, int text_len);
+    IMGUI_API void                  SettingsBinaryWriteRecord(ImGuiID type_hash, ImGuiID id, int* p_record_offset, const void* data, int data_size);
+    IMGUI_API void                  SettingsBinaryKillRecord(ImGuiID type_hash, ImGuiID id, int* p_record_offset);
 
     // Settings - Windows
     IMGUI_API ImGuiWindowSettings*  CreateNewWindowSettings(const char* name);
     IMGUI_API ImGuiWindowSettings*  FindWindowSettingsByID(ImGuiID id);
     IMGUI_API ImGuiWindowSettings*  FindWindowSettingsByWindow(ImGuiWindow* window);
+    IMGUI_API void                  MarkWindowSettingsDirty(ImGuiWindowSettings* settings);
     IMGUI_API void                  ClearWindowSettings(const char* name);
 
     // Localization
@@ -3043,6 +3392,8 @@ namespace ImGui
     IMGUI_API void          TableBeginApplyRequests(ImGuiTable* table);
     IMGUI_API void          TableSetupDrawChannels(ImGuiTable* table);
     IMGUI_API void          TableUpdateLayout(ImGuiTable* table);
+    IMGUI_API bool          TableUpdateLayoutKey(ImGuiTable* table, float width_avail);
+    IMGUI_API void          TableUpdateLayoutWidths(ImGuiTable* table, float width_avail);
     IMGUI_API void          TableUpdateBorders(ImGuiTable* table);
     IMGUI_API void          TableUpdateColumnsWeightFromWidth(ImGuiTable* table);
     IMGUI_API void          TableDrawBorders(ImGuiTable* table);
@@ -3069,6 +3420,8 @@ namespace ImGui
     IMGUI_API void          TableRemove(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTable* table);
     IMGUI_API void          TableGcCompactTransientBuffers(ImGuiTableTempData* table);
+    IMGUI_API size_t        TableGcCalcTransientBuffersSize(ImGuiTable* table);
+    IMGUI_API size_t        TableGcCalcTransientBuffersSize(ImGuiTableTempData* table);
     IMGUI_API void          TableGcCompactSettings();
 
     // Tables: Settings
@@ -3079,6 +3432,7 @@ namespace ImGui
     IMGUI_API void                  TableSettingsAddSettingsHandler();
     IMGUI_API ImGuiTableSettings*   TableSettingsCreate(ImGuiID id, int columns_count);
     IMGUI_API ImGuiTableSettings*   TableSettingsFindByID(ImGuiID id);
+    IMGUI_API void                  TableSettingsMarkDirty(ImGuiTableSettings* settings);
 
     // Tab Bars
     inline    ImGuiTabBar*  GetCurrentTabBar() { ImGuiContext& g = *GImGui; return g.CurrentTabBar; }
@@ -3186,6 +3540,7 @@ namespace ImGui
 
     // Plot
     IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3195,6 +3550,9 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API void          GcCompactTransientBuffersToBudget(size_t budget);
+    IMGUI_API size_t        GcCalcTransientWindowBuffersSize(ImGuiWindow* window);
+    IMGUI_API size_t        GcCalcDrawListSplitterSize(const ImDrawListSplitter* splitter);
 
     // Debug Log
     IMGUI_API void          DebugLog(const char* fmt, ...) IM_FMTARGS(1);
@@ -3211,6 +3569,10 @@ namespace ImGui
     inline void             DebugStartItemPicker()                                  { ImGuiContext& g = *GImGui; g.DebugItemPickerActive = true; }
     IMGUI_API void          ShowFontAtlas(ImFontAtlas* atlas);
     IMGUI_API void          DebugHookIdInfo(ImGuiID id, ImGuiDataType data_type, const void* data_id, const void* data_id_end);
+    IMGUI_API void          DebugNodeAllocStats(const ImGuiAllocStats* stats);
+    IMGUI_API void          DebugNodeProfiler(ImGuiProfiler* profiler);
+    IMGUI_API void          DebugNodeMetricsHistory(ImGuiMetricsHistory* history);
+    IMGUI_API void          DebugNodeInputRecorder(ImGuiInputRecorder* rec);
     IMGUI_API void          DebugNodeColumns(ImGuiOldColumns* columns);
     IMGUI_API void          DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list, const char* label);
     IMGUI_API void          DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, const ImDrawList* draw_list, const ImDrawCmd* draw_cmd, bool show_mesh, bool show_aabb);
@@ -3259,9 +3621,31 @@ struct ImFontBuilderIO
     bool    (*FontBuilder_Build)(ImFontAtlas* atlas);
 };
 
+// Pre-rasterized glyphs of a font source, loaded by the stb_truetype builder without parsing or rasterizing TTF data.
+// The default font is embedded this way, see AddFontDefault(). Use ImFontAtlasBuildWritePrebakedFont() to generate the C source.
+// Other builders get the TTF data the glyphs were baked from instead (only supported for the default font).
+struct ImFontPrebakedGlyph
+{
+    ImU16                       Codepoint;
+    ImU8                        Width, Height;  // Bitmap size
+    ImS8                        X0, Y0;         // Bitmap offset from the glyph origin on the baseline
+    float                       AdvanceX;
+};
+
+struct ImFontPrebakedData
+{
+    float                       SizePixels;     // Baked with this size and OversampleH = OversampleV = 1
+    float                       Ascent, Descent;
+    int                         BitsPerPixel;   // 1 (pixels are 0 or 255) or 8
+    int                         GlyphsCount;
+    const ImFontPrebakedGlyph*  Glyphs;         // Sorted by codepoint
+    const unsigned char*        Pixels;         // Bitmaps in Glyphs[] order, rows of Width pixels. At 1 bit per pixel, bits are contiguous across rows and glyphs, MSB first.
+};
+
 // Helper for font builder
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
 IMGUI_API const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype();
+IMGUI_API bool      ImFontAtlasBuildWritePrebakedFont(const ImFontAtlas* src_atlas, const char* symbol_name, ImGuiTextBuffer* out_buf);
 #endif
 IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
@@ -3271,6 +3655,7 @@ IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas,
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void      ImFontAtlasUpdateVariants(ImFontAtlas* atlas);    // Called by NewFrame(): collect variants built in the background, swap in the requested scale once uploaded by the backend
 
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
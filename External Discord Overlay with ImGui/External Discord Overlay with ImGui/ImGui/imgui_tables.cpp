@@ -153,7 +153,7 @@ Index of this file:
 //-----------------------------------------------------------------------------
 // About clipping/culling of Rows in Tables:
 // - For large numbers of rows, it is recommended you use ImGuiListClipper to submit only visible rows.
-//   ImGuiListClipper is reliant on the fact that rows are of equal height.
+//   ImGuiListClipper is reliant on the fact that rows are of equal height, unless using ImGuiListClipper::BeginVariableHeight().
 //   See 'Demo->Tables->Vertical Scrolling' or 'Demo->Tables->Advanced' for a demo of using the clipper.
 // - Note that auto-resizing columns don't play well with using the clipper.
 //   By default a table with _ScrollX but without _Resizable will have column auto-resize.
@@ -260,6 +260,7 @@ static const int TABLE_DRAW_CHANNEL_NOCLIP = 2;                     // When usin
 static const float TABLE_BORDER_SIZE                     = 1.0f;    // FIXME-TABLE: Currently hard-coded because of clipping assumptions with outer borders rendering.
 static const float TABLE_RESIZE_SEPARATOR_HALF_THICKNESS = 4.0f;    // Extend outside inner borders.
 static const float TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER = 0.06f;   // Delay/timer before making the hover feedback (color+cursor) visible because tables/columns tends to be more cramped.
+static const char* const TABLE_SETTINGS_TYPE_NAME       = "Table";  // Settings handler type name. Its hash is also the type key of binary settings records.
 
 // Helper
 inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_window)
@@ -310,6 +311,7 @@ bool    ImGui::BeginTable(const char* str_id, int columns_count, ImGuiTableFlags
 
 bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImGuiTableFlags flags, const ImVec2& outer_size, float inner_width)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiWindow* outer_window = GetCurrentWindow();
     if (outer_window->SkipItems) // Consistent with other tables + beneficial side effect that assert on miscalling EndTable() will be more visible.
@@ -497,6 +499,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesLastTimeActive.resize(table_idx + 1, -1.0f);
     g.TablesLastTimeActive[table_idx] = (float)g.Time;
     temp_data->LastTimeActive = (float)g.Time;
+    temp_data->LastFrameActive = g.FrameCount;
     table->MemoryCompacted = false;
 
     // Setup memory buffer (clear data if columns count changed)
@@ -743,26 +746,16 @@ static void TableSetupColumnFlags(ImGuiTable* table, ImGuiTableColumn* column, I
 // Increase feedback side-effect with widgets relying on WorkRect.Max.x... Maybe provide a default distribution for _WidthAuto columns?
 void ImGui::TableUpdateLayout(ImGuiTable* table)
 {
+    IM_PROFILE_SCOPE("TableUpdateLayout");
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->IsLayoutLocked == false);
 
-    const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
     table->IsDefaultDisplayOrder = true;
-    table->ColumnsEnabledCount = 0;
-    ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
-    ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
-    table->LeftMostEnabledColumn = -1;
     table->MinColumnWidth = ImMax(1.0f, g.Style.FramePadding.x * 1.0f); // g.Style.ColumnsMinSpacing; // FIXME-TABLE
 
-    // [Part 1] Apply/lock Enabled and Order states. Calculate auto/ideal width for columns. Count fixed/stretch columns.
-    // Process columns in their visible orders as we are building the Prev/Next indices.
-    int count_fixed = 0;                // Number of columns that have fixed sizing policies
-    int count_stretch = 0;              // Number of columns that have stretch sizing policies
-    int prev_visible_column_idx = -1;
+    // [Part 1] Apply/lock Enabled and Order states. Queue auto-fit for unsized columns.
     bool has_auto_fit_request = false;
     bool has_resizable = false;
-    float stretch_sum_width_auto = 0.0f;
-    float fixed_max_width_auto = 0.0f;
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -802,53 +795,14 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             column->AutoFitQueue = column->CannotSkipItemsQueue = (1 << 3) - 1; // Fit for three frames
 
         if (!column->IsEnabled)
-        {
-            column->IndexWithinEnabledSet = -1;
             continue;
-        }
-
-        // Mark as enabled and link to previous/next enabled column
-        column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
-        column->NextEnabledColumn = -1;
-        if (prev_visible_column_idx != -1)
-            table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        else
-            table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
-        column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
-        ImBitArraySetBit(table->EnabledMaskByIndex, column_n);
-        ImBitArraySetBit(table->EnabledMaskByDisplayOrder, column->DisplayOrder);
-        prev_visible_column_idx = column_n;
-        IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
-
-        // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
-        // Combine width from regular rows + width from headers unless requested not to.
-        if (!column->IsPreserveWidthAuto)
-            column->WidthAuto = TableGetColumnWidthAuto(table, column);
-
-        // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
-        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
-        if (column_is_resizable)
-            has_resizable = true;
-        if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && column->InitStretchWeightOrWidth > 0.0f && !column_is_resizable)
-            column->WidthAuto = column->InitStretchWeightOrWidth;
-
         if (column->AutoFitQueue != 0x00)
             has_auto_fit_request = true;
-        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
-        {
-            stretch_sum_width_auto += column->WidthAuto;
-            count_stretch++;
-        }
-        else
-        {
-            fixed_max_width_auto = ImMax(fixed_max_width_auto, column->WidthAuto);
-            count_fixed++;
-        }
+        if ((column->Flags & ImGuiTableColumnFlags_NoResize) == 0)
+            has_resizable = true;
     }
     if ((table->Flags & ImGuiTableFlags_Sortable) && table->SortSpecsCount == 0 && !(table->Flags & ImGuiTableFlags_SortTristate))
         table->IsSortSpecsDirty = true;
-    table->RightMostEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
-    IM_ASSERT(table->LeftMostEnabledColumn >= 0 && table->RightMostEnabledColumn >= 0);
 
     // [Part 2] Disable child window clipping while fitting columns. This is not strictly necessary but makes it possible
     // to avoid the column fitting having to wait until the first visible frame of the child container (may or not be a good thing).
@@ -858,112 +812,29 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     if (has_auto_fit_request)
         table->IsSettingsDirty = true;
 
-    // [Part 3] Fix column flags and record a few extra information.
-    float sum_width_requests = 0.0f;    // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
-    float stretch_sum_weights = 0.0f;   // Sum of all weights for stretch columns.
-    table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
-    {
-        if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
-            continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
-
-        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
-        if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
-        {
-            // Apply same widths policy
-            float width_auto = column->WidthAuto;
-            if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
-                width_auto = fixed_max_width_auto;
-
-            // Apply automatic width
-            // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
-            if (column->AutoFitQueue != 0x00)
-                column->WidthRequest = width_auto;
-            else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && column->IsRequestOutput)
-                column->WidthRequest = width_auto;
-
-            // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
-            // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
-            // large height (= first frame scrollbar display very off + clipper would skip lots of items).
-            // This is merely making the side-effect less extreme, but doesn't properly fixes it.
-            // FIXME: Move this to ->WidthGiven to avoid temporary lossyless?
-            // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
-            if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
-                column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
-            sum_width_requests += column->WidthRequest;
-        }
-        else
-        {
-            // Initialize stretch weight
-            if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
-            {
-                if (column->InitStretchWeightOrWidth > 0.0f)
-                    column->StretchWeight = column->InitStretchWeightOrWidth;
-                else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
-                    column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
-                else
-                    column->StretchWeight = 1.0f;
-            }
-
-            stretch_sum_weights += column->StretchWeight;
-            if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
-                table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
-            if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
-                table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
-        }
-        column->IsPreserveWidthAuto = false;
-        sum_width_requests += table->CellPaddingX * 2.0f;
-    }
-    table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
-    table->ColumnsStretchSumWeights = stretch_sum_weights;
-
-    // [Part 4] Apply final widths based on requested widths
+    // [Part 3] Link enabled columns and solve their widths, or reuse the results of the last solve when none of its inputs changed.
+    // Results are kept in the table/columns: when reusing them we only need to restore WidthGiven (clamped in Part 4) and the resize flag.
+    // Auto-fitting and initializing tables are always solved as their widths converge over several frames.
     const ImRect work_rect = table->WorkRect;
-    const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
     const float width_removed = (table->HasScrollbarYPrev && !table->InnerWindow->ScrollbarY) ? g.Style.ScrollbarSize : 0.0f; // To synchronize decoration width of synched tables with mismatching scrollbar state (#5920)
     const float width_avail = ImMax(1.0f, (((table->Flags & ImGuiTableFlags_ScrollX) && table->InnerWidth == 0.0f) ? table->InnerClipRect.GetWidth() : work_rect.GetWidth()) - width_removed);
-    const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
-    float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
-    table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    const bool layout_key_unchanged = TableUpdateLayoutKey(table, width_avail);
+    table->IsLayoutReused = layout_key_unchanged && !has_auto_fit_request && !table->IsInitializing && !g.DebugMetricsConfig.DisableTablesLayoutCache;
+    if (table->IsLayoutReused)
     {
-        if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
-            continue;
-        ImGuiTableColumn* column = &table->Columns[column_n];
-
-        // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
-        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
-        {
-            float weight_ratio = column->StretchWeight / stretch_sum_weights;
-            column->WidthRequest = IM_FLOOR(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
-            width_remaining_for_stretched_columns -= column->WidthRequest;
-        }
-
-        // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
-        // See additional comments in TableSetColumnWidth().
-        if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
-            column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+        for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+            if (IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
+                table->Columns[column_n].WidthGiven = table->Columns[column_n].WidthGivenLayout;
 
-        // Assign final width, record width in case we will need to shrink
-        column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth));
-        table->ColumnsGivenWidth += column->WidthGiven;
+        // [Resize Rule 1] Flags are resubmitted every frame, see TableUpdateLayoutWidths()
+        if (table->LeftMostStretchedColumn != -1)
+            table->Columns[table->RightMostEnabledColumn].Flags |= ImGuiTableColumnFlags_NoDirectResize_;
     }
-
-    // [Part 5] Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
-    // Using right-to-left distribution (more likely to match resizing cursor).
-    if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
-        for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
-        {
-            if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
-                continue;
-            ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
-            if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
-                continue;
-            column->WidthRequest += 1.0f;
-            column->WidthGiven += 1.0f;
-            width_remaining_for_stretched_columns -= 1.0f;
-        }
+    else
+    {
+        TableUpdateLayoutWidths(table, width_avail);
+    }
+    IM_ASSERT(table->LeftMostEnabledColumn >= 0 && table->RightMostEnabledColumn >= 0);
 
     // Determine if table is hovered which will be used to flag columns as hovered.
     // - In principle we'd like to use the equivalent of IsItemHovered(ImGuiHoveredFlags_AllowWhenBlockedByActiveItem),
@@ -979,7 +850,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     const bool is_hovering_table = ItemHoverable(mouse_hit_rect, 0);
     g.ActiveId = backup_active_id;
 
-    // [Part 6] Setup final position, offset, skip/clip states and clipping rectangles, detect hovered column
+    // [Part 4] Setup final position, offset, skip/clip states and clipping rectangles, detect hovered column
     // Process columns in their visible orders as we are comparing the visible order and adjusting host_clip_rect while looping.
     int visible_n = 0;
     bool offset_x_frozen = (table->FreezeColumnsCount > 0);
@@ -1102,7 +973,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         visible_n++;
     }
 
-    // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
+    // [Part 5] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
     // Clear Resizable flag if none of our column are actually resizable (either via an explicit _NoResize flag, either
     // because of using _WidthAuto/_WidthStretch). This will hide the resizing option from the context menu.
     const float unused_x1 = ImMax(table->WorkRect.Min.x, table->Columns[table->RightMostEnabledColumn].ClipRect.Max.x);
@@ -1114,7 +985,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     if (has_resizable == false && (table->Flags & ImGuiTableFlags_Resizable))
         table->Flags &= ~ImGuiTableFlags_Resizable;
 
-    // [Part 8] Lock actual OuterRect/WorkRect right-most position.
+    // [Part 6] Lock actual OuterRect/WorkRect right-most position.
     // This is done late to handle the case of fixed-columns tables not claiming more widths that they need.
     // Because of this we are careful with uses of WorkRect and InnerClipRect before this point.
     if (table->RightMostStretchedColumn != -1)
@@ -1128,29 +999,29 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     table->BorderX1 = table->InnerClipRect.Min.x;// +((table->Flags & ImGuiTableFlags_BordersOuter) ? 0.0f : -1.0f);
     table->BorderX2 = table->InnerClipRect.Max.x;// +((table->Flags & ImGuiTableFlags_BordersOuter) ? 0.0f : +1.0f);
 
-    // [Part 9] Allocate draw channels and setup background cliprect
+    // [Part 7] Allocate draw channels and setup background cliprect
     TableSetupDrawChannels(table);
 
-    // [Part 10] Hit testing on borders
+    // [Part 8] Hit testing on borders
     if (table->Flags & ImGuiTableFlags_Resizable)
         TableUpdateBorders(table);
     table_instance->LastFirstRowHeight = 0.0f;
     table->IsLayoutLocked = true;
     table->IsUsingHeaders = false;
 
-    // [Part 11] Context menu
+    // [Part 9] Context menu
     if (TableBeginContextMenuPopup(table))
     {
         TableDrawContextMenu(table);
         EndPopup();
     }
 
-    // [Part 12] Sanitize and build sort specs before we have a chance to use them for display.
+    // [Part 10] Sanitize and build sort specs before we have a chance to use them for display.
     // This path will only be exercised when sort specs are modified before header rows (e.g. init or visibility change)
     if (table->IsSortSpecsDirty && (table->Flags & ImGuiTableFlags_Sortable))
         TableSortSpecsBuild(table);
 
-    // [Part 13] Setup inner window decoration size (for scrolling / nav tracking to properly take account of frozen rows/columns)
+    // [Part 11] Setup inner window decoration size (for scrolling / nav tracking to properly take account of frozen rows/columns)
     if (table->FreezeColumnsRequest > 0)
         table->InnerWindow->DecoInnerSizeX1 = table->Columns[table->DisplayOrderToIndex[table->FreezeColumnsRequest - 1]].MaxX - table->OuterRect.Min.x;
     if (table->FreezeRowsRequest > 0)
@@ -1165,6 +1036,214 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         inner_window->DrawList->PushClipRect(inner_window->ClipRect.Min, inner_window->ClipRect.Max, false);
 }
 
+// Store inputs of the widths solving step of TableUpdateLayout(). Return true if they are the same as the ones of the last solve.
+bool ImGui::TableUpdateLayoutKey(ImGuiTable* table, float width_avail)
+{
+    ImGuiTableLayoutKey table_key;
+    table_key.Flags = table->Flags;
+    table_key.ColumnsCount = table->ColumnsCount;
+    table_key.WidthAvail = width_avail;
+    table_key.MinColumnWidth = table->MinColumnWidth;
+    table_key.CellPaddingX = table->CellPaddingX;
+    table_key.CellSpacingX1 = table->CellSpacingX1;
+    table_key.CellSpacingX2 = table->CellSpacingX2;
+    table_key.OuterPaddingX = table->OuterPaddingX;
+    bool unchanged = (memcmp(&table_key, &table->LayoutKey, sizeof(table_key)) == 0);
+    table->LayoutKey = table_key;
+
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    {
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        ImGuiTableColumnLayoutKey column_key;
+        column_key.Flags = column->Flags & ~(ImGuiTableColumnFlags_StatusMask_ | ImGuiTableColumnFlags_NoDirectResize_);
+        column_key.WidthRequest = column->WidthRequest;
+        column_key.StretchWeight = column->StretchWeight;
+        column_key.InitStretchWeightOrWidth = column->InitStretchWeightOrWidth;
+        column_key.DisplayOrder = column->DisplayOrder;
+        column_key.IsEnabled = column->IsEnabled;
+        column_key.IsPreserveWidthAuto = column->IsPreserveWidthAuto;
+        column_key.IsRequestOutput = column->IsRequestOutput;
+        if (column->IsEnabled) // Disabled columns don't use their contents width
+            column_key.WidthAuto = column->IsPreserveWidthAuto ? column->WidthAuto : TableGetColumnWidthAuto(table, column);
+        if (unchanged && memcmp(&column_key, &column->LayoutKey, sizeof(column_key)) != 0)
+            unchanged = false;
+        column->LayoutKey = column_key;
+    }
+    return unchanged;
+}
+
+// Link enabled columns and solve their widths (Part 3 of TableUpdateLayout()).
+// Outputs are stored in the table and columns, where TableUpdateLayout() may reuse them on following frames if TableUpdateLayoutKey() reports no changes.
+void ImGui::TableUpdateLayoutWidths(ImGuiTable* table, float width_avail)
+{
+    const ImGuiTableFlags table_sizing_policy = (table->Flags & ImGuiTableFlags_SizingMask_);
+    table->ColumnsEnabledCount = 0;
+    ImBitArrayClearAllBits(table->EnabledMaskByIndex, table->ColumnsCount);
+    ImBitArrayClearAllBits(table->EnabledMaskByDisplayOrder, table->ColumnsCount);
+    table->LeftMostEnabledColumn = -1;
+
+    // Calculate auto/ideal width for columns. Count fixed/stretch columns.
+    // Process columns in their visible orders as we are building the Prev/Next indices.
+    int count_fixed = 0;                // Number of columns that have fixed sizing policies
+    int count_stretch = 0;              // Number of columns that have stretch sizing policies
+    int prev_visible_column_idx = -1;
+    float stretch_sum_width_auto = 0.0f;
+    float fixed_max_width_auto = 0.0f;
+    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    {
+        const int column_n = table->DisplayOrderToIndex[order_n];
+        ImGuiTableColumn* column = &table->Columns[column_n];
+        if (!column->IsEnabled)
+        {
+            column->IndexWithinEnabledSet = -1;
+            continue;
+        }
+
+        // Mark as enabled and link to previous/next enabled column
+        column->PrevEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
+        column->NextEnabledColumn = -1;
+        if (prev_visible_column_idx != -1)
+            table->Columns[prev_visible_column_idx].NextEnabledColumn = (ImGuiTableColumnIdx)column_n;
+        else
+            table->LeftMostEnabledColumn = (ImGuiTableColumnIdx)column_n;
+        column->IndexWithinEnabledSet = table->ColumnsEnabledCount++;
+        ImBitArraySetBit(table->EnabledMaskByIndex, column_n);
+        ImBitArraySetBit(table->EnabledMaskByDisplayOrder, column->DisplayOrder);
+        prev_visible_column_idx = column_n;
+        IM_ASSERT(column->IndexWithinEnabledSet <= column->DisplayOrder);
+
+        // Calculate ideal/auto column width (that's the width required for all contents to be visible without clipping)
+        // Combine width from regular rows + width from headers unless requested not to.
+        if (!column->IsPreserveWidthAuto)
+            column->WidthAuto = column->LayoutKey.WidthAuto; // Already computed with TableGetColumnWidthAuto() by TableUpdateLayoutKey()
+
+        // Non-resizable columns keep their requested width (apply user value regardless of IsPreserveWidthAuto)
+        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
+        if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && column->InitStretchWeightOrWidth > 0.0f && !column_is_resizable)
+            column->WidthAuto = column->InitStretchWeightOrWidth;
+
+        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+        {
+            stretch_sum_width_auto += column->WidthAuto;
+            count_stretch++;
+        }
+        else
+        {
+            fixed_max_width_auto = ImMax(fixed_max_width_auto, column->WidthAuto);
+            count_fixed++;
+        }
+    }
+    table->RightMostEnabledColumn = (ImGuiTableColumnIdx)prev_visible_column_idx;
+
+    // Fix column flags and record a few extra information.
+    float sum_width_requests = 0.0f;    // Sum of all width for fixed and auto-resize columns, excluding width contributed by Stretch columns but including spacing/padding.
+    float stretch_sum_weights = 0.0f;   // Sum of all weights for stretch columns.
+    table->LeftMostStretchedColumn = table->RightMostStretchedColumn = -1;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    {
+        if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
+            continue;
+        ImGuiTableColumn* column = &table->Columns[column_n];
+
+        const bool column_is_resizable = (column->Flags & ImGuiTableColumnFlags_NoResize) == 0;
+        if (column->Flags & ImGuiTableColumnFlags_WidthFixed)
+        {
+            // Apply same widths policy
+            float width_auto = column->WidthAuto;
+            if (table_sizing_policy == ImGuiTableFlags_SizingFixedSame && (column->AutoFitQueue != 0x00 || !column_is_resizable))
+                width_auto = fixed_max_width_auto;
+
+            // Apply automatic width
+            // Latch initial size for fixed columns and update it constantly for auto-resizing column (unless clipped!)
+            if (column->AutoFitQueue != 0x00)
+                column->WidthRequest = width_auto;
+            else if ((column->Flags & ImGuiTableColumnFlags_WidthFixed) && !column_is_resizable && column->IsRequestOutput)
+                column->WidthRequest = width_auto;
+
+            // FIXME-TABLE: Increase minimum size during init frame to avoid biasing auto-fitting widgets
+            // (e.g. TextWrapped) too much. Otherwise what tends to happen is that TextWrapped would output a very
+            // large height (= first frame scrollbar display very off + clipper would skip lots of items).
+            // This is merely making the side-effect less extreme, but doesn't properly fixes it.
+            // FIXME: Move this to ->WidthGiven to avoid temporary lossyless?
+            // FIXME: This break IsPreserveWidthAuto from not flickering if the stored WidthAuto was smaller.
+            if (column->AutoFitQueue > 0x01 && table->IsInitializing && !column->IsPreserveWidthAuto)
+                column->WidthRequest = ImMax(column->WidthRequest, table->MinColumnWidth * 4.0f); // FIXME-TABLE: Another constant/scale?
+            sum_width_requests += column->WidthRequest;
+        }
+        else
+        {
+            // Initialize stretch weight
+            if (column->AutoFitQueue != 0x00 || column->StretchWeight < 0.0f || !column_is_resizable)
+            {
+                if (column->InitStretchWeightOrWidth > 0.0f)
+                    column->StretchWeight = column->InitStretchWeightOrWidth;
+                else if (table_sizing_policy == ImGuiTableFlags_SizingStretchProp)
+                    column->StretchWeight = (column->WidthAuto / stretch_sum_width_auto) * count_stretch;
+                else
+                    column->StretchWeight = 1.0f;
+            }
+
+            stretch_sum_weights += column->StretchWeight;
+            if (table->LeftMostStretchedColumn == -1 || table->Columns[table->LeftMostStretchedColumn].DisplayOrder > column->DisplayOrder)
+                table->LeftMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+            if (table->RightMostStretchedColumn == -1 || table->Columns[table->RightMostStretchedColumn].DisplayOrder < column->DisplayOrder)
+                table->RightMostStretchedColumn = (ImGuiTableColumnIdx)column_n;
+        }
+        column->IsPreserveWidthAuto = false;
+        sum_width_requests += table->CellPaddingX * 2.0f;
+    }
+    table->ColumnsEnabledFixedCount = (ImGuiTableColumnIdx)count_fixed;
+    table->ColumnsStretchSumWeights = stretch_sum_weights;
+
+    // Apply final widths based on requested widths
+    const float width_spacings = (table->OuterPaddingX * 2.0f) + (table->CellSpacingX1 + table->CellSpacingX2) * (table->ColumnsEnabledCount - 1);
+    const float width_avail_for_stretched_columns = width_avail - width_spacings - sum_width_requests;
+    float width_remaining_for_stretched_columns = width_avail_for_stretched_columns;
+    table->ColumnsGivenWidth = width_spacings + (table->CellPaddingX * 2.0f) * table->ColumnsEnabledCount;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    {
+        if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByIndex, column_n))
+            continue;
+        ImGuiTableColumn* column = &table->Columns[column_n];
+
+        // Allocate width for stretched/weighted columns (StretchWeight gets converted into WidthRequest)
+        if (column->Flags & ImGuiTableColumnFlags_WidthStretch)
+        {
+            float weight_ratio = column->StretchWeight / stretch_sum_weights;
+            column->WidthRequest = IM_FLOOR(ImMax(width_avail_for_stretched_columns * weight_ratio, table->MinColumnWidth) + 0.01f);
+            width_remaining_for_stretched_columns -= column->WidthRequest;
+        }
+
+        // [Resize Rule 1] The right-most Visible column is not resizable if there is at least one Stretch column
+        // See additional comments in TableSetColumnWidth().
+        if (column->NextEnabledColumn == -1 && table->LeftMostStretchedColumn != -1)
+            column->Flags |= ImGuiTableColumnFlags_NoDirectResize_;
+
+        // Assign final width, record width in case we will need to shrink
+        column->WidthGiven = ImFloor(ImMax(column->WidthRequest, table->MinColumnWidth));
+        table->ColumnsGivenWidth += column->WidthGiven;
+    }
+
+    // Redistribute stretch remainder width due to rounding (remainder width is < 1.0f * number of Stretch column).
+    // Using right-to-left distribution (more likely to match resizing cursor).
+    if (width_remaining_for_stretched_columns >= 1.0f && !(table->Flags & ImGuiTableFlags_PreciseWidths))
+        for (int order_n = table->ColumnsCount - 1; stretch_sum_weights > 0.0f && width_remaining_for_stretched_columns >= 1.0f && order_n >= 0; order_n--)
+        {
+            if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
+                continue;
+            ImGuiTableColumn* column = &table->Columns[table->DisplayOrderToIndex[order_n]];
+            if (!(column->Flags & ImGuiTableColumnFlags_WidthStretch))
+                continue;
+            column->WidthRequest += 1.0f;
+            column->WidthGiven += 1.0f;
+            width_remaining_for_stretched_columns -= 1.0f;
+        }
+
+    // Store widths before TableUpdateLayout() clamps them, so they can be restored when reusing this solve.
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        table->Columns[column_n].WidthGivenLayout = table->Columns[column_n].WidthGiven;
+}
+
 // Process hit-testing on resizing borders. Actual size change will be applied in EndTable()
 // - Set table->HoveredColumnBorder with a short delay/timer to reduce visual feedback noise.
 // - Submit ahead of table contents and header, use ImGuiButtonFlags_AllowItemOverlap to prioritize
@@ -1232,6 +1311,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
 
 void    ImGui::EndTable()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
@@ -1444,6 +1524,7 @@ void    ImGui::EndTable()
 // If (init_width_or_weight <= 0.0f) it is ignored
 void ImGui::TableSetupColumn(const char* label, ImGuiTableColumnFlags flags, float init_width_or_weight, ImGuiID user_id)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Need to call TableSetupColumn() after BeginTable()!");
@@ -1702,6 +1783,7 @@ void ImGui::TableSetBgColor(ImGuiTableBgTarget target, ImU32 color, int column_n
 // - TableNextRow()
 // - TableBeginRow() [Internal]
 // - TableEndRow() [Internal]
+// - TableVirtualRows()
 //-------------------------------------------------------------------------
 
 // [Public] Note: for row coloring we use ->RowBgColorCounter which is the same value without counting header rows
@@ -1717,6 +1799,7 @@ int ImGui::TableGetRowIndex()
 // [Public] Starts into the first cell of a new row
 void ImGui::TableNextRow(ImGuiTableRowFlags row_flags, float row_min_height)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
 
@@ -1909,6 +1992,33 @@ void ImGui::TableEndRow(ImGuiTable* table)
     table->IsInsideRow = false;
 }
 
+// [Public] Submit rows through a clipper, calling 'render_row' for visible rows only
+void ImGui::TableVirtualRows(int rows_count, ImGuiTableRowCallback render_row, void* user_data, ImGuiTableRowFlags row_flags, float min_row_height, ImGuiListClipperHeights* row_heights)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableVirtualRows() after BeginTable()!");
+    IM_ASSERT(rows_count >= 0 && render_row != NULL);
+
+    ImGuiListClipper clipper;
+    if (row_heights != NULL)
+    {
+        // Rows which were never visible are assumed to hold a single line of text
+        row_heights->Resize(rows_count, ImMax(g.FontSize + table->CellPaddingY * 2.0f, min_row_height));
+        clipper.BeginVariableHeight(row_heights);
+    }
+    else
+    {
+        clipper.Begin(rows_count);
+    }
+    while (clipper.Step())
+        for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+        {
+            TableNextRow(row_flags, min_row_height);
+            render_row(row_n, user_data);
+        }
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Columns changes
 //-------------------------------------------------------------------------
@@ -1931,6 +2041,7 @@ int ImGui::TableGetColumnIndex()
 // [Public] Append into a specific column
 bool ImGui::TableSetColumnIndex(int column_n)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     if (!table)
@@ -1952,6 +2063,7 @@ bool ImGui::TableSetColumnIndex(int column_n)
 // [Public] Append into the next column, wrap and create a new row when already on last column
 bool ImGui::TableNextColumn()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     if (!table)
@@ -2301,11 +2413,16 @@ void ImGui::TablePopBackgroundChannel()
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
-// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0, and N is the number of visible columns.
+// Clipped columns all share the dummy channel, so wide scrolling tables only pay for the columns in view.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
+    int columns_visible_count = 0;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        if (table->Columns[column_n].IsVisibleX && table->Columns[column_n].IsVisibleY)
+            columns_visible_count++;
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : columns_visible_count;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
     const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
@@ -2358,8 +2475,8 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // When the contents of a column didn't stray off its limit, we move its channels into the corresponding group
 // based on its position (within frozen rows/columns groups or not).
 // At the end of the operation our 1-4 groups will each have a ImDrawCmd using the same ClipRect.
-// This function assume that each column are pointing to a distinct draw channel,
-// otherwise merge_group->ChannelsCount will not match set bit count of merge_group->ChannelsMask.
+// This function assume that each column are pointing to a distinct draw channel.
+// Reordering is done with a single pass over channels (counting sort), so its cost is linear in the number of channels.
 //
 // Column channels will not be merged into one of the 1-4 groups in the following cases:
 // - The contents stray off its clipping rectangle (we only compare the MaxX value, not the MinX value).
@@ -2378,24 +2495,24 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     const bool has_freeze_h = (table->FreezeColumnsCount > 0);
     IM_ASSERT(splitter->_Current == 0);
 
-    // Track which groups we are going to attempt to merge, and which channels goes into each group.
+    // Track which groups we are going to attempt to merge, and which group each channel goes into.
+    // Channels are sorted by destination in a single pass at the end (channels keep their relative order within a destination).
+    // Destinations 0-3 are merge groups, destination 4 is Bg2DrawChannelUnfrozen, destination 5 holds the channels we don't merge.
     struct MergeGroup
     {
         ImRect          ClipRect;
         int             ChannelsCount = 0;
-        ImBitArrayPtr   ChannelsMask = NULL;
     };
     int merge_group_mask = 0x00;
     MergeGroup merge_groups[4];
+    const int DEST_BG2_UNFROZEN = 4;
+    const int DEST_REMAINING = 5;
+    static const int dest_order[6] = { 0, 1, DEST_BG2_UNFROZEN, 2, 3, DEST_REMAINING }; // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups
 
-    // Use a reusable temp buffer for the merge masks as they are dynamically sized.
-    const int max_draw_channels = (4 + table->ColumnsCount * 2);
-    const int size_for_masks_bitarrays_one = (int)ImBitArrayGetStorageSizeInBytes(max_draw_channels);
-    g.TempBuffer.reserve(size_for_masks_bitarrays_one * 5);
-    memset(g.TempBuffer.Data, 0, size_for_masks_bitarrays_one * 5);
-    for (int n = 0; n < IM_ARRAYSIZE(merge_groups); n++)
-        merge_groups[n].ChannelsMask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * n));
-    ImBitArrayPtr remaining_mask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * 4));
+    // Use a reusable temp buffer for the destination of each channel, as it is dynamically sized.
+    g.TempBuffer.reserve(splitter->_Count);
+    ImU8* channels_dest = (ImU8*)(void*)g.TempBuffer.Data;
+    memset(channels_dest, DEST_REMAINING, splitter->_Count);
 
     // 1. Scan channels and take note of those which can be merged
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
@@ -2411,7 +2528,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 
             // Don't attempt to merge if there are multiple draw calls within the column
             ImDrawChannel* src_channel = &splitter->_Channels[channel_no];
-            if (src_channel->_CmdBuffer.Size > 0 && src_channel->_CmdBuffer.back().ElemCount == 0 && src_channel->_CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+            if (src_channel->_CmdBuffer.Size > 0 && src_channel->_CmdBuffer.back().ElemCount == 0 && src_channel->_CmdBuffer.back().QuadCount == 0 && src_channel->_CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
                 src_channel->_CmdBuffer.pop_back();
             if (src_channel->_CmdBuffer.Size != 1)
                 continue;
@@ -2432,11 +2549,11 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             }
 
             const int merge_group_n = (has_freeze_h && column_n < table->FreezeColumnsCount ? 0 : 1) + (has_freeze_v && merge_group_sub_n == 0 ? 0 : 2);
-            IM_ASSERT(channel_no < max_draw_channels);
+            IM_ASSERT(channel_no < splitter->_Count);
             MergeGroup* merge_group = &merge_groups[merge_group_n];
             if (merge_group->ChannelsCount == 0)
                 merge_group->ClipRect = ImRect(+FLT_MAX, +FLT_MAX, -FLT_MAX, -FLT_MAX);
-            ImBitArraySetBit(merge_group->ChannelsMask, channel_no);
+            channels_dest[channel_no] = (ImU8)merge_group_n;
             merge_group->ChannelsCount++;
             merge_group->ClipRect.Add(src_channel->_CmdBuffer[0].ClipRect);
             merge_group_mask |= (1 << merge_group_n);
@@ -2468,74 +2585,67 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     // 2. Rewrite channel list in our preferred order
     if (merge_group_mask != 0)
     {
-        // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
-        const int LEADING_DRAW_CHANNELS = 2;
-        g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
-        ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
-        ImBitArraySetBitRange(remaining_mask, LEADING_DRAW_CHANNELS, splitter->_Count);
-        ImBitArrayClearBit(remaining_mask, table->Bg2DrawChannelUnfrozen);
-        IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
-        int remaining_count = splitter->_Count - (has_freeze_v ? LEADING_DRAW_CHANNELS + 1 : LEADING_DRAW_CHANNELS);
+        // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
+        // outer-most columns have some outer padding offsetting them from their parent ClipRect.
+        // The principal cases this is dealing with are:
+        // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
+        // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
+        // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
+        // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
         //ImRect host_rect = (table->InnerWindow == table->OuterWindow) ? table->InnerClipRect : table->HostClipRect;
         ImRect host_rect = table->HostClipRect;
+        ImVec4 merge_clip_rects[4];
         for (int merge_group_n = 0; merge_group_n < IM_ARRAYSIZE(merge_groups); merge_group_n++)
         {
-            if (int merge_channels_count = merge_groups[merge_group_n].ChannelsCount)
-            {
-                MergeGroup* merge_group = &merge_groups[merge_group_n];
-                ImRect merge_clip_rect = merge_group->ClipRect;
-
-                // Extend outer-most clip limits to match those of host, so draw calls can be merged even if
-                // outer-most columns have some outer padding offsetting them from their parent ClipRect.
-                // The principal cases this is dealing with are:
-                // - On a same-window table (not scrolling = single group), all fitting columns ClipRect -> will extend and match host ClipRect -> will merge
-                // - Columns can use padding and have left-most ClipRect.Min.x and right-most ClipRect.Max.x != from host ClipRect -> will extend and match host ClipRect -> will merge
-                // FIXME-TABLE FIXME-WORKRECT: We are wasting a merge opportunity on tables without scrolling if column doesn't fit
-                // within host clip rect, solely because of the half-padding difference between window->WorkRect and window->InnerClipRect.
-                if ((merge_group_n & 1) == 0 || !has_freeze_h)
-                    merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
-                if ((merge_group_n & 2) == 0 || !has_freeze_v)
-                    merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
-                if ((merge_group_n & 1) != 0)
-                    merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
-                if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
-                    merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
-                //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
-                //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
-                remaining_count -= merge_group->ChannelsCount;
-                for (int n = 0; n < (size_for_masks_bitarrays_one >> 2); n++)
-                    remaining_mask[n] &= ~merge_group->ChannelsMask[n];
-                for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
-                {
-                    // Copy + overwrite new clip rect
-                    if (!IM_BITARRAY_TESTBIT(merge_group->ChannelsMask, n))
-                        continue;
-                    IM_BITARRAY_CLEARBIT(merge_group->ChannelsMask, n);
-                    merge_channels_count--;
-
-                    ImDrawChannel* channel = &splitter->_Channels[n];
-                    IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rect.Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
-                    channel->_CmdBuffer[0].ClipRect = merge_clip_rect.ToVec4();
-                    memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
-                }
-            }
+            MergeGroup* merge_group = &merge_groups[merge_group_n];
+            if (merge_group->ChannelsCount == 0)
+                continue;
+            ImRect merge_clip_rect = merge_group->ClipRect;
+            if ((merge_group_n & 1) == 0 || !has_freeze_h)
+                merge_clip_rect.Min.x = ImMin(merge_clip_rect.Min.x, host_rect.Min.x);
+            if ((merge_group_n & 2) == 0 || !has_freeze_v)
+                merge_clip_rect.Min.y = ImMin(merge_clip_rect.Min.y, host_rect.Min.y);
+            if ((merge_group_n & 1) != 0)
+                merge_clip_rect.Max.x = ImMax(merge_clip_rect.Max.x, host_rect.Max.x);
+            if ((merge_group_n & 2) != 0 && (table->Flags & ImGuiTableFlags_NoHostExtendY) == 0)
+                merge_clip_rect.Max.y = ImMax(merge_clip_rect.Max.y, host_rect.Max.y);
+            //GetForegroundDrawList()->AddRect(merge_group->ClipRect.Min, merge_group->ClipRect.Max, IM_COL32(255, 0, 0, 200), 0.0f, 0, 1.0f); // [DEBUG]
+            //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Min, merge_clip_rect.Min, IM_COL32(255, 100, 0, 200));
+            //GetForegroundDrawList()->AddLine(merge_group->ClipRect.Max, merge_clip_rect.Max, IM_COL32(255, 100, 0, 200));
+            merge_clip_rects[merge_group_n] = merge_clip_rect.ToVec4();
+        }
 
-            // Make sure Bg2DrawChannelUnfrozen appears in the middle of our groups (whereas Bg0/Bg1 and Bg2 frozen are fixed to 0 and 1)
-            if (merge_group_n == 1 && has_freeze_v)
-                memcpy(dst_tmp++, &splitter->_Channels[table->Bg2DrawChannelUnfrozen], sizeof(ImDrawChannel));
+        // We skip channel 0 (Bg0/Bg1) and 1 (Bg2 frozen) from the shuffling since they won't move - see channels allocation in TableSetupDrawChannels().
+        const int LEADING_DRAW_CHANNELS = 2;
+        IM_ASSERT(has_freeze_v == false || table->Bg2DrawChannelUnfrozen != TABLE_DRAW_CHANNEL_BG2_FROZEN);
+        if (has_freeze_v)
+            channels_dest[table->Bg2DrawChannelUnfrozen] = DEST_BG2_UNFROZEN;
+
+        // Count channels per destination, then convert counts into write offsets following our preferred order
+        int dest_offsets[6] = {};
+        for (int n = LEADING_DRAW_CHANNELS; n < splitter->_Count; n++)
+            dest_offsets[channels_dest[n]]++;
+        for (int order_n = 0, offset = 0; order_n < IM_ARRAYSIZE(dest_order); order_n++)
+        {
+            const int count = dest_offsets[dest_order[order_n]];
+            dest_offsets[dest_order[order_n]] = offset;
+            offset += count;
         }
 
-        // Append unmergeable channels that we didn't reorder at the end of the list
-        for (int n = 0; n < splitter->_Count && remaining_count != 0; n++)
+        // Copy + overwrite new clip rect of merged channels
+        g.DrawChannelsTempMergeBuffer.resize(splitter->_Count - LEADING_DRAW_CHANNELS); // Use shared temporary storage so the allocation gets amortized
+        ImDrawChannel* dst_tmp = g.DrawChannelsTempMergeBuffer.Data;
+        for (int n = LEADING_DRAW_CHANNELS; n < splitter->_Count; n++)
         {
-            if (!IM_BITARRAY_TESTBIT(remaining_mask, n))
-                continue;
             ImDrawChannel* channel = &splitter->_Channels[n];
-            memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
-            remaining_count--;
+            const int dest = channels_dest[n];
+            if (dest < IM_ARRAYSIZE(merge_groups))
+            {
+                IM_ASSERT(channel->_CmdBuffer.Size == 1 && ImRect(merge_clip_rects[dest]).Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
+                channel->_CmdBuffer[0].ClipRect = merge_clip_rects[dest];
+            }
+            memcpy(&dst_tmp[dest_offsets[dest]++], channel, sizeof(ImDrawChannel));
         }
-        IM_ASSERT(dst_tmp == g.DrawChannelsTempMergeBuffer.Data + g.DrawChannelsTempMergeBuffer.Size);
         memcpy(splitter->_Channels.Data + LEADING_DRAW_CHANNELS, g.DrawChannelsTempMergeBuffer.Data, (splitter->_Count - LEADING_DRAW_CHANNELS) * sizeof(ImDrawChannel));
     }
 }
@@ -2646,6 +2756,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // - TableSetColumnSortDirection() [Internal]
 // - TableSortSpecsSanitize() [Internal]
 // - TableSortSpecsBuild() [Internal]
+// - ImGuiTableSorter
 //-------------------------------------------------------------------------
 
 // Return NULL if no sort specs (most often when ImGuiTableFlags_Sortable is not set)
@@ -2654,6 +2765,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // Lifetime: don't hold on this pointer over multiple frames or past any subsequent call to BeginTable()!
 ImGuiTableSortSpecs* ImGui::TableGetSortSpecs()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL);
@@ -2832,6 +2944,198 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// ImGuiTableSorter
+//-------------------------------------------------------------------------
+
+void ImGuiTableSorter::SetupColumn(int column_n, ImGuiDataType data_type, int data_offset)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
+    IM_ASSERT(column_n >= 0 && data_type >= 0 && data_type < ImGuiDataType_COUNT);
+    if (Columns.Size <= column_n)
+        Columns.resize(column_n + 1);
+    ImGuiTableSorterColumn* column = &Columns[column_n];
+    if (column->DataType != data_type || column->DataOffset != data_offset || column->CompareFunc != NULL)
+        NeedFullSort = true;
+    column->DataType = data_type;
+    column->DataOffset = data_offset;
+    column->CompareFunc = NULL;
+    column->CompareUserData = NULL;
+}
+
+void ImGuiTableSorter::SetupColumn(int column_n, ImGuiTableSortCompareFunc compare_func, void* user_data)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
+    IM_ASSERT(column_n >= 0 && compare_func != NULL);
+    if (Columns.Size <= column_n)
+        Columns.resize(column_n + 1);
+    ImGuiTableSorterColumn* column = &Columns[column_n];
+    if (column->CompareFunc != compare_func || column->CompareUserData != user_data)
+        NeedFullSort = true;
+    column->DataType = ImGuiDataType_COUNT;
+    column->DataOffset = 0;
+    column->CompareFunc = compare_func;
+    column->CompareUserData = user_data;
+}
+
+void ImGuiTableSorter::MarkRowChanged(int row_n)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
+    IM_ASSERT(row_n >= 0);
+    if (NeedFullSort || row_n >= Indices.Size) // Appended rows are detected by Sort()
+        return;
+    if (ChangedMask.Size < ((Indices.Size + 31) >> 5))
+        ChangedMask.resize((Indices.Size + 31) >> 5, 0);
+    if (ImBitArrayTestBit(ChangedMask.Data, row_n))
+        return;
+    ImBitArraySetBit(ChangedMask.Data, row_n);
+    ChangedRows.push_back(row_n);
+}
+
+int ImGuiTableSorter::CompareRows(int row_a, int row_b) const
+{
+    for (int spec_n = 0; spec_n < Specs.Size; spec_n++)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &Specs[spec_n];
+        if (spec->ColumnIndex >= Columns.Size)
+            continue;
+        const ImGuiTableSorterColumn* column = &Columns[spec->ColumnIndex];
+        int delta = 0;
+        if (column->CompareFunc != NULL)
+            delta = column->CompareFunc(row_a, row_b, column->CompareUserData);
+        else if (column->DataType != ImGuiDataType_COUNT)
+            delta = ImGui::DataTypeCompare(column->DataType, (const char*)RowsData + (size_t)row_a * RowsStride + column->DataOffset, (const char*)RowsData + (size_t)row_b * RowsStride + column->DataOffset);
+        if (delta != 0)
+            return (spec->SortDirection == ImGuiSortDirection_Descending) ? -delta : delta;
+    }
+    return row_a - row_b; // Stable: fall back to row order
+}
+
+// Bottom-up merge sort of row indices, using 'temp' of same size as scratch.
+static void TableSorterMergeSort(const ImGuiTableSorter* sorter, int* data, int count, int* temp)
+{
+    int* src = data;
+    int* dst = temp;
+    for (int width = 1; width < count; width *= 2)
+    {
+        for (int lo = 0; lo < count; lo += width * 2)
+        {
+            const int mid = ImMin(lo + width, count);
+            const int hi = ImMin(lo + width * 2, count);
+            int a = lo, b = mid, out = lo;
+            if (mid == hi || sorter->CompareRows(src[mid - 1], src[mid]) < 0) // Already ordered: copy
+            {
+                memcpy(dst + lo, src + lo, (size_t)(hi - lo) * sizeof(int));
+                continue;
+            }
+            while (a < mid && b < hi)
+                dst[out++] = (sorter->CompareRows(src[b], src[a]) < 0) ? src[b++] : src[a++];
+            while (a < mid)
+                dst[out++] = src[a++];
+            while (b < hi)
+                dst[out++] = src[b++];
+        }
+        ImSwap(src, dst);
+    }
+    if (src != data)
+        memcpy(data, src, (size_t)count * sizeof(int));
+}
+
+bool ImGuiTableSorter::Sort(ImGuiTableSortSpecs* sort_specs, int rows_count, const void* rows_data, int row_stride)
+{
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
+    IM_ASSERT(rows_count >= 0);
+    RowsData = rows_data;
+    RowsStride = row_stride;
+
+    // Detect sort specs changes (we compare them instead of relying on SpecsDirty, which may have been cleared by someone else)
+    const int specs_count = sort_specs ? sort_specs->SpecsCount : 0;
+    bool specs_changed = (specs_count != Specs.Size);
+    for (int spec_n = 0; spec_n < specs_count && !specs_changed; spec_n++)
+        if (sort_specs->Specs[spec_n].ColumnIndex != Specs[spec_n].ColumnIndex || sort_specs->Specs[spec_n].SortDirection != Specs[spec_n].SortDirection)
+            specs_changed = true;
+    if (specs_changed)
+    {
+        Specs.resize(specs_count);
+        if (specs_count > 0)
+            memcpy(Specs.Data, sort_specs->Specs, (size_t)specs_count * sizeof(ImGuiTableColumnSortSpecs));
+    }
+    if (sort_specs)
+        sort_specs->SpecsDirty = false;
+
+    const int prev_rows_count = Indices.Size;
+    if (specs_changed || NeedFullSort || rows_count < prev_rows_count)
+    {
+        // Full sort
+        Indices.resize(rows_count);
+        for (int row_n = 0; row_n < rows_count; row_n++)
+            Indices[row_n] = row_n;
+        TempBuffer.resize(rows_count);
+        TableSorterMergeSort(this, Indices.Data, rows_count, TempBuffer.Data);
+        ChangedRows.resize(0);
+        ChangedMask.resize(0);
+        NeedFullSort = false;
+        RowsData = NULL;
+        return true;
+    }
+    if (ChangedRows.Size == 0 && rows_count == prev_rows_count)
+    {
+        RowsData = NULL;
+        return false;
+    }
+
+    // Remove changed rows from the current order
+    int kept_count = prev_rows_count;
+    if (ChangedRows.Size > 0)
+    {
+        kept_count = 0;
+        for (int n = 0; n < prev_rows_count; n++)
+            if (!ImBitArrayTestBit(ChangedMask.Data, Indices[n]))
+                Indices[kept_count++] = Indices[n];
+        for (int n = 0; n < ChangedRows.Size; n++)
+            ImBitArrayClearBit(ChangedMask.Data, ChangedRows[n]);
+    }
+
+    // Sort changed + appended rows
+    for (int row_n = prev_rows_count; row_n < rows_count; row_n++)
+        ChangedRows.push_back(row_n);
+    const int changed_count = ChangedRows.Size;
+    TempBuffer.resize(changed_count);
+    TableSorterMergeSort(this, ChangedRows.Data, changed_count, TempBuffer.Data);
+
+    // Find where each changed row goes with a binary search (positions are increasing as changed rows are sorted),
+    // then merge them in with a single backward pass over the kept rows.
+    int* positions = TempBuffer.Data;
+    for (int n = 0, lo = 0; n < changed_count; n++)
+    {
+        int hi = kept_count;
+        while (lo < hi)
+        {
+            const int mid = (lo + hi) >> 1;
+            if (CompareRows(Indices[mid], ChangedRows[n]) < 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        positions[n] = lo;
+    }
+    Indices.resize(rows_count);
+    int write_n = rows_count;
+    int read_end = kept_count;
+    for (int n = changed_count - 1; n >= 0; n--)
+    {
+        const int move_count = read_end - positions[n];
+        write_n -= move_count;
+        memmove(Indices.Data + write_n, Indices.Data + positions[n], (size_t)move_count * sizeof(int));
+        Indices[--write_n] = ChangedRows[n];
+        read_end = positions[n];
+    }
+    IM_ASSERT(write_n == read_end);
+    ChangedRows.resize(0);
+    RowsData = NULL;
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -2866,6 +3170,7 @@ float ImGui::TableGetHeaderRowHeight()
 // FIXME-TABLE: TableOpenContextMenu() and TableGetHeaderRowHeight() are not public.
 void ImGui::TableHeadersRow()
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Tables);
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Need to call TableHeadersRow() after BeginTable()!");
@@ -3180,6 +3485,7 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
 //-------------------------------------------------------------------------
 // - TableSettingsInit() [Internal]
 // - TableSettingsCalcChunkSize() [Internal]
+// - TableSettingsMarkDirty() [Internal]
 // - TableSettingsCreate() [Internal]
 // - TableSettingsFindByID() [Internal]
 // - TableGetBoundSettings() [Internal]
@@ -3191,6 +3497,9 @@ void ImGui::TableDrawContextMenu(ImGuiTable* table)
 // - TableSettingsHandler_ReadOpen() [Internal]
 // - TableSettingsHandler_ReadLine() [Internal]
 // - TableSettingsHandler_WriteAll() [Internal]
+// - TableSettingsHandler_WriteDirty() [Internal]
+// - TableSettingsHandler_ReadBinary() [Internal]
+// - TableSettingsHandler_WriteBinary() [Internal]
 // - TableSettingsInstallHandler() [Internal]
 //-------------------------------------------------------------------------
 // [Init] 1: TableSettingsHandler_ReadXXXX()   Load and parse .ini file into TableSettings.
@@ -3217,20 +3526,37 @@ static size_t TableSettingsCalcChunkSize(int columns_count)
     return sizeof(ImGuiTableSettings) + (size_t)columns_count * sizeof(ImGuiTableColumnSettings);
 }
 
+// Queue entry for SaveIniSettingsToMemory()
+void ImGui::TableSettingsMarkDirty(ImGuiTableSettings* settings)
+{
+    ImGuiContext& g = *GImGui;
+    if (settings->WantSave)
+        return;
+    settings->WantSave = true;
+    g.SettingsTablesDirty.push_back(g.SettingsTables.offset_from_ptr(settings));
+}
+
 ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_Settings);
     ImGuiContext& g = *GImGui;
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
     TableSettingsInit(settings, id, columns_count, columns_count);
+    if (g.SettingsTablesById.GetInt(id) == 0)
+        g.SettingsTablesById.SetInt(id, g.SettingsTables.offset_from_ptr(settings) + 1);
+    TableSettingsMarkDirty(settings);
     return settings;
 }
 
 // Find existing settings
 ImGuiTableSettings* ImGui::TableSettingsFindByID(ImGuiID id)
 {
-    // FIXME-OPT: Might want to store a lookup map for this?
+    // Start from the first entry created for this ID, following ones may exist if it was invalidated
     ImGuiContext& g = *GImGui;
-    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+    const int offset = g.SettingsTablesById.GetInt(id) - 1;
+    if (offset < 0)
+        return NULL;
+    for (ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(offset); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
         if (settings->ID == id)
             return settings;
     return NULL;
@@ -3246,7 +3572,9 @@ ImGuiTableSettings* ImGui::TableGetBoundSettings(ImGuiTable* table)
         IM_ASSERT(settings->ID == table->ID);
         if (settings->ColumnsCountMax >= table->ColumnsCount)
             return settings; // OK
+        SettingsBinaryKillRecord(FindSettingsHandler(TABLE_SETTINGS_TYPE_NAME)->TypeHash, settings->ID, &settings->BinaryOffset);
         settings->ID = 0; // Invalidate storage, we won't fit because of a count change
+        TableSettingsMarkDirty(settings);
     }
     return NULL;
 }
@@ -3312,6 +3640,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
 
+    TableSettingsMarkDirty(settings);
     MarkIniSettingsDirty();
 }
 
@@ -3387,6 +3716,8 @@ static void TableSettingsHandler_ClearAll(ImGuiContext* ctx, ImGuiSettingsHandle
         if (ImGuiTable* table = g.Tables.TryGetMapData(i))
             table->SettingsOffset = -1;
     g.SettingsTables.clear();
+    g.SettingsTablesById.Clear();
+    g.SettingsTablesDirty.clear();
 }
 
 // Apply to existing windows (if any)
@@ -3401,25 +3732,37 @@ static void TableSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandle
         }
 }
 
-static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+static ImGuiTableSettings* TableSettingsRecycleOrCreate(ImGuiSettingsHandler* handler, ImGuiID id, int columns_count)
 {
-    ImGuiID id = 0;
-    int columns_count = 0;
-    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
-        return NULL;
-
     if (ImGuiTableSettings* settings = ImGui::TableSettingsFindByID(id))
     {
         if (settings->ColumnsCountMax >= columns_count)
         {
+            const int binary_offset = settings->BinaryOffset;
+            const int ini_section = settings->IniSection;
+            const bool want_save = settings->WantSave;
             TableSettingsInit(settings, id, columns_count, settings->ColumnsCountMax); // Recycle
+            settings->BinaryOffset = binary_offset;
+            settings->IniSection = ini_section;
+            settings->WantSave = want_save;
             return settings;
         }
+        ImGui::SettingsBinaryKillRecord(handler->TypeHash, id, &settings->BinaryOffset);
         settings->ID = 0; // Invalidate storage, we won't fit because of a count change
+        ImGui::TableSettingsMarkDirty(settings);
     }
     return ImGui::TableSettingsCreate(id, columns_count);
 }
 
+static void* TableSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler* handler, const char* name)
+{
+    ImGuiID id = 0;
+    int columns_count = 0;
+    if (sscanf(name, "0x%08X,%d", &id, &columns_count) < 2)
+        return NULL;
+    return TableSettingsRecycleOrCreate(handler, id, columns_count);
+}
+
 static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
 {
     // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
@@ -3446,57 +3789,184 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
     }
 }
 
+static void TableSettingsHandler_WriteEntry(ImGuiSettingsHandler* handler, ImGuiTableSettings* settings, ImGuiTextBuffer* buf)
+{
+    if (settings->ID == 0) // Skip ditched settings
+        return;
+
+    // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
+    // (e.g. Order was unchanged)
+    const bool save_size    = (settings->SaveFlags & ImGuiTableFlags_Resizable) != 0;
+    const bool save_visible = (settings->SaveFlags & ImGuiTableFlags_Hideable) != 0;
+    const bool save_order   = (settings->SaveFlags & ImGuiTableFlags_Reorderable) != 0;
+    const bool save_sort    = (settings->SaveFlags & ImGuiTableFlags_Sortable) != 0;
+    if (!save_size && !save_visible && !save_order && !save_sort)
+        return;
+
+    buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
+    buf->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
+    if (settings->RefScale != 0.0f)
+        buf->appendf("RefScale=%g\n", settings->RefScale);
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+    {
+        // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
+        bool save_column = column->UserID != 0 || save_size || save_visible || save_order || (save_sort && column->SortOrder != -1);
+        if (!save_column)
+            continue;
+        buf->appendf("Column %-2d", column_n);
+        if (column->UserID != 0)                    { buf->appendf(" UserID=%08X", column->UserID); }
+        if (save_size && column->IsStretch)         { buf->appendf(" Weight=%.4f", column->WidthOrWeight); }
+        if (save_size && !column->IsStretch)        { buf->appendf(" Width=%d", (int)column->WidthOrWeight); }
+        if (save_visible)                           { buf->appendf(" Visible=%d", column->IsEnabled); }
+        if (save_order)                             { buf->appendf(" Order=%d", column->DisplayOrder); }
+        if (save_sort && column->SortOrder != -1)   { buf->appendf(" Sort=%d%c", column->SortOrder, (column->SortDirection == ImGuiSortDirection_Ascending) ? 'v' : '^'); }
+        buf->append("\n");
+    }
+    buf->append("\n");
+}
+
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
     ImGuiContext& g = *ctx;
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        TableSettingsHandler_WriteEntry(handler, settings, buf);
+}
+
+// Rewrite sections of entries queued by TableSettingsMarkDirty()
+static void TableSettingsHandler_WriteDirty(ImGuiContext* ctx, ImGuiSettingsHandler* handler)
+{
+    ImGuiContext& g = *ctx;
+    ImGuiTextBuffer buf;
+    if (g.SettingsIniRebuild)
+    {
+        for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        {
+            buf.Buf.resize(0);
+            TableSettingsHandler_WriteEntry(handler, settings, &buf);
+            ImGui::SettingsIniWriteSection(&settings->IniSection, buf.c_str(), buf.size());
+            settings->WantSave = false;
+        }
+    }
+    else
+    {
+        for (int n = 0; n < g.SettingsTablesDirty.Size; n++)
+        {
+            ImGuiTableSettings* settings = g.SettingsTables.ptr_from_offset(g.SettingsTablesDirty[n]);
+            if (!settings->WantSave)
+                continue;
+            buf.Buf.resize(0);
+            TableSettingsHandler_WriteEntry(handler, settings, &buf);
+            ImGui::SettingsIniWriteSection(&settings->IniSection, buf.c_str(), buf.size());
+            settings->WantSave = false;
+        }
+    }
+    g.SettingsTablesDirty.resize(0);
+}
+
+// Binary record: SaveFlags (ImS32), RefScale (float), ColumnsCount (ImS32), then for each column:
+// WidthOrWeight (float), UserID (ImU32), Index, DisplayOrder, SortOrder (ImS16), SortDirection | IsEnabled << 2 | IsStretch << 3 (ImU8)
+// Index is -1 for columns which wouldn't be written in the .ini file, so both formats load the same way.
+static const int TABLE_SETTINGS_BINARY_HEADER_SIZE = 12;
+static const int TABLE_SETTINGS_BINARY_COLUMN_SIZE = 15;
+
+static void TableSettingsHandler_ReadBinary(ImGuiContext*, ImGuiSettingsHandler* handler, int record_offset, ImGuiID id, const void* data, int data_size)
+{
+    const char* p = (const char*)data;
+    ImS32 save_flags = 0, columns_count = 0;
+    float ref_scale = 0.0f;
+    if (id == 0 || data_size < TABLE_SETTINGS_BINARY_HEADER_SIZE)
+        return;
+    memcpy(&save_flags, p + 0, 4);
+    memcpy(&ref_scale, p + 4, 4);
+    memcpy(&columns_count, p + 8, 4);
+    if (columns_count <= 0 || columns_count > IMGUI_TABLE_MAX_COLUMNS || data_size != TABLE_SETTINGS_BINARY_HEADER_SIZE + columns_count * TABLE_SETTINGS_BINARY_COLUMN_SIZE)
+        return;
+
+    ImGuiTableSettings* settings = TableSettingsRecycleOrCreate(handler, id, columns_count);
+    settings->SaveFlags = save_flags;
+    settings->RefScale = ref_scale;
+    p += TABLE_SETTINGS_BINARY_HEADER_SIZE;
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < columns_count; column_n++, column++, p += TABLE_SETTINGS_BINARY_COLUMN_SIZE)
+    {
+        ImS16 index, display_order, sort_order;
+        memcpy(&column->WidthOrWeight, p + 0, 4);
+        memcpy(&column->UserID, p + 4, 4);
+        memcpy(&index, p + 8, 2);
+        memcpy(&display_order, p + 10, 2);
+        memcpy(&sort_order, p + 12, 2);
+        column->Index = (index == column_n) ? (ImGuiTableColumnIdx)index : -1;
+        column->DisplayOrder = (ImGuiTableColumnIdx)display_order;
+        column->SortOrder = (ImGuiTableColumnIdx)sort_order;
+        column->SortDirection = (p[14] & 0x03);
+        column->IsEnabled = (p[14] >> 2) & 1;
+        column->IsStretch = (p[14] >> 3) & 1;
+    }
+    if (settings->BinaryOffset != record_offset)
+        ImGui::SettingsBinaryKillRecord(handler->TypeHash, id, &settings->BinaryOffset); // Older record for the same table
+    settings->BinaryOffset = record_offset;
+}
+
+static void TableSettingsHandler_WriteBinary(ImGuiContext* ctx, ImGuiSettingsHandler* handler)
+{
+    ImGuiContext& g = *ctx;
+    ImVector<char> buf;
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
-        if (settings->ID == 0) // Skip ditched settings
+        if (settings->ID == 0) // Skip ditched settings (their record was killed when invalidated)
             continue;
 
-        // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
-        // (e.g. Order was unchanged)
+        // Same stripping as TableSettingsHandler_WriteAll()
         const bool save_size    = (settings->SaveFlags & ImGuiTableFlags_Resizable) != 0;
         const bool save_visible = (settings->SaveFlags & ImGuiTableFlags_Hideable) != 0;
         const bool save_order   = (settings->SaveFlags & ImGuiTableFlags_Reorderable) != 0;
         const bool save_sort    = (settings->SaveFlags & ImGuiTableFlags_Sortable) != 0;
         if (!save_size && !save_visible && !save_order && !save_sort)
+        {
+            ImGui::SettingsBinaryKillRecord(handler->TypeHash, settings->ID, &settings->BinaryOffset);
             continue;
+        }
 
-        buf->reserve(buf->size() + 30 + settings->ColumnsCount * 50); // ballpark reserve
-        buf->appendf("[%s][0x%08X,%d]\n", handler->TypeName, settings->ID, settings->ColumnsCount);
-        if (settings->RefScale != 0.0f)
-            buf->appendf("RefScale=%g\n", settings->RefScale);
+        const ImS32 save_flags = settings->SaveFlags;
+        const ImS32 columns_count = settings->ColumnsCount;
+        buf.resize(TABLE_SETTINGS_BINARY_HEADER_SIZE + columns_count * TABLE_SETTINGS_BINARY_COLUMN_SIZE);
+        char* p = buf.Data;
+        memcpy(p + 0, &save_flags, 4);
+        memcpy(p + 4, &settings->RefScale, 4);
+        memcpy(p + 8, &columns_count, 4);
+        p += TABLE_SETTINGS_BINARY_HEADER_SIZE;
         ImGuiTableColumnSettings* column = settings->GetColumnSettings();
-        for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+        for (int column_n = 0; column_n < columns_count; column_n++, column++, p += TABLE_SETTINGS_BINARY_COLUMN_SIZE)
         {
-            // "Column 0  UserID=0x42AD2D21 Width=100 Visible=1 Order=0 Sort=0v"
-            bool save_column = column->UserID != 0 || save_size || save_visible || save_order || (save_sort && column->SortOrder != -1);
-            if (!save_column)
-                continue;
-            buf->appendf("Column %-2d", column_n);
-            if (column->UserID != 0)                    { buf->appendf(" UserID=%08X", column->UserID); }
-            if (save_size && column->IsStretch)         { buf->appendf(" Weight=%.4f", column->WidthOrWeight); }
-            if (save_size && !column->IsStretch)        { buf->appendf(" Width=%d", (int)column->WidthOrWeight); }
-            if (save_visible)                           { buf->appendf(" Visible=%d", column->IsEnabled); }
-            if (save_order)                             { buf->appendf(" Order=%d", column->DisplayOrder); }
-            if (save_sort && column->SortOrder != -1)   { buf->appendf(" Sort=%d%c", column->SortOrder, (column->SortDirection == ImGuiSortDirection_Ascending) ? 'v' : '^'); }
-            buf->append("\n");
+            const bool save_column = column->UserID != 0 || save_size || save_visible || save_order || (save_sort && column->SortOrder != -1);
+            const ImS16 index = save_column ? (ImS16)column_n : -1;
+            const ImS16 display_order = column->DisplayOrder;
+            const ImS16 sort_order = column->SortOrder;
+            memcpy(p + 0, &column->WidthOrWeight, 4);
+            memcpy(p + 4, &column->UserID, 4);
+            memcpy(p + 8, &index, 2);
+            memcpy(p + 10, &display_order, 2);
+            memcpy(p + 12, &sort_order, 2);
+            p[14] = (char)(column->SortDirection | (column->IsEnabled << 2) | (column->IsStretch << 3));
         }
-        buf->append("\n");
+        ImGui::SettingsBinaryWriteRecord(handler->TypeHash, settings->ID, &settings->BinaryOffset, buf.Data, buf.Size);
     }
 }
 
 void ImGui::TableSettingsAddSettingsHandler()
 {
     ImGuiSettingsHandler ini_handler;
-    ini_handler.TypeName = "Table";
-    ini_handler.TypeHash = ImHashStr("Table");
+    ini_handler.TypeName = TABLE_SETTINGS_TYPE_NAME;
+    ini_handler.TypeHash = ImHashStr(TABLE_SETTINGS_TYPE_NAME);
     ini_handler.ClearAllFn = TableSettingsHandler_ClearAll;
     ini_handler.ReadOpenFn = TableSettingsHandler_ReadOpen;
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
     ini_handler.ApplyAllFn = TableSettingsHandler_ApplyAll;
     ini_handler.WriteAllFn = TableSettingsHandler_WriteAll;
+    ini_handler.WriteDirtyFn = TableSettingsHandler_WriteDirty;
+    ini_handler.ReadBinaryFn = TableSettingsHandler_ReadBinary;
+    ini_handler.WriteBinaryFn = TableSettingsHandler_WriteBinary;
     AddSettingsHandler(&ini_handler);
 }
 
@@ -3505,6 +3975,7 @@ void ImGui::TableSettingsAddSettingsHandler()
 //-------------------------------------------------------------------------
 // - TableRemove() [Internal]
 // - TableGcCompactTransientBuffers() [Internal]
+// - TableGcCalcTransientBuffersSize() [Internal]
 // - TableGcCompactSettings() [Internal]
 //-------------------------------------------------------------------------
 
@@ -3526,6 +3997,8 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     //IMGUI_DEBUG_PRINT("TableGcCompactTransientBuffers() id=0x%08X\n", table->ID);
     ImGuiContext& g = *GImGui;
     IM_ASSERT(table->MemoryCompacted == false);
+    g.GcReclaimedBytes += TableGcCalcTransientBuffersSize(table);
+    g.GcReclaimedCount++;
     table->SortSpecs.Specs = NULL;
     table->SortSpecsMulti.clear();
     table->IsSortSpecsDirty = true; // FIXME: In theory shouldn't have to leak into user performing a sort on resume.
@@ -3538,10 +4011,26 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
 
 void ImGui::TableGcCompactTransientBuffers(ImGuiTableTempData* temp_data)
 {
+    ImGuiContext& g = *GImGui;
+    g.GcReclaimedBytes += TableGcCalcTransientBuffersSize(temp_data);
+    g.GcReclaimedCount++;
     temp_data->DrawSplitter.ClearFreeMemory();
     temp_data->LastTimeActive = -1.0f;
 }
 
+// Bytes that TableGcCompactTransientBuffers() would free
+size_t ImGui::TableGcCalcTransientBuffersSize(ImGuiTable* table)
+{
+    if (table->MemoryCompacted)
+        return 0;
+    return (size_t)table->SortSpecsMulti.Capacity * sizeof(ImGuiTableColumnSortSpecs) + (size_t)table->ColumnsNames.Buf.Capacity;
+}
+
+size_t ImGui::TableGcCalcTransientBuffersSize(ImGuiTableTempData* temp_data)
+{
+    return GcCalcDrawListSplitterSize(&temp_data->DrawSplitter);
+}
+
 // Compact and remove unused settings data (currently only used by TestEngine)
 void ImGui::TableGcCompactSettings()
 {
@@ -3556,8 +4045,18 @@ void ImGui::TableGcCompactSettings()
     new_chunk_stream.Buf.reserve(required_memory);
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
         if (settings->ID != 0)
-            memcpy(new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount)), settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
+        {
+            ImGuiTableSettings* new_settings = new_chunk_stream.alloc_chunk(TableSettingsCalcChunkSize(settings->ColumnsCount));
+            memcpy(new_settings, settings, TableSettingsCalcChunkSize(settings->ColumnsCount));
+            new_settings->ColumnsCountMax = settings->ColumnsCount; // Chunk was shrunk, don't let recycling write past it
+        }
     g.SettingsTables.swap(new_chunk_stream);
+    g.SettingsTablesDirty.resize(0);
+    g.SettingsIniRebuild = true; // Dropped entries may still have a section
+    g.SettingsTablesById.Clear();
+    for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
+        if (g.SettingsTablesById.GetInt(settings->ID) == 0)
+            g.SettingsTablesById.SetInt(settings->ID, g.SettingsTables.offset_from_ptr(settings) + 1);
 }
 
 
@@ -3598,6 +4097,7 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("ColumnsGivenWidth: %.1f, ColumnsAutoFitWidth: %.1f, InnerWidth: %.1f%s", table->ColumnsGivenWidth, table->ColumnsAutoFitWidth, table->InnerWidth, table->InnerWidth == 0.0f ? " (auto)" : "");
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
+    BulletText("IsLayoutReused: %d", table->IsLayoutReused);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
     //BulletText("BgDrawChannels: %d/%d", 0, table->BgDrawChannelUnfrozen);
     float sum_weights = 0.0f;
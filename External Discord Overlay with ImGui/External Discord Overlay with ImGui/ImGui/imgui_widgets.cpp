@@ -3613,6 +3613,8 @@ bool ImGui::InputDouble(const char* label, double* v, double step, double step_f
 // - InputTextGetCharInfo() [Internal]
 // - InputTextReindexLines() [Internal]
 // - InputTextReindexLinesRange() [Internal]
+// - ImGuiInputTextLineIndex [Internal]
+// - InputTextLargeXXX() [Internal]
 // - InputTextEx() [Internal]
 // - DebugNodeInputTextState() [Internal]
 //-------------------------------------------------------------------------
@@ -3693,17 +3695,333 @@ static ImVec2 InputTextCalcTextSizeW(ImGuiContext* ctx, const ImWchar* text_begi
     return text_size;
 }
 
+//-------------------------------------------------------------------------
+// ImGuiInputTextLineIndex, helpers for ImGuiInputTextFlags_LargeText
+//-------------------------------------------------------------------------
+// With ImGuiInputTextFlags_LargeText:
+// - TextW is a gap buffer: inserting/deleting only moves the characters between the previous and the new edit position.
+// - Lines holds the start of each line, so we can locate a character, a row or the visible lines without scanning the text.
+// - Edits are recorded in UTF-8 in LargeEdits[] and applied to the user buffer in place, instead of converting the whole text every frame.
+//-------------------------------------------------------------------------
+
+int ImGuiInputTextLineIndex::FindLine(int pos_w) const
+{
+    int lo = 0, hi = StartsW.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (GetStartW(mid) <= pos_w)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+void ImGuiInputTextLineIndex::Shift(int line_first, int delta_w, int delta_a)
+{
+    if (ShiftW == 0 && ShiftA == 0)
+    {
+        ShiftLine = line_first;
+    }
+    else if (line_first > ShiftLine)
+    {
+        // Apply pending shift to lines we are leaving behind
+        for (int line_n = ShiftLine; line_n < line_first && line_n < StartsW.Size; line_n++)
+        {
+            StartsW[line_n] += ShiftW;
+            StartsA[line_n] += ShiftA;
+        }
+        ShiftLine = line_first;
+    }
+    else
+    {
+        for (int line_n = line_first; line_n < ShiftLine && line_n < StartsW.Size; line_n++)
+        {
+            StartsW[line_n] += delta_w;
+            StartsA[line_n] += delta_a;
+        }
+    }
+    ShiftW += delta_w;
+    ShiftA += delta_a;
+}
+
+void ImGuiInputTextLineIndex::InsertLines(int line_n, const int* starts_w, const int* starts_a, int count)
+{
+    IM_ASSERT(line_n <= ShiftLine); // Shift(line_n, ...) should have been called first
+    const bool in_shift = (line_n == ShiftLine);
+    const int old_count = StartsW.Size;
+    StartsW.resize(old_count + count);
+    StartsA.resize(old_count + count);
+    memmove(StartsW.Data + line_n + count, StartsW.Data + line_n, (size_t)(old_count - line_n) * sizeof(int));
+    memmove(StartsA.Data + line_n + count, StartsA.Data + line_n, (size_t)(old_count - line_n) * sizeof(int));
+    for (int n = 0; n < count; n++)
+    {
+        StartsW[line_n + n] = starts_w[n] - (in_shift ? ShiftW : 0);
+        StartsA[line_n + n] = starts_a[n] - (in_shift ? ShiftA : 0);
+    }
+    if (!in_shift)
+        ShiftLine += count;
+}
+
+void ImGuiInputTextLineIndex::EraseLines(int line_n, int count)
+{
+    IM_ASSERT(line_n + count <= ShiftLine); // Shift(line_n + count, ...) should have been called first
+    memmove(StartsW.Data + line_n, StartsW.Data + line_n + count, (size_t)(StartsW.Size - line_n - count) * sizeof(int));
+    memmove(StartsA.Data + line_n, StartsA.Data + line_n + count, (size_t)(StartsA.Size - line_n - count) * sizeof(int));
+    StartsW.resize(StartsW.Size - count);
+    StartsA.resize(StartsA.Size - count);
+    ShiftLine -= count;
+}
+
+static int InputTextLargeGetLineEnd(const ImGuiInputTextState* state, int line_n)
+{
+    return (line_n + 1 < state->Lines.GetLineCount()) ? state->Lines.GetStartW(line_n + 1) : state->CurLenW;
+}
+
+// Count UTF-8 bytes of characters [begin, end), which may straddle the gap
+static int InputTextLargeCountUtf8Bytes(const ImGuiInputTextState* state, int begin, int end)
+{
+    const ImWchar* text = state->TextW.Data;
+    const int gap_size = state->GapEnd - state->GapStart;
+    int bytes = 0;
+    if (begin < state->GapStart)
+        bytes += ImTextCountUtf8BytesFromStr(text + begin, text + ImMin(end, state->GapStart));
+    if (end > state->GapStart)
+        bytes += ImTextCountUtf8BytesFromStr(text + gap_size + ImMax(begin, state->GapStart), text + gap_size + end);
+    return bytes;
+}
+
+// Convert characters [begin, end) to UTF-8 into 'out' (resized to fit, zero-terminated). Return bytes count.
+static int InputTextLargeGetUtf8(const ImGuiInputTextState* state, int begin, int end, ImVector<char>* out)
+{
+    const ImWchar* text = state->TextW.Data;
+    const int gap_size = state->GapEnd - state->GapStart;
+    out->resize(InputTextLargeCountUtf8Bytes(state, begin, end) + 1);
+    int bytes = 0;
+    if (begin < state->GapStart)
+        bytes += ImTextStrToUtf8(out->Data, out->Size, text + begin, text + ImMin(end, state->GapStart));
+    if (end > state->GapStart)
+        bytes += ImTextStrToUtf8(out->Data + bytes, out->Size - bytes, text + gap_size + ImMax(begin, state->GapStart), text + gap_size + end);
+    return bytes;
+}
+
+// Width of characters [begin, end) which are expected to be on a same line
+static float InputTextLargeCalcWidth(ImGuiContext* ctx, const ImGuiInputTextState* state, int begin, int end)
+{
+    ImFont* font = ctx->Font;
+    const float scale = ctx->FontSize / font->FontSize;
+    float width = 0.0f;
+    for (int n = begin; n < end; n++)
+    {
+        const ImWchar c = state->GetCharW(n);
+        if (c != '\n' && c != '\r')
+            width += font->GetCharAdvance(c);
+    }
+    return width * scale;
+}
+
+static void InputTextLargeMoveGap(ImGuiInputTextState* state, int pos)
+{
+    ImWchar* text = state->TextW.Data;
+    const int gap_size = state->GapEnd - state->GapStart;
+    if (pos < state->GapStart)
+        memmove(text + pos + gap_size, text + pos, (size_t)(state->GapStart - pos) * sizeof(ImWchar));
+    else if (pos > state->GapStart)
+        memmove(text + state->GapStart, text + state->GapEnd, (size_t)(pos - state->GapStart) * sizeof(ImWchar));
+    state->GapStart = pos;
+    state->GapEnd = pos + gap_size;
+}
+
+// Called after TextW/CurLenW have been filled from 'buf': setup gap and line index.
+static void InputTextLargeInit(ImGuiInputTextState* state, const char* buf)
+{
+    state->GapStart = state->CurLenW;
+    state->GapEnd = state->TextW.Size;
+    state->LargeEdits.resize(0);
+    state->LargeEditsText.resize(0);
+
+    ImGuiInputTextLineIndex* lines = &state->Lines;
+    lines->Clear();
+    lines->StartsW.push_back(0);
+    lines->StartsA.push_back(0);
+    const ImWchar* text = state->TextW.Data;
+    int line_start_a = 0;
+    for (int line_start = 0, n = 0; n < state->CurLenW; n++)
+        if (text[n] == '\n')
+        {
+            line_start_a += ImTextCountUtf8BytesFromStr(text + line_start, text + n + 1);
+            line_start = n + 1;
+            lines->StartsW.push_back(line_start);
+            lines->StartsA.push_back(line_start_a);
+        }
+
+    // Our edits are expressed in UTF-8 encoded from our wchar buffer: if 'buf' doesn't match that encoding (e.g. invalid UTF-8), the first edit will rewrite it entirely.
+    const int buf_len = (int)strlen(buf);
+    const int text_len_a = ImTextCountUtf8BytesFromStr(text, text + state->CurLenW);
+    state->LargeBufInSync = false;
+    if (text_len_a == buf_len)
+    {
+        InputTextLargeGetUtf8(state, 0, state->CurLenW, &state->TextA);
+        state->LargeBufInSync = (memcmp(state->TextA.Data, buf, (size_t)buf_len) == 0);
+    }
+    state->CurLenA = text_len_a;
+}
+
+static void InputTextLargeDeleteChars(ImGuiInputTextState* obj, int pos, int n)
+{
+    ImGuiInputTextLineIndex* lines = &obj->Lines;
+    const int line_first = lines->FindLine(pos);
+    const int line_last = lines->FindLine(pos + n); // Lines starting in (pos, pos + n] are removed
+    const int pos_a = lines->GetStartA(line_first) + InputTextLargeCountUtf8Bytes(obj, lines->GetStartW(line_first), pos);
+    const int len_a = InputTextLargeCountUtf8Bytes(obj, pos, pos + n);
+
+    lines->Shift(line_last + 1, -n, -len_a);
+    if (line_last > line_first)
+        lines->EraseLines(line_first + 1, line_last - line_first);
+
+    InputTextLargeMoveGap(obj, pos);
+    obj->GapEnd += n;
+
+    ImGuiInputTextLargeEdit edit = { pos_a, len_a, 0, 0 };
+    obj->LargeEdits.push_back(edit);
+    obj->Edited = true;
+    obj->CurLenA -= len_a;
+    obj->CurLenW -= n;
+}
+
+static bool InputTextLargeInsertChars(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
+{
+    const bool is_resizable = (obj->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    const int new_text_len_utf8 = ImTextCountUtf8BytesFromStr(new_text, new_text + new_text_len);
+    if (!is_resizable && (new_text_len_utf8 + obj->CurLenA + 1 > obj->BufCapacityA))
+        return false;
+
+    // Grow gap if needed
+    if (obj->GapEnd - obj->GapStart < new_text_len)
+    {
+        const int old_size = obj->TextW.Size;
+        const int tail_len = old_size - obj->GapEnd;
+        obj->TextW.resize(old_size + ImMax(new_text_len, ImMax(old_size / 2, 256)));
+        memmove(obj->TextW.Data + obj->TextW.Size - tail_len, obj->TextW.Data + obj->GapEnd, (size_t)tail_len * sizeof(ImWchar));
+        obj->GapEnd = obj->TextW.Size - tail_len;
+    }
+
+    // Update line index
+    ImGuiInputTextLineIndex* lines = &obj->Lines;
+    const int line_n = lines->FindLine(pos);
+    const int pos_a = lines->GetStartA(line_n) + InputTextLargeCountUtf8Bytes(obj, lines->GetStartW(line_n), pos);
+    lines->Shift(line_n + 1, new_text_len, new_text_len_utf8);
+    int new_lines_count = 0;
+    for (int n = 0; n < new_text_len; n++)
+        if (new_text[n] == '\n')
+            new_lines_count++;
+    if (new_lines_count > 0)
+    {
+        ImGuiContext& g = *obj->Ctx;
+        g.TempBuffer.reserve_discard(new_lines_count * 2 * (int)sizeof(int));
+        int* new_starts_w = (int*)(void*)g.TempBuffer.Data;
+        int* new_starts_a = new_starts_w + new_lines_count;
+        int bytes = 0;
+        for (int n = 0, line_start = 0, out_n = 0; n < new_text_len; n++)
+            if (new_text[n] == '\n')
+            {
+                bytes += ImTextCountUtf8BytesFromStr(new_text + line_start, new_text + n + 1);
+                line_start = n + 1;
+                new_starts_w[out_n] = pos + n + 1;
+                new_starts_a[out_n] = pos_a + bytes;
+                out_n++;
+            }
+        lines->InsertLines(line_n + 1, new_starts_w, new_starts_a, new_lines_count);
+    }
+
+    InputTextLargeMoveGap(obj, pos);
+    memcpy(obj->TextW.Data + pos, new_text, (size_t)new_text_len * sizeof(ImWchar));
+    obj->GapStart += new_text_len;
+
+    ImGuiInputTextLargeEdit edit = { pos_a, 0, new_text_len_utf8, obj->LargeEditsText.Size };
+    obj->LargeEdits.push_back(edit);
+    obj->LargeEditsText.resize(obj->LargeEditsText.Size + new_text_len_utf8 + 1);
+    ImTextStrToUtf8(obj->LargeEditsText.Data + edit.InsertOffset, new_text_len_utf8 + 1, new_text, new_text + new_text_len);
+    obj->LargeEditsText.pop_back(); // Remove zero-terminator
+
+    obj->Edited = true;
+    obj->CurLenW += new_text_len;
+    obj->CurLenA += new_text_len_utf8;
+    return true;
+}
+
+static void InputTextLargeResizeUserBuffer(ImGuiInputTextState* state, char** p_buf, int* p_buf_size, int new_len, ImGuiInputTextCallback callback, void* callback_user_data)
+{
+    ImGuiInputTextCallbackData callback_data;
+    callback_data.Ctx = state->Ctx;
+    callback_data.EventFlag = ImGuiInputTextFlags_CallbackResize;
+    callback_data.Flags = state->Flags;
+    callback_data.Buf = *p_buf;
+    callback_data.BufTextLen = new_len;
+    callback_data.BufSize = ImMax(*p_buf_size, new_len + 1);
+    callback_data.UserData = callback_user_data;
+    callback(&callback_data);
+    *p_buf = callback_data.Buf;
+    *p_buf_size = callback_data.BufSize;
+}
+
+// Apply LargeEdits[] to user buffer, which holds 'buf_len' bytes of our text before those edits.
+// With a resizable buffer, we grow it to the largest intermediate length first and shrink it after applying edits.
+static void InputTextLargeApplyEdits(ImGuiInputTextState* state, char** p_buf, int* p_buf_size, int buf_len, ImGuiInputTextCallback callback, void* callback_user_data)
+{
+    IM_ASSERT(state->LargeBufInSync);
+    const bool is_resizable = (state->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    int len_max = buf_len;
+    for (int len = buf_len, n = 0; n < state->LargeEdits.Size; n++)
+    {
+        len += state->LargeEdits[n].InsertLenA - state->LargeEdits[n].DeleteLenA;
+        len_max = ImMax(len_max, len);
+    }
+    if (is_resizable && len_max != buf_len)
+        InputTextLargeResizeUserBuffer(state, p_buf, p_buf_size, len_max, callback, callback_user_data);
+    IM_ASSERT(len_max + 1 <= *p_buf_size);
+
+    char* buf = *p_buf;
+    int len = buf_len;
+    for (int n = 0; n < state->LargeEdits.Size; n++)
+    {
+        const ImGuiInputTextLargeEdit* edit = &state->LargeEdits[n];
+        IM_ASSERT(edit->PosA + edit->DeleteLenA <= len);
+        memmove(buf + edit->PosA + edit->InsertLenA, buf + edit->PosA + edit->DeleteLenA, (size_t)(len - edit->PosA - edit->DeleteLenA));
+        memcpy(buf + edit->PosA, state->LargeEditsText.Data + edit->InsertOffset, (size_t)edit->InsertLenA);
+        len += edit->InsertLenA - edit->DeleteLenA;
+    }
+    IM_ASSERT(len == state->CurLenA);
+    buf[len] = 0;
+    if (is_resizable && len != len_max)
+        InputTextLargeResizeUserBuffer(state, p_buf, p_buf_size, len, callback, callback_user_data);
+
+    state->LargeEdits.resize(0);
+    state->LargeEditsText.resize(0);
+}
+
 // Wrapper for stb_textedit.h to edit text (our wrapper is for: statically sized buffer, single-line, wchar characters. InputText converts between UTF-8 and wchar)
 namespace ImStb
 {
 
 static int     STB_TEXTEDIT_STRINGLEN(const ImGuiInputTextState* obj)                             { return obj->CurLenW; }
-static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { return obj->TextW[idx]; }
-static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx + char_idx]; if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
+static ImWchar STB_TEXTEDIT_GETCHAR(const ImGuiInputTextState* obj, int idx)                      { return obj->GetCharW(idx); }
+static float   STB_TEXTEDIT_GETWIDTH(ImGuiInputTextState* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->GetCharW(line_start_idx + char_idx); if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; ImGuiContext& g = *obj->Ctx; return g.Font->GetCharAdvance(c) * (g.FontSize / g.Font->FontSize); }
 static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
 static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, ImGuiInputTextState* obj, int line_start_idx)
 {
+    if (obj->Flags & ImGuiInputTextFlags_LargeText)
+    {
+        const int line_end = InputTextLargeGetLineEnd(obj, obj->Lines.FindLine(line_start_idx));
+        r->x0 = 0.0f;
+        r->x1 = InputTextLargeCalcWidth(obj->Ctx, obj, line_start_idx, line_end);
+        r->baseline_y_delta = r->ymax = obj->Ctx->FontSize;
+        r->ymin = 0.0f;
+        r->num_chars = line_end - line_start_idx;
+        return;
+    }
     const ImWchar* text = obj->TextW.Data;
     const ImWchar* text_remaining = NULL;
     const ImVec2 size = InputTextCalcTextSizeW(obj->Ctx, text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
@@ -3726,10 +4044,10 @@ static int is_word_boundary_from_right(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    bool prev_white = ImCharIsBlankW(obj->TextW[idx - 1]);
-    bool prev_separ = is_separator(obj->TextW[idx - 1]);
-    bool curr_white = ImCharIsBlankW(obj->TextW[idx]);
-    bool curr_separ = is_separator(obj->TextW[idx]);
+    bool prev_white = ImCharIsBlankW(obj->GetCharW(idx - 1));
+    bool prev_separ = is_separator(obj->GetCharW(idx - 1));
+    bool curr_white = ImCharIsBlankW(obj->GetCharW(idx));
+    bool curr_separ = is_separator(obj->GetCharW(idx));
     return ((prev_white || prev_separ) && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
 }
 static int is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)
@@ -3737,10 +4055,10 @@ static int is_word_boundary_from_left(ImGuiInputTextState* obj, int idx)
     if ((obj->Flags & ImGuiInputTextFlags_Password) || idx <= 0)
         return 0;
 
-    bool prev_white = ImCharIsBlankW(obj->TextW[idx]);
-    bool prev_separ = is_separator(obj->TextW[idx]);
-    bool curr_white = ImCharIsBlankW(obj->TextW[idx - 1]);
-    bool curr_separ = is_separator(obj->TextW[idx - 1]);
+    bool prev_white = ImCharIsBlankW(obj->GetCharW(idx));
+    bool prev_separ = is_separator(obj->GetCharW(idx));
+    bool curr_white = ImCharIsBlankW(obj->GetCharW(idx - 1));
+    bool curr_separ = is_separator(obj->GetCharW(idx - 1));
     return ((prev_white) && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
 }
 static int  STB_TEXTEDIT_MOVEWORDLEFT_IMPL(ImGuiInputTextState* obj, int idx)   { idx--; while (idx >= 0 && !is_word_boundary_from_right(obj, idx)) idx--; return idx < 0 ? 0 : idx; }
@@ -3750,8 +4068,35 @@ static int  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL(ImGuiInputTextState* obj, int idx)
 #define STB_TEXTEDIT_MOVEWORDLEFT   STB_TEXTEDIT_MOVEWORDLEFT_IMPL  // They need to be #define for stb_textedit.h
 #define STB_TEXTEDIT_MOVEWORDRIGHT  STB_TEXTEDIT_MOVEWORDRIGHT_IMPL
 
+// Rows are lines (we don't wrap), so with a line index we can start searching from the line before the one we are looking for.
+// Without ImGuiInputTextFlags_LargeText, we start from the first row as stb_textedit.h does.
+static int STB_TEXTEDIT_SKIPROWS_TO_CHAR_IMPL(ImGuiInputTextState* obj, int n, int* out_prev_row_start, float* out_y)
+{
+    if (!(obj->Flags & ImGuiInputTextFlags_LargeText))
+        return 0;
+    const int line_n = ImMax(obj->Lines.FindLine(n) - 1, 0);
+    *out_prev_row_start = (line_n > 0) ? obj->Lines.GetStartW(line_n - 1) : 0;
+    *out_y = line_n * obj->Ctx->FontSize;
+    return obj->Lines.GetStartW(line_n);
+}
+static int STB_TEXTEDIT_SKIPROWS_TO_Y_IMPL(ImGuiInputTextState* obj, float y, float* out_base_y)
+{
+    if (!(obj->Flags & ImGuiInputTextFlags_LargeText))
+        return 0;
+    const int line_n = ImClamp((int)ImFloor(y / obj->Ctx->FontSize) - 1, 0, obj->Lines.GetLineCount() - 1);
+    *out_base_y = line_n * obj->Ctx->FontSize;
+    return obj->Lines.GetStartW(line_n);
+}
+#define STB_TEXTEDIT_SKIPROWS_TO_CHAR   STB_TEXTEDIT_SKIPROWS_TO_CHAR_IMPL
+#define STB_TEXTEDIT_SKIPROWS_TO_Y      STB_TEXTEDIT_SKIPROWS_TO_Y_IMPL
+
 static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 {
+    if (obj->Flags & ImGuiInputTextFlags_LargeText)
+    {
+        InputTextLargeDeleteChars(obj, pos, n);
+        return;
+    }
     ImWchar* dst = obj->TextW.Data + pos;
 
     // We maintain our buffer length in both UTF-8 and wchar formats
@@ -3768,6 +4113,8 @@ static void STB_TEXTEDIT_DELETECHARS(ImGuiInputTextState* obj, int pos, int n)
 
 static bool STB_TEXTEDIT_INSERTCHARS(ImGuiInputTextState* obj, int pos, const ImWchar* new_text, int new_text_len)
 {
+    if (obj->Flags & ImGuiInputTextFlags_LargeText)
+        return InputTextLargeInsertChars(obj, pos, new_text, new_text_len);
     const bool is_resizable = (obj->Flags & ImGuiInputTextFlags_CallbackResize) != 0;
     const int text_len = obj->CurLenW;
     IM_ASSERT(pos <= text_len);
@@ -4045,10 +4392,13 @@ static void InputTextReconcileUndoStateAfterUserCallback(ImGuiInputTextState* st
 // but that more likely be attractive when we do have _NoLiveEdit flag available.
 void ImGui::InputTextDeactivateHook(ImGuiID id)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_InputText);
     ImGuiContext& g = *GImGui;
     ImGuiInputTextState* state = &g.InputTextState;
     if (id == 0 || state->ID != id)
         return;
+    if (state->Flags & ImGuiInputTextFlags_LargeText) // Edits are already applied to user buffer every frame
+        return;
     g.InputTextDeactivatedState.ID = state->ID;
     g.InputTextDeactivatedState.TextA.resize(state->CurLenA + 1);
     memcpy(g.InputTextDeactivatedState.TextA.Data, state->TextA.Data ? state->TextA.Data : "", state->CurLenA + 1);
@@ -4064,6 +4414,7 @@ void ImGui::InputTextDeactivateHook(ImGuiID id)
 //  doing UTF8 > U16 > UTF8 conversions on the go to easily interface with stb_textedit. Ideally should stay in UTF-8 all the time. See https://github.com/nothings/stb/issues/188)
 bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback, void* callback_user_data)
 {
+    IM_ALLOC_TAG_SCOPE(ImGuiAllocTag_InputText);
     ImGuiWindow* window = GetCurrentWindow();
     if (window->SkipItems)
         return false;
@@ -4082,8 +4433,11 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
     const bool is_password = (flags & ImGuiInputTextFlags_Password) != 0;
     const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0;
     const bool is_resizable = (flags & ImGuiInputTextFlags_CallbackResize) != 0;
+    const bool is_large_text = (flags & ImGuiInputTextFlags_LargeText) != 0;
     if (is_resizable)
         IM_ASSERT(callback != NULL); // Must provide a callback if you set the ImGuiInputTextFlags_CallbackResize flag!
+    if (is_large_text)
+        IM_ASSERT(is_multiline && !is_password && !(flags & (ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackAlways | ImGuiInputTextFlags_CallbackEdit))); // See ImGuiInputTextFlags_LargeText
 
     if (is_multiline) // Open group before calling GetID() because groups tracks id created within their scope (including the scrollbar)
         BeginGroup();
@@ -4191,6 +4545,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         state->TextAIsValid = false;                // TextA is not valid yet (we will display buf until then)
         state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, buf_size, buf, NULL, &buf_end);
         state->CurLenA = (int)(buf_end - buf);      // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+        state->GapStart = state->GapEnd = 0;
+        if (is_large_text)
+            InputTextLargeInit(state, buf);
 
         if (recycle_state)
         {
@@ -4263,7 +4620,22 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
     // When read-only we always use the live data passed to the function
     // FIXME-OPT: Because our selection/cursor code currently needs the wide text we need to convert it when active, which is not ideal :(
-    if (is_readonly && state != NULL && (render_cursor || render_selection))
+    if (is_readonly && state != NULL && (render_cursor || render_selection) && is_large_text)
+    {
+        // Only convert again when 'buf' changed (we keep a copy in InitialTextA)
+        const int buf_len = (int)strlen(buf);
+        if (buf_len + 1 != state->InitialTextA.Size || memcmp(buf, state->InitialTextA.Data, (size_t)buf_len) != 0)
+        {
+            state->InitialTextA.resize(buf_len + 1);
+            memcpy(state->InitialTextA.Data, buf, (size_t)buf_len + 1);
+            state->TextW.resize(buf_size + 1);
+            state->CurLenW = ImTextStrFromUtf8(state->TextW.Data, state->TextW.Size, buf, NULL);
+            InputTextLargeInit(state, buf);
+            state->CursorClamp();
+        }
+        render_selection &= state->HasSelection();
+    }
+    else if (is_readonly && state != NULL && (render_cursor || render_selection))
     {
         const char* buf_end = NULL;
         state->TextW.resize(buf_size + 1);
@@ -4516,6 +4888,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
+                if (is_large_text)
+                    InputTextLargeMoveGap(state, ie); // Make selection contiguous
                 const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
                 char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
                 ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
@@ -4591,10 +4965,12 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 }
                 stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
             }
+            if (is_large_text)
+                apply_new_text = NULL; // stb_textedit_replace() recorded the edits, applied below
         }
 
         // Apply ASCII value
-        if (!is_readonly)
+        if (!is_readonly && !is_large_text)
         {
             state->TextAIsValid = true;
             state->TextA.resize(state->TextW.Size * 4 + 1);
@@ -4692,13 +5068,33 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             }
 
             // Will copy result string if modified
-            if (!is_readonly && strcmp(state->TextA.Data, buf) != 0)
+            if (!is_readonly && !is_large_text && strcmp(state->TextA.Data, buf) != 0)
             {
                 apply_new_text = state->TextA.Data;
                 apply_new_text_length = state->CurLenA;
                 value_changed = true;
             }
         }
+
+        // Large text: patch user buffer in place with this frame's edits (see ImGuiInputTextFlags_LargeText)
+        if (is_large_text && !is_readonly && state->LargeEdits.Size > 0)
+        {
+            if (state->LargeBufInSync)
+            {
+                InputTextLargeApplyEdits(state, &buf, &buf_size, backup_current_text_length, callback, callback_user_data);
+            }
+            else
+            {
+                // User buffer didn't hold our exact UTF-8 on activation (e.g. malformed or truncated): rewrite it once.
+                InputTextLargeGetUtf8(state, 0, state->CurLenW, &state->TextA);
+                apply_new_text = state->TextA.Data;
+                apply_new_text_length = state->CurLenA;
+                state->LargeEdits.resize(0);
+                state->LargeEditsText.resize(0);
+                state->LargeBufInSync = true;
+            }
+            value_changed = true;
+        }
     }
 
     // Handle reapplying final data on deactivation (see InputTextDeactivateHook() for details)
@@ -4791,6 +5187,23 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         const ImWchar* text_begin = state->TextW.Data;
         ImVec2 cursor_offset, select_start_offset;
 
+        if (is_large_text)
+        {
+            // Large text: find lines with the line index and measure from the beginning of the line
+            const ImGuiInputTextLineIndex* lines = &state->Lines;
+            const int cursor_line = lines->FindLine(state->Stb.cursor);
+            cursor_offset.x = InputTextLargeCalcWidth(&g, state, lines->GetStartW(cursor_line), state->Stb.cursor);
+            cursor_offset.y = (cursor_line + 1) * g.FontSize;
+            if (render_selection)
+            {
+                const int select_start = ImMin(state->Stb.select_start, state->Stb.select_end);
+                const int select_start_line = lines->FindLine(select_start);
+                select_start_offset.x = InputTextLargeCalcWidth(&g, state, lines->GetStartW(select_start_line), select_start);
+                select_start_offset.y = (select_start_line + 1) * g.FontSize;
+            }
+            text_size = ImVec2(inner_size.x, lines->GetLineCount() * g.FontSize);
+        }
+        else
         {
             // Find lines numbers straddling 'cursor' (slot 0) and 'select_start' (slot 1) positions.
             const ImWchar* searches_input_ptr[2] = { NULL, NULL };
@@ -4878,7 +5291,33 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
 
         // Draw selection
         const ImVec2 draw_scroll = ImVec2(state->ScrollX, 0.0f);
-        if (render_selection)
+        if (render_selection && is_large_text)
+        {
+            // Large text: only visit selected lines which are visible
+            const ImGuiInputTextLineIndex* lines = &state->Lines;
+            const int select_min = ImMin(state->Stb.select_start, state->Stb.select_end);
+            const int select_max = ImMax(state->Stb.select_start, state->Stb.select_end);
+            const int select_line_min = lines->FindLine(select_min);
+            int select_line_max = lines->FindLine(select_max);
+            if (select_line_max > select_line_min && lines->GetStartW(select_line_max) == select_max)
+                select_line_max--;
+            const int line_first = ImMax(select_line_min, (int)ImFloor((clip_rect.y - draw_pos.y) / g.FontSize) - 1);
+            const int line_last = ImMin(select_line_max, (int)ImFloor((clip_rect.w - draw_pos.y) / g.FontSize) + 1);
+            ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f);
+            for (int line_n = line_first; line_n <= line_last && select_min < select_max; line_n++)
+            {
+                const int line_start = lines->GetStartW(line_n);
+                const int rect_start = ImMax(line_start, select_min);
+                float rect_width = InputTextLargeCalcWidth(&g, state, rect_start, ImMin(InputTextLargeGetLineEnd(state, line_n), select_max));
+                if (rect_width <= 0.0f) rect_width = IM_FLOOR(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+                ImVec2 rect_pos = draw_pos - draw_scroll + ImVec2((rect_start > line_start) ? InputTextLargeCalcWidth(&g, state, line_start, rect_start) : 0.0f, (line_n + 1) * g.FontSize);
+                ImRect rect(rect_pos - ImVec2(0.0f, g.FontSize), rect_pos + ImVec2(rect_width, 0.0f));
+                rect.ClipWith(clip_rect);
+                if (rect.Overlaps(clip_rect))
+                    draw_window->DrawList->AddRectFilled(rect.Min, rect.Max, bg_color);
+            }
+        }
+        else if (render_selection)
         {
             const ImWchar* text_selected_begin = text_begin + ImMin(state->Stb.select_start, state->Stb.select_end);
             const ImWchar* text_selected_end = text_begin + ImMax(state->Stb.select_start, state->Stb.select_end);
@@ -4914,7 +5353,29 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         }
 
         // We test for 'buf_display_max_length' as a way to avoid some pathological cases (e.g. single-line 1 MB string) which would make ImDrawList crash.
-        if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
+        if (is_large_text && !is_displaying_hint)
+        {
+            // Large text: only submit visible lines
+            const ImGuiInputTextLineIndex* lines = &state->Lines;
+            const int line_count = lines->GetLineCount();
+            const int line_first = ImClamp((int)ImFloor((clip_rect.y - draw_pos.y) / g.FontSize), 0, line_count - 1);
+            const int line_last = ImClamp((int)ImFloor((clip_rect.w - draw_pos.y) / g.FontSize), line_first, line_count - 1);
+            const char* text_display_begin;
+            const char* text_display_end;
+            if (state->LargeBufInSync)
+            {
+                text_display_begin = buf + lines->GetStartA(line_first);
+                text_display_end = (line_last + 1 < line_count) ? buf + lines->GetStartA(line_last + 1) : buf + state->CurLenA;
+            }
+            else
+            {
+                const int len = InputTextLargeGetUtf8(state, lines->GetStartW(line_first), InputTextLargeGetLineEnd(state, line_last), &state->TextA);
+                text_display_begin = state->TextA.Data;
+                text_display_end = text_display_begin + len;
+            }
+            draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos + ImVec2(0.0f, line_first * g.FontSize) - draw_scroll, GetColorU32(ImGuiCol_Text), text_display_begin, text_display_end, 0.0f, NULL);
+        }
+        else if (is_multiline || (buf_display_end - buf_display) < buf_display_max_length)
         {
             ImU32 col = GetColorU32(is_displaying_hint ? ImGuiCol_TextDisabled : ImGuiCol_Text);
             draw_window->DrawList->AddText(g.Font, g.FontSize, draw_pos - draw_scroll, col, buf_display, buf_display_end, 0.0f, is_multiline ? NULL : &clip_rect);
@@ -6688,6 +7149,7 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotBuffer
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -6847,6 +7309,271 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGui::PlotLines(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Lines, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotEx(ImGuiPlotType_Histogram, label, buffer, overlay_text, scale_min, scale_max, graph_size);
+}
+
+// Plot a ImGuiPlotBuffer, one min/max range per pixel column.
+// When there are fewer values than pixels we use the regular PlotEx() path, which draws one segment/bar per value.
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotBuffer* buffer, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return -1;
+
+    const ImGuiStyle& style = g.Style;
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), label_size.y + style.FramePadding.y * 2.0f);
+    const int columns_count = (int)(frame_size.x - style.FramePadding.x * 2.0f);
+    const int values_count = buffer->Count;
+    if (values_count <= columns_count)
+        return PlotEx(plot_type, label, &ImGuiPlotBuffer::Getter, (void*)buffer, values_count, 0, overlay_text, scale_min, scale_max, frame_size);
+
+    const ImGuiID id = window->GetID(label);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return -1;
+    const bool hovered = ItemHoverable(frame_bb, id);
+
+    // Determine scale from values if not specified (O(log N) with the pyramid)
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        float v_min = FLT_MAX;
+        float v_max = -FLT_MAX;
+        buffer->GetMinMax(0, values_count, &v_min, &v_max);
+        if (scale_min == FLT_MAX)
+            scale_min = v_min;
+        if (scale_max == FLT_MAX)
+            scale_max = v_max;
+    }
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    // Column 'n' covers values [n * values_count / columns_count, (n + 1) * values_count / columns_count)
+    // 'columns_count' may be 0 when the frame is squeezed to less than 1 pixel of inner width: we still submit the item but draw nothing.
+    int idx_hovered = -1;
+    int column_hovered = -1;
+    if (hovered && columns_count > 0 && inner_bb.Contains(g.IO.MousePos))
+    {
+        column_hovered = ImClamp((int)(g.IO.MousePos.x - inner_bb.Min.x), 0, columns_count - 1);
+        const int idx_begin = (int)((ImS64)column_hovered * values_count / columns_count);
+        const int idx_end = (int)((ImS64)(column_hovered + 1) * values_count / columns_count);
+        float v_min, v_max;
+        if (buffer->GetMinMax(idx_begin, idx_end, &v_min, &v_max))
+            SetTooltip("%d..%d: %8.4g .. %8.4g", idx_begin, idx_end - 1, v_min, v_max);
+        idx_hovered = idx_begin;
+    }
+
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float height = inner_bb.GetHeight();
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+    const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+    const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+
+    // Lines: draw the [min,max] range of each column, extended toward the previous column so consecutive columns stay connected.
+    // Histogram: draw a bar from the zero line to the furthest of min/max.
+    float prev_y_min = -1.0f, prev_y_max = -1.0f;
+    for (int n = 0; n < columns_count; n++)
+    {
+        const int idx_begin = (int)((ImS64)n * values_count / columns_count);
+        const int idx_end = (int)((ImS64)(n + 1) * values_count / columns_count);
+        float v_min, v_max;
+        if (!buffer->GetMinMax(idx_begin, idx_end, &v_min, &v_max))
+        {
+            prev_y_min = prev_y_max = -1.0f;
+            continue;
+        }
+        float y_min = (1.0f - ImSaturate((v_max - scale_min) * inv_scale)) * height; // Top of range (screen space)
+        float y_max = (1.0f - ImSaturate((v_min - scale_min) * inv_scale)) * height;
+        const float x = inner_bb.Min.x + (float)n;
+        const ImU32 col = (n == column_hovered) ? col_hovered : col_base;
+        if (plot_type == ImGuiPlotType_Lines)
+        {
+            const float y0 = (prev_y_min >= 0.0f) ? ImMin(y_min, prev_y_max) : y_min;
+            const float y1 = (prev_y_min >= 0.0f) ? ImMax(y_max, prev_y_min) : y_max;
+            prev_y_min = y_min;
+            prev_y_max = y_max;
+            window->DrawList->AddRectFilled(ImVec2(x, IM_FLOOR(inner_bb.Min.y + y0)), ImVec2(x + 1.0f, IM_FLOOR(inner_bb.Min.y + y1) + 1.0f), col);
+        }
+        else if (plot_type == ImGuiPlotType_Histogram)
+        {
+            const float y_zero = histogram_zero_line_t * height;
+            window->DrawList->AddRectFilled(ImVec2(x, inner_bb.Min.y + ImMin(y_min, y_zero)), ImVec2(x + 1.0f, inner_bb.Min.y + ImMax(y_max, y_zero)), col);
+        }
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f, 0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+
+    return idx_hovered;
+}
+
+//-------------------------------------------------------------------------
+// ImGuiPlotBuffer
+//-------------------------------------------------------------------------
+
+// Level 0 of the pyramid has 1 entry per IMGUI_PLOTBUFFER_LEAF_SIZE values, each upper level has 1 entry per 2 entries of the level below.
+#define IMGUI_PLOTBUFFER_LEAF_SHIFT     2
+#define IMGUI_PLOTBUFFER_LEAF_SIZE      (1 << IMGUI_PLOTBUFFER_LEAF_SHIFT)
+
+void ImGuiPlotBuffer::SetCapacity(int capacity)
+{
+    IM_ASSERT(capacity >= 0);
+    Values.resize(capacity);
+    memset(Values.Data, 0, (size_t)Values.size_in_bytes());
+    Count = Head = 0;
+
+    LevelOffsets.resize(0);
+    int total = 0;
+    for (int level_size = (capacity + IMGUI_PLOTBUFFER_LEAF_SIZE - 1) >> IMGUI_PLOTBUFFER_LEAF_SHIFT; level_size > 0; level_size = (level_size == 1) ? 0 : (level_size + 1) >> 1)
+    {
+        LevelOffsets.push_back(total);
+        total += level_size;
+    }
+    LevelOffsets.push_back(total);
+    MinMax.resize(total);
+    for (int n = 0; n < total; n++)
+        MinMax[n] = ImVec2(FLT_MAX, -FLT_MAX);
+}
+
+static inline void PlotBuffer_AddValue(ImVec2* mm, float v)
+{
+    if (v != v) // Ignore NaN values
+        return;
+    mm->x = ImMin(mm->x, v);
+    mm->y = ImMax(mm->y, v);
+}
+
+static inline void PlotBuffer_AddRange(ImVec2* mm, const ImVec2& range)
+{
+    mm->x = ImMin(mm->x, range.x);
+    mm->y = ImMax(mm->y, range.y);
+}
+
+// Recompute pyramid entries covering Values[slot_begin, slot_end)
+static void PlotBuffer_UpdateRange(ImGuiPlotBuffer* buffer, int slot_begin, int slot_end)
+{
+    // Level 0: from values
+    int lo = slot_begin >> IMGUI_PLOTBUFFER_LEAF_SHIFT;
+    int hi = (slot_end - 1) >> IMGUI_PLOTBUFFER_LEAF_SHIFT;
+    ImVec2* level = buffer->MinMax.Data;
+    for (int n = lo; n <= hi; n++)
+    {
+        const int slot_end_n = ImMin((n + 1) << IMGUI_PLOTBUFFER_LEAF_SHIFT, buffer->Values.Size);
+        ImVec2 mm(FLT_MAX, -FLT_MAX);
+        for (int slot = n << IMGUI_PLOTBUFFER_LEAF_SHIFT; slot < slot_end_n; slot++)
+            PlotBuffer_AddValue(&mm, buffer->Values.Data[slot]);
+        level[n] = mm;
+    }
+
+    // Upper levels: from level below
+    for (int level_n = 1; level_n < buffer->LevelOffsets.Size - 1; level_n++)
+    {
+        const ImVec2* child = buffer->MinMax.Data + buffer->LevelOffsets[level_n - 1];
+        const int child_count = buffer->LevelOffsets[level_n] - buffer->LevelOffsets[level_n - 1];
+        level = buffer->MinMax.Data + buffer->LevelOffsets[level_n];
+        lo >>= 1;
+        hi >>= 1;
+        for (int n = lo; n <= hi; n++)
+        {
+            ImVec2 mm = child[n * 2];
+            if (n * 2 + 1 < child_count)
+                PlotBuffer_AddRange(&mm, child[n * 2 + 1]);
+            level[n] = mm;
+        }
+    }
+}
+
+void ImGuiPlotBuffer::PushBack(const float* values, int values_count)
+{
+    const int capacity = Values.Size;
+    IM_ASSERT(capacity > 0 && "Call SetCapacity() first!");
+    if (values_count > capacity)
+    {
+        values += values_count - capacity;
+        values_count = capacity;
+    }
+    while (values_count > 0)
+    {
+        // Write in up to two contiguous chunks (ring buffer wrap)
+        int slot = Head + Count;
+        if (slot >= capacity)
+            slot -= capacity;
+        const int chunk_count = ImMin(values_count, capacity - slot);
+        memcpy(Values.Data + slot, values, (size_t)chunk_count * sizeof(float));
+        PlotBuffer_UpdateRange(this, slot, slot + chunk_count);
+        const int overwritten_count = ImMax(0, Count + chunk_count - capacity);
+        Count += chunk_count - overwritten_count;
+        Head += overwritten_count;
+        if (Head >= capacity)
+            Head -= capacity;
+        values += chunk_count;
+        values_count -= chunk_count;
+    }
+}
+
+// Min/max of Values[slot_begin, slot_end) using the largest pyramid entries fully contained in the range
+static void PlotBuffer_GetMinMaxSlots(const ImGuiPlotBuffer* buffer, int slot_begin, int slot_end, ImVec2* mm)
+{
+    const float* values = buffer->Values.Data;
+    for (; slot_begin < slot_end && (slot_begin & (IMGUI_PLOTBUFFER_LEAF_SIZE - 1)) != 0; slot_begin++)
+        PlotBuffer_AddValue(mm, values[slot_begin]);
+    for (; slot_begin < slot_end && (slot_end & (IMGUI_PLOTBUFFER_LEAF_SIZE - 1)) != 0; slot_end--)
+        PlotBuffer_AddValue(mm, values[slot_end - 1]);
+    int lo = slot_begin >> IMGUI_PLOTBUFFER_LEAF_SHIFT;
+    int hi = slot_end >> IMGUI_PLOTBUFFER_LEAF_SHIFT;
+    for (int level_n = 0; lo < hi; level_n++, lo >>= 1, hi >>= 1)
+    {
+        const ImVec2* level = buffer->MinMax.Data + buffer->LevelOffsets[level_n];
+        if (lo & 1)
+            PlotBuffer_AddRange(mm, level[lo++]);
+        if (hi & 1)
+            PlotBuffer_AddRange(mm, level[--hi]);
+    }
+}
+
+bool ImGuiPlotBuffer::GetMinMax(int idx_begin, int idx_end, float* out_min, float* out_max) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Count);
+    ImVec2 mm(FLT_MAX, -FLT_MAX);
+    int slot_begin = Head + idx_begin;
+    int slot_end = Head + idx_end;
+    const int capacity = Values.Size;
+    if (slot_begin >= capacity)
+    {
+        slot_begin -= capacity;
+        slot_end -= capacity;
+    }
+    if (slot_end > capacity)
+    {
+        PlotBuffer_GetMinMaxSlots(this, slot_begin, capacity, &mm);
+        PlotBuffer_GetMinMaxSlots(this, 0, slot_end - capacity, &mm);
+    }
+    else
+    {
+        PlotBuffer_GetMinMaxSlots(this, slot_begin, slot_end, &mm);
+    }
+    if (mm.x > mm.y)
+        return false;
+    *out_min = mm.x;
+    *out_max = mm.y;
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
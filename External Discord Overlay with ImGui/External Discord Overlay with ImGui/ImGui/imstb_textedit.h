@@ -3,6 +3,7 @@
 // Those changes would need to be pushed into nothings/stb:
 // - Fix in stb_textedit_discard_redo (see https://github.com/nothings/stb/issues/321)
 // - Fix in stb_textedit_find_charpos to handle last line (see https://github.com/ocornut/imgui/issues/6000)
+// - Optional STB_TEXTEDIT_SKIPROWS_TO_Y/STB_TEXTEDIT_SKIPROWS_TO_CHAR to skip rows in stb_text_locate_coord/stb_textedit_find_charpos (used by ImGuiInputTextFlags_LargeText)
 // Grep for [DEAR IMGUI] to find the changes.
 
 // stb_textedit.h - v1.14  - public domain - Sean Barrett
@@ -409,6 +410,10 @@ static int stb_text_locate_coord(STB_TEXTEDIT_STRING *str, float x, float y)
    r.ymin = r.ymax = 0;
    r.num_chars = 0;
 
+   #ifdef STB_TEXTEDIT_SKIPROWS_TO_Y // [DEAR IMGUI]
+   i = STB_TEXTEDIT_SKIPROWS_TO_Y(str, y, &base_y); // [DEAR IMGUI] optional: start from a row known to be above the one straddling 'y'
+   #endif // [DEAR IMGUI]
+
    // search rows to find one that straddles 'y'
    while (i < n) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
@@ -538,6 +543,9 @@ static void stb_textedit_find_charpos(StbFindState *find, STB_TEXTEDIT_STRING *s
 
    // search rows to find the one that straddles character n
    find->y = 0;
+   #ifdef STB_TEXTEDIT_SKIPROWS_TO_CHAR // [DEAR IMGUI]
+   i = STB_TEXTEDIT_SKIPROWS_TO_CHAR(str, n, &prev_start, &find->y); // [DEAR IMGUI] optional: start from a row known to be before the one straddling character n
+   #endif // [DEAR IMGUI]
 
    for(;;) {
       STB_TEXTEDIT_LAYOUTROW(&r, str, i);
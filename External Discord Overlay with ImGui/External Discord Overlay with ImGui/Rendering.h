@@ -96,6 +96,7 @@ namespace Rendering {
         }
 
         void SendToDiscord(UINT width, UINT height) {
+            IM_PROFILE_SCOPE("SendToDiscord");
             if (!DiscordMappedAddress)
                 return;
 
@@ -164,10 +165,10 @@ namespace Rendering {
         ImGuiIO& io = ImGui::GetIO();
         POINT mousePos;
         GetCursorPos(&mousePos);
-        io.MousePos = ImVec2(mousePos.x, mousePos.y);
+        io.AddMousePosEvent((float)mousePos.x, (float)mousePos.y);
 
-        io.MouseDown[0] = (GetKeyState(VK_LBUTTON) & 0x8000) != 0;
-        io.MouseDown[1] = (GetKeyState(VK_RBUTTON) & 0x8000) != 0;
+        io.AddMouseButtonEvent(0, (GetKeyState(VK_LBUTTON) & 0x8000) != 0);
+        io.AddMouseButtonEvent(1, (GetKeyState(VK_RBUTTON) & 0x8000) != 0);
 
     }
 